@@ -0,0 +1,480 @@
+// ProcessArchive.cpp : 측정 결과 열 단위 보관 파일 구현
+
+#include "pch.h"
+#include "ProcessArchive.h"
+#include "ProcessLogWriter.h"
+#include "ProcessMappedFile.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string>
+
+static_assert(sizeof(archive_header) == 64, "archive_header는 64바이트여야 함");
+static_assert(sizeof(archive_row) == 576, "archive_row는 576바이트여야 함");
+static_assert(sizeof(struct pattern) == 32, "pattern은 4바이트 항목 8개여야 함");
+
+namespace {
+    const uint32_t ARCHIVE_MAGIC = 0x4341584F;     // 'OXAC'
+    const uint32_t ARCHIVE_VERSION = 1;
+    const int DEFAULT_CHUNK_ROWS = 256;
+    const int MAX_CHUNK_ROWS = 65536;
+    const int GROW_CHUNKS = 4;                      // 파일 확장 단위 (다시 매핑 횟수 감소)
+
+    const int PATTERNS = 196;                       // data 119 + IPVS_data 70 + measure 7
+    const int FIELDS = 8;
+    const int COLUMNS = PATTERNS * FIELDS;
+    const int IPVS_BASE = 7 * 17;
+    const int MEASURE_BASE = IPVS_BASE + 7 * 10;
+
+    int64_t now_ms()
+    {
+        return (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+}
+
+// 보관 파일 핸들 (DLL 내부 전용)
+struct process_archive {
+    mapped_file file;
+    bool writable;
+    uint8_t* base;          // 파일 전체 매핑 시작 주소
+    size_t mapped;          // 매핑 크기
+
+    archive_header* header() { return reinterpret_cast<archive_header*>(base); }
+
+    std::atomic<uint64_t>* rows_atomic()
+    {
+        return reinterpret_cast<std::atomic<uint64_t>*>(&header()->rows);
+    }
+
+    // 매핑 범위에 온전히 들어 있는 chunk 수
+    uint64_t mapped_chunks()
+    {
+        if (base == nullptr) return 0;  // 확장 후 다시 매핑하지 못한 경우
+        const archive_header* h = header();
+        return (mapped <= h->data_offset) ? 0 : (mapped - h->data_offset) / h->chunk_size;
+    }
+
+    // 읽을 수 있는 행 수 (발행된 행 중 매핑 범위 안)
+    uint64_t visible_rows()
+    {
+        if (base == nullptr) return 0;
+        const uint64_t rows = rows_atomic()->load(std::memory_order_acquire);
+        const uint64_t limit = mapped_chunks() * header()->chunk_rows;
+        return rows < limit ? rows : limit;
+    }
+
+    uint8_t* chunk(uint64_t index)
+    {
+        const archive_header* h = header();
+        return base + h->data_offset + index * h->chunk_size;
+    }
+
+    archive_row* row_info(uint64_t row)
+    {
+        const uint32_t r = header()->chunk_rows;
+        return reinterpret_cast<archive_row*>(chunk(row / r)) + row % r;
+    }
+
+    uint32_t* column(uint64_t chunk_index, int col)
+    {
+        const uint32_t r = header()->chunk_rows;
+        return reinterpret_cast<uint32_t*>(chunk(chunk_index) + (size_t)r * sizeof(archive_row)) + (size_t)col * r;
+    }
+};
+
+namespace {
+
+    bool map_all(process_archive* ar)
+    {
+        const int64_t size = ar->file.size();
+        if (size < (int64_t)sizeof(archive_header)) {
+            return false;
+        }
+        ar->base = (uint8_t*)ar->file.map(0, (size_t)size);
+        ar->mapped = ar->base != nullptr ? (size_t)size : 0;
+        return ar->base != nullptr;
+    }
+
+    void unmap_all(process_archive* ar)
+    {
+        ar->file.unmap(ar->base, ar->mapped);
+        ar->base = nullptr;
+        ar->mapped = 0;
+    }
+
+    bool valid_header(const process_archive* ar)
+    {
+        const archive_header* h = reinterpret_cast<const archive_header*>(ar->base);
+        return h->magic == ARCHIVE_MAGIC && h->version == ARCHIVE_VERSION && h->columns == (uint32_t)COLUMNS &&
+               h->row_size == sizeof(archive_row) && h->output_size == sizeof(struct output) &&
+               h->chunk_rows > 0 && h->chunk_rows <= (uint32_t)MAX_CHUNK_ROWS &&
+               h->chunk_size >= (uint64_t)h->chunk_rows * (sizeof(archive_row) + COLUMNS * 4) &&
+               h->data_offset >= sizeof(archive_header) && h->data_offset <= ar->mapped;
+    }
+
+    // 새 파일 헤더 기록
+    bool create_file(process_archive* ar, int chunk_rows)
+    {
+        archive_header h;
+        std::memset(&h, 0, sizeof(h));
+        h.version = ARCHIVE_VERSION;
+        h.chunk_rows = (uint32_t)chunk_rows;
+        h.columns = (uint32_t)COLUMNS;
+        h.row_size = (uint32_t)sizeof(archive_row);
+        h.output_size = (uint32_t)sizeof(struct output);
+        h.chunk_size = mapped_align_up((uint64_t)chunk_rows * (sizeof(archive_row) + COLUMNS * 4));
+        h.data_offset = mapped_align_up(sizeof(archive_header));
+        h.created_ms = now_ms();
+
+        if (!ar->file.resize((int64_t)h.data_offset) || !map_all(ar)) {
+            return false;
+        }
+        std::memcpy(ar->base, &h, sizeof(h));
+
+        // magic은 마지막에 기록 (읽는 쪽이 초기화 완료 여부 판단)
+        std::atomic_thread_fence(std::memory_order_release);
+        ar->header()->magic = ARCHIVE_MAGIC;
+        return true;
+    }
+
+    // chunk_index가 매핑 범위에 들어오도록 파일 확장 후 다시 매핑
+    bool ensure_chunk(process_archive* ar, uint64_t chunk_index)
+    {
+        if (chunk_index < ar->mapped_chunks()) {
+            return true;
+        }
+
+        const archive_header h = *ar->header();
+        const int64_t size = (int64_t)(h.data_offset + (chunk_index + GROW_CHUNKS) * h.chunk_size);
+        const int64_t old_size = (int64_t)ar->mapped;
+
+        // Windows는 매핑된 파일의 크기를 바꿀 수 없으므로 먼저 해제
+        unmap_all(ar);
+        if (ar->file.resize(size) && map_all(ar)) {
+            return true;
+        }
+
+        //26.10.16 - 확장 실패 (디스크 부족 등): 원래 크기로 되돌려 다시 매핑 - 기존 행은 계속 읽기/쓰기 가능
+        ar->file.resize(old_size);
+        map_all(ar);
+        return false;
+    }
+
+    process_archive* new_archive()
+    {
+        process_archive* ar = new (std::nothrow) process_archive();
+        if (ar == nullptr) return nullptr;
+
+        ar->writable = false;
+        ar->base = nullptr;
+        ar->mapped = 0;
+        return ar;
+    }
+
+    void free_archive(process_archive* ar)
+    {
+        unmap_all(ar);
+        ar->file.close();
+        delete ar;
+    }
+
+    void copy_id(char* dst, const char* src)
+    {
+        std::memset(dst, 0, 256);
+        if (src != nullptr) {
+            const void* nul = std::memchr(src, '\0', 255);
+            std::memcpy(dst, src, nul != nullptr ? (size_t)((const char*)nul - src) : 255);
+        }
+    }
+
+    // 행 1개 복원 - 열마다 값 1개씩 모음
+    void gather_output(process_archive* ar, uint64_t row, struct output* out)
+    {
+        const uint32_t r = ar->header()->chunk_rows;
+        const uint64_t c = row / r;
+        const uint32_t i = (uint32_t)(row % r);
+
+        uint32_t* dst = reinterpret_cast<uint32_t*>(&out->data[0][0]);
+        for (int col = 0; col < COLUMNS; ++col) {
+            dst[col] = ar->column(c, col)[i];
+        }
+        std::memset(out->lut, 0, sizeof(out->lut));
+    }
+
+    const char* judgment_name(int judgment)
+    {
+        switch (judgment) {
+        case 0: return "OK";
+        case 1: return "NG";
+        case 2: return "PTN";
+        default: return "";
+        }
+    }
+
+    // CSV 1행 (C# 로거와 같은 서식 - ProcessLogWriter 공용 서식 사용)
+    void format_csv_row(std::string* buf, int layout, const archive_row& info, const struct output& out)
+    {
+        struct log_meta meta;
+        std::memset(&meta, 0, sizeof(meta));
+        meta.start_ms = info.start_ms;
+        meta.end_ms = info.end_ms;
+        meta.zone = info.zone;
+        std::strcpy(meta.judgment, judgment_name(info.judgment));
+
+        const log_cell cell = { info.CELL_ID, info.INNER_ID, info.total_point, info.cur_point };
+        const struct output* outs[1] = { &out };
+        log_format_row(buf, layout == ARCHIVE_CSV_MTP ? LOG_LAYOUT_EECP : LOG_LAYOUT_IPVS_EECP, meta, cell, outs, 1, 0);
+    }
+}
+
+int64_t archive_row_offset(process_archive* archive, int64_t row)
+{
+    if (archive == nullptr || row < 0 || (uint64_t)row >= archive->visible_rows()) {
+        return -1;
+    }
+    return (int64_t)(reinterpret_cast<uint8_t*>(archive->row_info((uint64_t)row)) - archive->base);
+}
+
+extern "C" {
+
+    __declspec(dllexport) process_archive* process_archive_open(const char* path, int chunk_rows)
+    {
+        if (chunk_rows <= 0) chunk_rows = DEFAULT_CHUNK_ROWS;
+        if (path == nullptr || chunk_rows > MAX_CHUNK_ROWS) {
+            return nullptr;
+        }
+
+        process_archive* ar = new_archive();
+        if (ar == nullptr) return nullptr;
+
+        ar->writable = true;
+        if (!ar->file.open(path, true, true)) {
+            delete ar;
+            return nullptr;
+        }
+
+        bool ok = (ar->file.size() == 0) ? create_file(ar, chunk_rows) : (map_all(ar) && valid_header(ar));
+        if (!ok) {
+            free_archive(ar);
+            return nullptr;
+        }
+        return ar;
+    }
+
+    __declspec(dllexport) process_archive* process_archive_open_read(const char* path)
+    {
+        if (path == nullptr) {
+            return nullptr;
+        }
+
+        process_archive* ar = new_archive();
+        if (ar == nullptr) return nullptr;
+
+        if (!ar->file.open(path, false, false) || !map_all(ar) || !valid_header(ar)) {
+            free_archive(ar);
+            return nullptr;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return ar;
+    }
+
+    __declspec(dllexport) void process_archive_close(process_archive* archive)
+    {
+        if (archive == nullptr) return;
+
+        if (archive->writable) {
+            process_archive_flush(archive);
+        }
+        free_archive(archive);
+    }
+
+    __declspec(dllexport) int64_t process_archive_append(process_archive* archive, const struct input* in,
+                                                         const struct output* out, int zone, int sequence,
+                                                         int judgment, int64_t start_ms, int64_t end_ms)
+    {
+        if (archive == nullptr || !archive->writable || archive->base == nullptr || out == nullptr) {
+            return -1;
+        }
+
+        const uint64_t row = archive->rows_atomic()->load(std::memory_order_relaxed);
+        const uint32_t r = archive->header()->chunk_rows;
+        const uint64_t c = row / r;
+        const uint32_t i = (uint32_t)(row % r);
+        if (!ensure_chunk(archive, c)) {
+            return -1;
+        }
+
+        archive_row* info = archive->row_info(row);
+        std::memset(info, 0, sizeof(archive_row));
+        copy_id(info->CELL_ID, in != nullptr ? in->CELL_ID : nullptr);
+        copy_id(info->INNER_ID, in != nullptr ? in->INNER_ID : nullptr);
+        info->start_ms = start_ms;
+        info->end_ms = end_ms;
+        info->zone = zone;
+        info->judgment = judgment;
+        info->total_point = in != nullptr ? in->total_point : 0;
+        info->cur_point = in != nullptr ? in->cur_point : 0;
+        info->sequence = sequence;
+
+        // pattern 196개 × 항목 8개를 각 열의 i번째 자리로 분산
+        const uint32_t* src = reinterpret_cast<const uint32_t*>(&out->data[0][0]);
+        uint32_t* col0 = archive->column(c, 0);
+        for (int col = 0; col < COLUMNS; ++col) {
+            col0[(size_t)col * r + i] = src[col];
+        }
+
+        archive->rows_atomic()->store(row + 1, std::memory_order_release);
+        return (int64_t)row;
+    }
+
+    __declspec(dllexport) bool process_archive_flush(process_archive* archive)
+    {
+        if (archive == nullptr || !archive->writable) {
+            return false;
+        }
+        return archive->file.sync(archive->base, archive->mapped);
+    }
+
+    __declspec(dllexport) int64_t process_archive_refresh(process_archive* archive)
+    {
+        if (archive == nullptr) {
+            return -1;
+        }
+
+        // 새 크기로 매핑한 뒤 기존 매핑 해제 (실패 시 기존 매핑 유지)
+        const int64_t size = archive->file.size();
+        if (size > (int64_t)archive->mapped) {
+            uint8_t* base = (uint8_t*)archive->file.map(0, (size_t)size);
+            if (base == nullptr) {
+                return -1;
+            }
+            archive->file.unmap(archive->base, archive->mapped);
+            archive->base = base;
+            archive->mapped = (size_t)size;
+        }
+        return (int64_t)archive->visible_rows();
+    }
+
+    __declspec(dllexport) int64_t process_archive_rows(process_archive* archive)
+    {
+        return archive != nullptr ? (int64_t)archive->visible_rows() : -1;
+    }
+
+    __declspec(dllexport) int process_archive_chunk_rows(process_archive* archive)
+    {
+        return (archive != nullptr && archive->base != nullptr) ? (int)archive->header()->chunk_rows : -1;
+    }
+
+    __declspec(dllexport) int process_archive_column(int area, int wad, int index, int field)
+    {
+        if (wad < 0 || wad >= 7 || field < 0 || field >= FIELDS) {
+            return -1;
+        }
+
+        int p = -1;
+        if (area == ARCHIVE_AREA_DATA && index >= 0 && index < 17) p = wad * 17 + index;
+        else if (area == ARCHIVE_AREA_IPVS && index >= 0 && index < 10) p = IPVS_BASE + wad * 10 + index;
+        else if (area == ARCHIVE_AREA_MEASURE && index == 0) p = MEASURE_BASE + wad;
+
+        return (p < 0) ? -1 : p * FIELDS + field;
+    }
+
+    __declspec(dllexport) int process_archive_chunk(process_archive* archive, int64_t chunk, int column,
+                                                    const void** values)
+    {
+        if (archive == nullptr || archive->base == nullptr || column < 0 || column >= COLUMNS || chunk < 0 ||
+            values == nullptr) {
+            return -1;
+        }
+
+        const uint64_t rows = archive->visible_rows();
+        const uint32_t r = archive->header()->chunk_rows;
+        if ((uint64_t)chunk * r >= rows) {
+            return -1;
+        }
+
+        *values = archive->column((uint64_t)chunk, column);
+        const uint64_t left = rows - (uint64_t)chunk * r;
+        return (int)(left < r ? left : r);
+    }
+
+    __declspec(dllexport) int64_t process_archive_read_column(process_archive* archive, int column,
+                                                              int64_t first, int64_t count, void* dst)
+    {
+        if (archive == nullptr || archive->base == nullptr || column < 0 || column >= COLUMNS || first < 0 ||
+            count < 0 || dst == nullptr) {
+            return -1;
+        }
+
+        const uint64_t rows = archive->visible_rows();
+        const uint32_t r = archive->header()->chunk_rows;
+        uint64_t row = (uint64_t)first;
+        const uint64_t end = ((uint64_t)first + count < rows) ? (uint64_t)first + count : rows;
+
+        uint32_t* out = static_cast<uint32_t*>(dst);
+        while (row < end) {
+            const uint64_t c = row / r;
+            const uint32_t i = (uint32_t)(row % r);
+            const uint64_t n = (end - row < r - i) ? end - row : r - i;
+            std::memcpy(out, archive->column(c, column) + i, (size_t)n * 4);
+            out += n;
+            row += n;
+        }
+        return (row > (uint64_t)first) ? (int64_t)(row - first) : 0;
+    }
+
+    __declspec(dllexport) bool process_archive_read_row(process_archive* archive, int64_t row,
+                                                        struct archive_row* info, struct output* out)
+    {
+        if (archive == nullptr || row < 0 || (uint64_t)row >= archive->visible_rows()) {
+            return false;
+        }
+
+        if (info != nullptr) {
+            std::memcpy(info, archive->row_info((uint64_t)row), sizeof(archive_row));
+        }
+        if (out != nullptr) {
+            gather_output(archive, (uint64_t)row, out);
+        }
+        return true;
+    }
+
+    __declspec(dllexport) int64_t process_archive_export_csv(process_archive* archive, const char* path,
+                                                             int layout, int64_t first, int64_t count)
+    {
+        if (archive == nullptr || path == nullptr || first < 0 ||
+            (layout != ARCHIVE_CSV_MTP && layout != ARCHIVE_CSV_IPVS)) {
+            return -1;
+        }
+
+        FILE* fp = std::fopen(path, "wb");
+        if (fp == nullptr) {
+            return -1;
+        }
+        std::setvbuf(fp, nullptr, _IOFBF, 1 << 20);
+        std::fputs("\xEF\xBB\xBF", fp);     // UTF-8 BOM (C# Encoding.UTF8과 동일)
+        std::fputs(log_schema(layout == ARCHIVE_CSV_MTP ? LOG_LAYOUT_EECP : LOG_LAYOUT_IPVS_EECP, 1).c_str(), fp);
+        std::fputs("\r\n", fp);
+
+        const uint64_t rows = archive->visible_rows();
+        const uint64_t end = (count < 0 || (uint64_t)first + count > rows) ? rows : (uint64_t)first + count;
+
+        struct output out;
+        std::string line;
+        int64_t written = 0;
+        for (uint64_t row = (uint64_t)first; row < end; ++row) {
+            gather_output(archive, row, &out);
+            line.clear();
+            format_csv_row(&line, layout, *archive->row_info(row), out);
+            std::fwrite(line.data(), 1, line.size(), fp);
+            written++;
+        }
+
+        const bool ok = std::fclose(fp) == 0;
+        return ok ? written : -1;
+    }
+
+} // extern "C"
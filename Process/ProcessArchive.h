@@ -0,0 +1,162 @@
+#pragma once
+// ProcessArchive.h : 측정 결과 열 단위(columnar) 보관 파일 (추가 전용)
+// CSV 한 줄(수백 열)을 파싱하지 않고 필요한 열만 매핑된 메모리에서 바로 읽기 위한 저장소
+//
+// 파일 배치 (모든 오프셋은 64KB 정렬 - Windows 매핑 단위):
+//   [archive_header 64B ... 64KB][chunk 0][chunk 1]...       chunk k = 행 [k × chunk_rows, (k + 1) × chunk_rows)
+//   chunk = [archive_row × chunk_rows][열 0: 값 × chunk_rows][열 1]...[열 1567][정렬 패딩]
+// 열 = output의 pattern 196개(data 119 + IPVS_data 70 + measure 7) × 항목 8개 (x, y, u, v, L, cur, eff, result)
+//   열 번호 = pattern 순번 × 8 + 항목, 값은 4바이트 (result만 int32, 나머지 float)
+//   하루 생산분에서 한 열만 훑을 때 chunk마다 chunk_rows × 4바이트만 읽음 (나머지 열은 접근하지 않음)
+//
+// 발행 규약: 행 기록 완료 후 archive_header.rows 증가 (읽는 쪽은 rows 이전 행만 사용)
+//   같은 파일을 다른 프로세스가 읽기 전용으로 열어 process_archive_refresh로 새 행을 따라갈 수 있음
+//   쓰기 핸들은 한 스레드에서만 사용, process_archive_flush 호출 시 디스크 기록 보장
+// CSV(EECP 배치)는 process_archive_export_csv로 만드는 파생 보기
+
+#include "ProcessFunctions.h"
+#include <stdint.h>
+
+// 열 항목 (field)
+#define ARCHIVE_FIELD_X         0
+#define ARCHIVE_FIELD_Y         1
+#define ARCHIVE_FIELD_U         2
+#define ARCHIVE_FIELD_V         3
+#define ARCHIVE_FIELD_L         4
+#define ARCHIVE_FIELD_CUR       5
+#define ARCHIVE_FIELD_EFF       6
+#define ARCHIVE_FIELD_RESULT    7       // int32
+
+// output 영역 (area)
+#define ARCHIVE_AREA_DATA       0       // data[wad][0~16]
+#define ARCHIVE_AREA_IPVS       1       // IPVS_data[wad][0~9]
+#define ARCHIVE_AREA_MEASURE    2       // measure[wad] (index 0)
+
+// CSV 배치 (C# EECP 로거와 같은 열 순서)
+#define ARCHIVE_CSV_MTP         0       // OpticEECPLogger Normal: 패턴 × WAD × (X, Y, u, v, L, 전류, 효율)
+#define ARCHIVE_CSV_IPVS        1       // IPVSEECPLogger: 포인트 × WAD × (X, Y, L, 전류, 효율)
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 파일 헤더
+    struct archive_header {
+        uint32_t magic;         // 'OXAC' (0x4341584F)
+        uint32_t version;       // 배치 버전 (1)
+        uint32_t chunk_rows;    // chunk당 행 수
+        uint32_t columns;       // 열 수 (1568)
+        uint32_t row_size;      // sizeof(archive_row)
+        uint32_t output_size;   // sizeof(struct output)
+        uint64_t chunk_size;    // chunk 크기 (바이트, 64KB 배수)
+        uint64_t data_offset;   // 첫 chunk 오프셋 (바이트)
+        uint64_t rows;          // 기록 완료 행 수
+        int64_t created_ms;     // 파일 생성 시각 (Unix ms)
+        uint8_t reserved[8];
+    };
+
+    // 행 정보
+    struct archive_row {
+        char CELL_ID[256];
+        char INNER_ID[256];
+        int64_t start_ms;       // 측정 시작 / 종료 시각 (Unix ms)
+        int64_t end_ms;
+        int32_t zone;
+        int32_t judgment;       // 셀 판정 (0:OK, 1:NG, 2:PTN, -1:없음)
+        int32_t total_point;    // input.total_point / cur_point
+        int32_t cur_point;
+        int32_t sequence;       // HVI SEQUENCE 등 호출 측 순번 (-1: 없음)
+        uint8_t reserved[28];
+    };
+
+    typedef struct process_archive process_archive;
+
+    // ===== 보관 파일 열기/닫기 (26.10.16) =====
+
+    /// <summary>
+    /// 쓰기용 열기 - 없으면 생성(chunk_rows <= 0: 256), 있으면 이어서 추가 (chunk_rows는 파일 값 사용)
+    /// 실패 시 nullptr (다른 형식의 파일 등)
+    /// </summary>
+    __declspec(dllexport) process_archive* process_archive_open(const char* path, int chunk_rows);
+
+    /// <summary>
+    /// 읽기 전용 열기 - 열 당시까지 기록된 행을 매핑 (실패 시 nullptr)
+    /// </summary>
+    __declspec(dllexport) process_archive* process_archive_open_read(const char* path);
+
+    /// <summary>
+    /// 닫기 (쓰기 핸들이면 flush 후 닫음)
+    /// </summary>
+    __declspec(dllexport) void process_archive_close(process_archive* archive);
+
+    // ===== 기록 =====
+
+    /// <summary>
+    /// 셀 결과 1행 추가 - 추가된 행 번호 반환 (실패: -1)
+    /// in은 nullptr 허용 (ID / 포인트 비움)
+    /// </summary>
+    __declspec(dllexport) int64_t process_archive_append(process_archive* archive, const struct input* in,
+                                                         const struct output* out, int zone, int sequence,
+                                                         int judgment, int64_t start_ms, int64_t end_ms);
+
+    /// <summary>
+    /// 기록된 행을 디스크에 기록 (로트 종료 등)
+    /// </summary>
+    __declspec(dllexport) bool process_archive_flush(process_archive* archive);
+
+    // ===== 읽기 =====
+
+    /// <summary>
+    /// 다른 핸들이 추가한 행 반영 (필요 시 다시 매핑) - 현재 행 수 반환 (실패: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_archive_refresh(process_archive* archive);
+
+    /// <summary>
+    /// 현재 행 수 / chunk당 행 수 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_archive_rows(process_archive* archive);
+    __declspec(dllexport) int process_archive_chunk_rows(process_archive* archive);
+
+    /// <summary>
+    /// 열 번호 계산 (area: ARCHIVE_AREA_*, field: ARCHIVE_FIELD_*) - 범위 밖이면 -1
+    /// </summary>
+    __declspec(dllexport) int process_archive_column(int area, int wad, int index, int field);
+
+    /// <summary>
+    /// chunk 1개의 열 직접 참조 (복사 없음) - values에 열 시작 주소, chunk의 유효 행 수 반환 (범위 밖: -1)
+    /// 포인터는 다음 refresh / close 전까지 유효
+    /// </summary>
+    __declspec(dllexport) int process_archive_chunk(process_archive* archive, int64_t chunk, int column,
+                                                    const void** values);
+
+    /// <summary>
+    /// 열의 [first, first + count) 행을 dst(4바이트 × count)에 복사 - 복사한 행 수 반환 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_archive_read_column(process_archive* archive, int column,
+                                                              int64_t first, int64_t count, void* dst);
+
+    /// <summary>
+    /// 행 1개 복원 (info / out 중 nullptr인 쪽은 생략, lut는 0) - 범위 밖이면 false
+    /// </summary>
+    __declspec(dllexport) bool process_archive_read_row(process_archive* archive, int64_t row,
+                                                        struct archive_row* info, struct output* out);
+
+    /// <summary>
+    /// [first, first + count) 행을 CSV로 내보내기 (layout: ARCHIVE_CSV_*, count < 0: 끝까지)
+    /// 기록한 행 수 반환 (실패: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_archive_export_csv(process_archive* archive, const char* path,
+                                                             int layout, int64_t first, int64_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+// 행 정보의 파일 내 바이트 오프셋 (범위 밖: -1) - 색인 위치 기록용
+int64_t archive_row_offset(process_archive* archive, int64_t row);
+#endif
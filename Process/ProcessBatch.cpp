@@ -0,0 +1,173 @@
+// ProcessBatch.cpp : 배치 테스트 함수 구현
+
+#include "pch.h"
+#include "ProcessBatch.h"
+#include "ProcessContext.h"
+#include "ProcessThreadPool.h"
+#include "ProcessUniformity.h"
+#include <atomic>
+#include <vector>
+
+namespace {
+
+    typedef int (*cell_test_fn)(process_context*, const struct input*, struct output*);
+    // 성공한 셀마다 호출 컨텍스트에서 입력 순서대로 실행하는 후처리 (nullptr: 없음)
+    typedef void (*cell_post_fn)(process_context*, const struct input*, const struct output*);
+
+    // IPVS_test_ctx와 같은 균일도 갱신 (균일도 상태는 호출 컨텍스트에만 누적)
+    void ipvs_uniformity(process_context* ctx, const struct input* in, const struct output* out)
+    {
+        uniformity_update(ctx, in, out);
+    }
+
+    // 조각(slot)별 작업 컨텍스트 준비 - slot 0은 호출 컨텍스트 자신을 사용
+    bool prepare_workers(process_context* ctx, int slots)
+    {
+        while ((int)ctx->batch_workers.size() < slots - 1) {
+            process_context* worker = process_create_context(ctx->zone);
+            if (worker == nullptr) {
+                return false;
+            }
+            ctx->batch_workers.emplace_back(worker);
+        }
+
+        // 작업 컨텍스트도 호출 컨텍스트와 같은 스펙으로 판정
+        for (auto& worker : ctx->batch_workers) {
+            worker->judge = ctx->judge;
+        }
+        return true;
+    }
+
+    // 셀 1개 처리 - masks가 있으면 이 셀이 기록한 영역만 masks[i]에 따로 받고 컨텍스트 누적에도 합침
+    int run_cell(process_context* ctx, cell_test_fn fn, const struct input* in, struct output* out,
+                 struct output_dirty* mask)
+    {
+        if (mask == nullptr) {
+            return fn(ctx, in, out);
+        }
+
+        const output_dirty before = ctx->dirty;
+        ctx->dirty = output_dirty();
+        int result = fn(ctx, in, out);
+        *mask = ctx->dirty;
+        merge_dirty(&ctx->dirty, &before);
+        return result;
+    }
+
+    int run_batch(process_context* ctx, cell_test_fn fn, cell_post_fn post, const struct input* ins,
+                  struct output* outs, int n, int* status, int threads, struct output_dirty* masks = nullptr)
+    {
+        if (ctx == nullptr || ins == nullptr || outs == nullptr || n <= 0) {
+            return 0;
+        }
+
+        if (threads <= 1) {
+            int ok = 0;
+            for (int i = 0; i < n; ++i) {
+                int result = run_cell(ctx, fn, &ins[i], &outs[i], masks != nullptr ? &masks[i] : nullptr);
+                if (status != nullptr) status[i] = result;
+                if (result == 1) {
+                    if (post != nullptr) post(ctx, &ins[i], &outs[i]);
+                    ok++;
+                }
+            }
+            return ok;
+        }
+
+        // 후처리가 있으면 셀별 결과 보관 (status가 nullptr일 수 있음)
+        std::vector<int> results;
+        int* codes = status;
+        if (post != nullptr && codes == nullptr) {
+            results.resize(n);
+            codes = results.data();
+        }
+
+        std::shared_ptr<process_thread_pool> pool = process_shared_pool();  // 배치가 끝날 때까지 풀 유지
+        int slots = threads < pool->size() + 1 ? threads : pool->size() + 1;
+        if (!prepare_workers(ctx, slots)) {
+            slots = (int)ctx->batch_workers.size() + 1;
+        }
+
+        std::atomic<int> ok(0);
+        pool->parallel_for(n, slots, [&](int begin, int end, int slot) {
+            process_context* worker = (slot == 0) ? ctx : ctx->batch_workers[slot - 1].get();
+            int local_ok = 0;
+            for (int i = begin; i < end; ++i) {
+                int result = run_cell(worker, fn, &ins[i], &outs[i], masks != nullptr ? &masks[i] : nullptr);
+                if (codes != nullptr) codes[i] = result;
+                if (result == 1) local_ok++;
+            }
+            ok += local_ok;
+        });
+
+        //26.10.16 - 측정은 병렬, 후처리는 호출 컨텍스트에서 입력 순서대로 (순차 처리와 같은 결과)
+        if (post != nullptr) {
+            for (int i = 0; i < n; ++i) {
+                if (codes[i] == 1) post(ctx, &ins[i], &outs[i]);
+            }
+        }
+
+        // 작업 컨텍스트에 기록된 변경 영역을 호출 컨텍스트로 합침
+        for (auto& worker : ctx->batch_workers) {
+            merge_dirty(&ctx->dirty, &worker->dirty);
+            worker->dirty = output_dirty();
+        }
+        return ok.load();
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) int MTP_test_batch(const struct input* ins, struct output* outs, int n, int* status)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return run_batch(process_default_context(), MTP_test_ctx, nullptr, ins, outs, n, status, 1);
+    }
+
+    __declspec(dllexport) int IPVS_test_batch(const struct input* ins, struct output* outs, int n, int* status)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return run_batch(process_default_context(), ipvs_test_point, ipvs_uniformity, ins, outs, n, status, 1);
+    }
+
+    __declspec(dllexport) int MTP_test_batch_ctx(process_context* ctx, const struct input* ins,
+                                                 struct output* outs, int n, int* status, int threads)
+    {
+        return run_batch(ctx, MTP_test_ctx, nullptr, ins, outs, n, status, threads);
+    }
+
+    __declspec(dllexport) int IPVS_test_batch_ctx(process_context* ctx, const struct input* ins,
+                                                  struct output* outs, int n, int* status, int threads)
+    {
+        return run_batch(ctx, ipvs_test_point, ipvs_uniformity, ins, outs, n, status, threads);
+    }
+
+    __declspec(dllexport) int MTP_test_batch_dirty(const struct input* ins, struct output* outs, int n, int* status,
+                                                   struct output_dirty* masks)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return run_batch(process_default_context(), MTP_test_ctx, nullptr, ins, outs, n, status, 1, masks);
+    }
+
+    __declspec(dllexport) int IPVS_test_batch_dirty(const struct input* ins, struct output* outs, int n, int* status,
+                                                    struct output_dirty* masks)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return run_batch(process_default_context(), ipvs_test_point, ipvs_uniformity, ins, outs, n, status, 1, masks);
+    }
+
+    __declspec(dllexport) int MTP_test_batch_dirty_ctx(process_context* ctx, const struct input* ins,
+                                                       struct output* outs, int n, int* status, int threads,
+                                                       struct output_dirty* masks)
+    {
+        return run_batch(ctx, MTP_test_ctx, nullptr, ins, outs, n, status, threads, masks);
+    }
+
+    __declspec(dllexport) int IPVS_test_batch_dirty_ctx(process_context* ctx, const struct input* ins,
+                                                        struct output* outs, int n, int* status, int threads,
+                                                        struct output_dirty* masks)
+    {
+        return run_batch(ctx, ipvs_test_point, ipvs_uniformity, ins, outs, n, status, threads, masks);
+    }
+
+} // extern "C"
@@ -0,0 +1,74 @@
+#pragma once
+// ProcessBatch.h : 여러 셀을 한 번의 DLL 호출로 처리하는 배치 함수 선언
+// P/Invoke 1회 + 마샬링 1회로 트레이 전체 재검사/시뮬레이션을 처리하기 위함
+
+#include "ProcessFunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // ===== 배치 테스트 함수 (26.10.16) =====
+    // ins/outs : 연속된 n개 셀 배열 (ins[i] → outs[i])
+    // status   : 셀별 결과 코드 (단일 MTP_test/IPVS_test 반환값과 동일, nullptr 허용)
+    // 반환값   : 성공(결과 코드 1)한 셀 수
+
+    /// <summary>
+    /// 기본 컨텍스트로 n개 셀 MTP 테스트 (순차 처리)
+    /// </summary>
+    __declspec(dllexport) int MTP_test_batch(const struct input* ins, struct output* outs, int n, int* status);
+
+    /// <summary>
+    /// 기본 컨텍스트로 n개 셀 IPVS 테스트 (순차 처리, 셀별 ins[i].cur_point 사용)
+    /// </summary>
+    __declspec(dllexport) int IPVS_test_batch(const struct input* ins, struct output* outs, int n, int* status);
+
+    /// <summary>
+    /// 지정 컨텍스트로 n개 셀 MTP 테스트
+    /// threads > 1 이면 공용 스레드 풀로 분산 처리 (조각별 작업 컨텍스트 사용)
+    /// </summary>
+    __declspec(dllexport) int MTP_test_batch_ctx(process_context* ctx, const struct input* ins,
+                                                 struct output* outs, int n, int* status, int threads);
+
+    /// <summary>
+    /// 지정 컨텍스트로 n개 셀 IPVS 테스트
+    /// threads > 1 이면 공용 스레드 풀로 분산 처리 (조각별 작업 컨텍스트 사용)
+    /// 포인트 균일도는 IPVS_test_ctx와 같이 호출 컨텍스트에 CELL_ID별로 입력 순서대로 갱신
+    /// </summary>
+    __declspec(dllexport) int IPVS_test_batch_ctx(process_context* ctx, const struct input* ins,
+                                                  struct output* outs, int n, int* status, int threads);
+
+    // ===== 셀별 변경 영역 반환 (26.10.16) =====
+    // masks : n개 배열 - masks[i]에 outs[i]에 기록한 영역만 반환 (다른 셀 / 다른 Zone의 기록은 섞이지 않음)
+    // 컨텍스트 누적 영역(process_take_dirty)에도 기존과 같이 합쳐짐
+    // 기본 컨텍스트를 여러 Zone이 함께 쓸 때는 이 함수의 masks를 사용 (n = 1이면 단일 셀 호출과 같음)
+
+    /// <summary>
+    /// MTP_test_batch + 셀별 변경 영역
+    /// </summary>
+    __declspec(dllexport) int MTP_test_batch_dirty(const struct input* ins, struct output* outs, int n, int* status,
+                                                   struct output_dirty* masks);
+
+    /// <summary>
+    /// IPVS_test_batch + 셀별 변경 영역
+    /// </summary>
+    __declspec(dllexport) int IPVS_test_batch_dirty(const struct input* ins, struct output* outs, int n, int* status,
+                                                    struct output_dirty* masks);
+
+    /// <summary>
+    /// MTP_test_batch_ctx + 셀별 변경 영역
+    /// </summary>
+    __declspec(dllexport) int MTP_test_batch_dirty_ctx(process_context* ctx, const struct input* ins,
+                                                       struct output* outs, int n, int* status, int threads,
+                                                       struct output_dirty* masks);
+
+    /// <summary>
+    /// IPVS_test_batch_ctx + 셀별 변경 영역
+    /// </summary>
+    __declspec(dllexport) int IPVS_test_batch_dirty_ctx(process_context* ctx, const struct input* ins,
+                                                        struct output* outs, int n, int* status, int threads,
+                                                        struct output_dirty* masks);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,378 @@
+// ProcessColor.cpp : 색 변환 일괄 계산 구현
+// 세 경로(스칼라 / SSE2 / AVX2)의 식은 반드시 같은 연산 순서로 유지할 것 (비트 호환)
+
+#include "pch.h"
+#include "ProcessColor.h"
+#include "ProcessCpu.h"
+#include <cmath>
+
+namespace {
+
+    const int RT_COUNT = 31;
+
+    // Robertson 등온선 표 (역색온도 mired, CIE 1960 u, v, 기울기 t)
+    const float RT_MIRED[RT_COUNT] = {
+        0.0f, 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f, 70.0f, 80.0f, 90.0f, 100.0f,
+        125.0f, 150.0f, 175.0f, 200.0f, 225.0f, 250.0f, 275.0f, 300.0f, 325.0f, 350.0f,
+        375.0f, 400.0f, 425.0f, 450.0f, 475.0f, 500.0f, 525.0f, 550.0f, 575.0f, 600.0f
+    };
+    const float RT_U[RT_COUNT] = {
+        0.18006f, 0.18066f, 0.18133f, 0.18208f, 0.18293f, 0.18388f, 0.18494f, 0.18611f,
+        0.18740f, 0.18880f, 0.19032f, 0.19462f, 0.19962f, 0.20525f, 0.21142f, 0.21807f,
+        0.22511f, 0.23247f, 0.24010f, 0.24792f, 0.25591f, 0.26400f, 0.27218f, 0.28039f,
+        0.28863f, 0.29685f, 0.30505f, 0.31320f, 0.32129f, 0.32931f, 0.33724f
+    };
+    const float RT_V[RT_COUNT] = {
+        0.26352f, 0.26589f, 0.26846f, 0.27119f, 0.27407f, 0.27709f, 0.28021f, 0.28342f,
+        0.28668f, 0.28997f, 0.29326f, 0.30141f, 0.30921f, 0.31647f, 0.32312f, 0.32909f,
+        0.33439f, 0.33904f, 0.34308f, 0.34655f, 0.34951f, 0.35200f, 0.35407f, 0.35577f,
+        0.35714f, 0.35823f, 0.35907f, 0.35968f, 0.36011f, 0.36038f, 0.36051f
+    };
+    const float RT_T[RT_COUNT] = {
+        -0.24341f, -0.25479f, -0.26876f, -0.28539f, -0.30470f, -0.32675f, -0.35156f,
+        -0.37915f, -0.40955f, -0.44278f, -0.47888f, -0.58204f, -0.70471f, -0.84901f,
+        -1.0182f, -1.2168f, -1.4512f, -1.7298f, -2.0637f, -2.4681f, -2.9641f, -3.5814f,
+        -4.3633f, -5.3762f, -6.7262f, -8.5955f, -11.324f, -15.628f, -23.325f, -40.770f,
+        -116.45f
+    };
+
+    // 파생 표 (모든 경로가 같은 값을 사용하도록 한 번만 계산)
+    struct robertson_table {
+        float norm[RT_COUNT];       // sqrt(1 + t²)
+        float d_mired[RT_COUNT];    // mired[i] - mired[i-1]
+        float d_u[RT_COUNT];
+        float d_v[RT_COUNT];
+
+        robertson_table()
+        {
+            for (int i = 0; i < RT_COUNT; ++i) {
+                norm[i] = std::sqrt(1.0f + RT_T[i] * RT_T[i]);
+                d_mired[i] = (i > 0) ? RT_MIRED[i] - RT_MIRED[i - 1] : 0.0f;
+                d_u[i] = (i > 0) ? RT_U[i] - RT_U[i - 1] : 0.0f;
+                d_v[i] = (i > 0) ? RT_V[i] - RT_V[i - 1] : 0.0f;
+            }
+        }
+    };
+
+    const robertson_table& rt()
+    {
+        static const robertson_table s_table;
+        return s_table;
+    }
+
+    // 변환 결과 1개 (경로 공통 기록 형식)
+    struct color_lane {
+        float u, v, X, Z, mccamy, cct, duv;
+    };
+
+    void store_lane(struct pattern* p, struct color_ext* e, const color_lane& c, int flags)
+    {
+        if (flags & COLOR_UV) {
+            p->u = c.u;
+            p->v = c.v;
+        }
+        if (e == nullptr) return;
+
+        if (flags & COLOR_XYZ) {
+            e->X = c.X;
+            e->Y = p->L;
+            e->Z = c.Z;
+        }
+        if (flags & COLOR_CCT_ROBERTSON) e->cct = c.cct;
+        else if (flags & COLOR_CCT_MCCAMY) e->cct = c.mccamy;
+        if (flags & COLOR_DUV) e->duv = c.duv;
+    }
+
+    // ===== 스칼라 =====
+
+    void convert_scalar(struct pattern* p, struct color_ext* e, int flags)
+    {
+        const float x = p->x, y = p->y, L = p->L;
+        color_lane c;
+
+        const float den = -2.0f * x + 12.0f * y + 3.0f;
+        c.u = (4.0f * x) / den;
+        c.v = (9.0f * y) / den;
+
+        c.X = x / y * L;
+        c.Z = (1.0f - x - y) / y * L;
+
+        const float n = (x - 0.3320f) / (0.1858f - y);
+        c.mccamy = ((449.0f * n + 3525.0f) * n + 6823.3f) * n + 5520.33f;
+
+        c.cct = 0.0f;
+        c.duv = 0.0f;
+        if (flags & (COLOR_CCT_ROBERTSON | COLOR_DUV)) {
+            const robertson_table& t = rt();
+            const float v60 = (6.0f * y) / den;
+
+            float dm = 0.0f;
+            for (int i = 0; i < RT_COUNT; ++i) {
+                const float di = (v60 - RT_V[i]) - RT_T[i] * (c.u - RT_U[i]);
+                if (i > 0 && ((di < 0.0f) != (dm < 0.0f))) {
+                    const float dmn = dm / t.norm[i - 1];
+                    const float din = di / t.norm[i];
+                    const float f = dmn / (dmn - din);
+                    c.cct = 1000000.0f / (RT_MIRED[i - 1] + f * t.d_mired[i]);
+
+                    const float du = c.u - (RT_U[i - 1] + f * t.d_u[i]);
+                    const float dv = v60 - (RT_V[i - 1] + f * t.d_v[i]);
+                    const float d = std::sqrt(du * du + dv * dv);
+                    c.duv = (dv < 0.0f) ? -d : d;
+                    break;
+                }
+                dm = di;
+            }
+        }
+
+        store_lane(p, e, c, flags);
+    }
+
+    // ===== SSE2 (4개) =====
+
+#if defined(PROCESS_CPU_SSE2)
+    inline __m128 select_ps(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    int convert_sse2(struct pattern* p, struct color_ext* e, int n, int flags)
+    {
+        const robertson_table& t = rt();
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 sign = _mm_set1_ps(-0.0f);
+
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const float* src = reinterpret_cast<const float*>(p + i);
+            __m128 r0 = _mm_loadu_ps(src + 0), r1 = _mm_loadu_ps(src + 8);
+            __m128 r2 = _mm_loadu_ps(src + 16), r3 = _mm_loadu_ps(src + 24);
+            __m128 h0 = _mm_loadu_ps(src + 4), h1 = _mm_loadu_ps(src + 12);
+            __m128 h2 = _mm_loadu_ps(src + 20), h3 = _mm_loadu_ps(src + 28);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);      // x, y, u, v
+            _MM_TRANSPOSE4_PS(h0, h1, h2, h3);      // L, cur, eff, result
+            const __m128 x = r0, y = r1, L = h0;
+
+            const __m128 den = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), x),
+                                                     _mm_mul_ps(_mm_set1_ps(12.0f), y)), _mm_set1_ps(3.0f));
+            const __m128 u = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(4.0f), x), den);
+            const __m128 v = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(9.0f), y), den);
+
+            const __m128 X = _mm_mul_ps(_mm_div_ps(x, y), L);
+            const __m128 Z = _mm_mul_ps(_mm_div_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x), y), y), L);
+
+            const __m128 nn = _mm_div_ps(_mm_sub_ps(x, _mm_set1_ps(0.3320f)), _mm_sub_ps(_mm_set1_ps(0.1858f), y));
+            __m128 mc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(449.0f), nn), _mm_set1_ps(3525.0f));
+            mc = _mm_add_ps(_mm_mul_ps(mc, nn), _mm_set1_ps(6823.3f));
+            mc = _mm_add_ps(_mm_mul_ps(mc, nn), _mm_set1_ps(5520.33f));
+
+            __m128 cct = zero, duv = zero;
+            if (flags & (COLOR_CCT_ROBERTSON | COLOR_DUV)) {
+                const __m128 v60 = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(6.0f), y), den);
+
+                // 부호가 처음 바뀌는 등온선의 값 기록 (레인별)
+                __m128 found = zero, dm = zero;
+                __m128 r_dm = zero, r_di = zero, r_np = zero, r_n = zero;
+                __m128 r_m = zero, r_dmr = zero, r_u = zero, r_du = zero, r_v = zero, r_dv = zero;
+                for (int k = 0; k < RT_COUNT; ++k) {
+                    const __m128 di = _mm_sub_ps(_mm_sub_ps(v60, _mm_set1_ps(RT_V[k])),
+                                                 _mm_mul_ps(_mm_set1_ps(RT_T[k]), _mm_sub_ps(u, _mm_set1_ps(RT_U[k]))));
+                    if (k > 0) {
+                        const __m128 cross = _mm_xor_ps(_mm_cmplt_ps(di, zero), _mm_cmplt_ps(dm, zero));
+                        const __m128 hit = _mm_andnot_ps(found, cross);
+                        if (_mm_movemask_ps(hit)) {
+                            r_dm = select_ps(hit, dm, r_dm);
+                            r_di = select_ps(hit, di, r_di);
+                            r_np = select_ps(hit, _mm_set1_ps(t.norm[k - 1]), r_np);
+                            r_n = select_ps(hit, _mm_set1_ps(t.norm[k]), r_n);
+                            r_m = select_ps(hit, _mm_set1_ps(RT_MIRED[k - 1]), r_m);
+                            r_dmr = select_ps(hit, _mm_set1_ps(t.d_mired[k]), r_dmr);
+                            r_u = select_ps(hit, _mm_set1_ps(RT_U[k - 1]), r_u);
+                            r_du = select_ps(hit, _mm_set1_ps(t.d_u[k]), r_du);
+                            r_v = select_ps(hit, _mm_set1_ps(RT_V[k - 1]), r_v);
+                            r_dv = select_ps(hit, _mm_set1_ps(t.d_v[k]), r_dv);
+                            found = _mm_or_ps(found, hit);
+                            if (_mm_movemask_ps(found) == 0xF) break;
+                        }
+                    }
+                    dm = di;
+                }
+
+                const __m128 dmn = _mm_div_ps(r_dm, r_np);
+                const __m128 din = _mm_div_ps(r_di, r_n);
+                const __m128 f = _mm_div_ps(dmn, _mm_sub_ps(dmn, din));
+                cct = _mm_div_ps(_mm_set1_ps(1000000.0f), _mm_add_ps(r_m, _mm_mul_ps(f, r_dmr)));
+
+                const __m128 du = _mm_sub_ps(u, _mm_add_ps(r_u, _mm_mul_ps(f, r_du)));
+                const __m128 dv = _mm_sub_ps(v60, _mm_add_ps(r_v, _mm_mul_ps(f, r_dv)));
+                const __m128 d = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(du, du), _mm_mul_ps(dv, dv)));
+                duv = select_ps(_mm_cmplt_ps(dv, zero), _mm_xor_ps(d, sign), d);
+
+                cct = _mm_and_ps(found, cct);
+                duv = _mm_and_ps(found, duv);
+            }
+
+            float tu[4], tv[4], tX[4], tZ[4], tmc[4], tcct[4], tduv[4];
+            _mm_storeu_ps(tu, u);
+            _mm_storeu_ps(tv, v);
+            _mm_storeu_ps(tX, X);
+            _mm_storeu_ps(tZ, Z);
+            _mm_storeu_ps(tmc, mc);
+            _mm_storeu_ps(tcct, cct);
+            _mm_storeu_ps(tduv, duv);
+            for (int k = 0; k < 4; ++k) {
+                const color_lane c = { tu[k], tv[k], tX[k], tZ[k], tmc[k], tcct[k], tduv[k] };
+                store_lane(p + i + k, e ? e + i + k : nullptr, c, flags);
+            }
+        }
+        return i;
+    }
+#endif
+
+    // ===== AVX2 (8개) =====
+
+#if defined(PROCESS_CPU_AVX2)
+    PROCESS_TARGET_AVX2
+    int convert_avx2(struct pattern* p, struct color_ext* e, int n, int flags)
+    {
+        const robertson_table& t = rt();
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 sign = _mm256_set1_ps(-0.0f);
+
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 fld[8];
+            transpose8_ps(reinterpret_cast<const float*>(p + i), fld);
+            const __m256 x = fld[0], y = fld[1], L = fld[4];
+
+            const __m256 den = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), x),
+                                                           _mm256_mul_ps(_mm256_set1_ps(12.0f), y)),
+                                             _mm256_set1_ps(3.0f));
+            const __m256 u = _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), x), den);
+            const __m256 v = _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(9.0f), y), den);
+
+            const __m256 X = _mm256_mul_ps(_mm256_div_ps(x, y), L);
+            const __m256 Z = _mm256_mul_ps(_mm256_div_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), x), y), y), L);
+
+            const __m256 nn = _mm256_div_ps(_mm256_sub_ps(x, _mm256_set1_ps(0.3320f)),
+                                            _mm256_sub_ps(_mm256_set1_ps(0.1858f), y));
+            __m256 mc = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(449.0f), nn), _mm256_set1_ps(3525.0f));
+            mc = _mm256_add_ps(_mm256_mul_ps(mc, nn), _mm256_set1_ps(6823.3f));
+            mc = _mm256_add_ps(_mm256_mul_ps(mc, nn), _mm256_set1_ps(5520.33f));
+
+            __m256 cct = zero, duv = zero;
+            if (flags & (COLOR_CCT_ROBERTSON | COLOR_DUV)) {
+                const __m256 v60 = _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(6.0f), y), den);
+
+                __m256 found = zero, dm = zero;
+                __m256 r_dm = zero, r_di = zero, r_np = zero, r_n = zero;
+                __m256 r_m = zero, r_dmr = zero, r_u = zero, r_du = zero, r_v = zero, r_dv = zero;
+                for (int k = 0; k < RT_COUNT; ++k) {
+                    const __m256 di = _mm256_sub_ps(_mm256_sub_ps(v60, _mm256_set1_ps(RT_V[k])),
+                                                    _mm256_mul_ps(_mm256_set1_ps(RT_T[k]),
+                                                                  _mm256_sub_ps(u, _mm256_set1_ps(RT_U[k]))));
+                    if (k > 0) {
+                        const __m256 cross = _mm256_xor_ps(_mm256_cmp_ps(di, zero, _CMP_LT_OQ),
+                                                           _mm256_cmp_ps(dm, zero, _CMP_LT_OQ));
+                        const __m256 hit = _mm256_andnot_ps(found, cross);
+                        if (_mm256_movemask_ps(hit)) {
+                            r_dm = _mm256_blendv_ps(r_dm, dm, hit);
+                            r_di = _mm256_blendv_ps(r_di, di, hit);
+                            r_np = _mm256_blendv_ps(r_np, _mm256_set1_ps(t.norm[k - 1]), hit);
+                            r_n = _mm256_blendv_ps(r_n, _mm256_set1_ps(t.norm[k]), hit);
+                            r_m = _mm256_blendv_ps(r_m, _mm256_set1_ps(RT_MIRED[k - 1]), hit);
+                            r_dmr = _mm256_blendv_ps(r_dmr, _mm256_set1_ps(t.d_mired[k]), hit);
+                            r_u = _mm256_blendv_ps(r_u, _mm256_set1_ps(RT_U[k - 1]), hit);
+                            r_du = _mm256_blendv_ps(r_du, _mm256_set1_ps(t.d_u[k]), hit);
+                            r_v = _mm256_blendv_ps(r_v, _mm256_set1_ps(RT_V[k - 1]), hit);
+                            r_dv = _mm256_blendv_ps(r_dv, _mm256_set1_ps(t.d_v[k]), hit);
+                            found = _mm256_or_ps(found, hit);
+                            if (_mm256_movemask_ps(found) == 0xFF) break;
+                        }
+                    }
+                    dm = di;
+                }
+
+                const __m256 dmn = _mm256_div_ps(r_dm, r_np);
+                const __m256 din = _mm256_div_ps(r_di, r_n);
+                const __m256 f = _mm256_div_ps(dmn, _mm256_sub_ps(dmn, din));
+                cct = _mm256_div_ps(_mm256_set1_ps(1000000.0f), _mm256_add_ps(r_m, _mm256_mul_ps(f, r_dmr)));
+
+                const __m256 du = _mm256_sub_ps(u, _mm256_add_ps(r_u, _mm256_mul_ps(f, r_du)));
+                const __m256 dv = _mm256_sub_ps(v60, _mm256_add_ps(r_v, _mm256_mul_ps(f, r_dv)));
+                const __m256 d = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(du, du), _mm256_mul_ps(dv, dv)));
+                duv = _mm256_blendv_ps(d, _mm256_xor_ps(d, sign), _mm256_cmp_ps(dv, zero, _CMP_LT_OQ));
+
+                cct = _mm256_and_ps(found, cct);
+                duv = _mm256_and_ps(found, duv);
+            }
+
+            float tu[8], tv[8], tX[8], tZ[8], tmc[8], tcct[8], tduv[8];
+            _mm256_storeu_ps(tu, u);
+            _mm256_storeu_ps(tv, v);
+            _mm256_storeu_ps(tX, X);
+            _mm256_storeu_ps(tZ, Z);
+            _mm256_storeu_ps(tmc, mc);
+            _mm256_storeu_ps(tcct, cct);
+            _mm256_storeu_ps(tduv, duv);
+            for (int k = 0; k < 8; ++k) {
+                const color_lane c = { tu[k], tv[k], tX[k], tZ[k], tmc[k], tcct[k], tduv[k] };
+                store_lane(p + i + k, e ? e + i + k : nullptr, c, flags);
+            }
+        }
+        return i;
+    }
+#endif
+
+    void convert_range(struct pattern* p, struct color_ext* e, int n, int flags)
+    {
+        const int level = cpu_simd_level();
+        int i = 0;
+#if defined(PROCESS_CPU_AVX2)
+        if (level >= CPU_SIMD_AVX2) {
+            i = convert_avx2(p, e, n, flags);
+        }
+#endif
+#if defined(PROCESS_CPU_SSE2)
+        if (level >= CPU_SIMD_SSE2) {
+            i += convert_sse2(p + i, e ? e + i : nullptr, n - i, flags);
+        }
+#endif
+        (void)level;
+        for (; i < n; ++i) {
+            convert_scalar(p + i, e ? e + i : nullptr, flags);
+        }
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) int process_color_convert(struct pattern* p, int n, struct color_ext* ext, int flags)
+    {
+        if (p == nullptr || n < 0 || (ext == nullptr && (flags & ~COLOR_UV) != 0)) {
+            return -1;
+        }
+
+        convert_range(p, ext, n, flags);
+        return n;
+    }
+
+    __declspec(dllexport) int process_color_output(struct output* outs, int count, struct output_color* ext,
+                                                   int flags)
+    {
+        if (outs == nullptr || count < 0 || (ext == nullptr && (flags & ~COLOR_UV) != 0)) {
+            return -1;
+        }
+
+        // data / IPVS_data / measure는 output 안에서 연속 배치 (7×17 + 7×10 + 7 = 196개)
+        const int per_output = 7 * 17 + 7 * 10 + 7;
+        static_assert(sizeof(struct output_color) == per_output * sizeof(struct color_ext),
+                      "output_color must mirror output pattern layout");
+
+        for (int c = 0; c < count; ++c) {
+            convert_range(&outs[c].data[0][0], ext ? &ext[c].data[0][0] : nullptr, per_output, flags);
+        }
+        return count * per_output;
+    }
+
+} // extern "C"
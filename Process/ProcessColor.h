@@ -0,0 +1,60 @@
+#pragma once
+// ProcessColor.h : 색 변환 일괄 계산 (pattern 배열 / output 전체)
+//   u'v'  : u' = 4x / (-2x + 12y + 3),  v' = 9y / (-2x + 12y + 3)   - Getdata와 같은 식, pattern.u/v에 기록
+//   XYZ   : X = x / y × L,  Y = L,  Z = (1 - x - y) / y × L
+//   CCT   : McCamy  n = (x - 0.3320) / (0.1858 - y),  T = 449n³ + 3525n² + 6823.3n + 5520.33
+//           Robertson (1968) 등온선 31개 표 - CIE 1960 uv에서 부호가 바뀌는 등온선 사이 보간
+//   Duv   : Robertson 보간 흑체 궤적 점까지의 uv 거리 (궤적 위쪽(녹색) +, 아래쪽(적자색) -)
+// AVX2(8개) / SSE2(4개) / 스칼라 경로를 실행 시 선택 - 모든 경로가 같은 float 연산을 같은 순서로
+// 수행하므로 결과는 비트 단위로 같음 (FMA 미사용)
+// Robertson 범위(1667K 미만 등) 밖이면 CCT, Duv = 0
+
+#include "ProcessFunctions.h"
+
+// 계산 항목 (flags)
+#define COLOR_UV                0x01    // pattern.u, pattern.v
+#define COLOR_XYZ               0x02    // color_ext.X, Y, Z
+#define COLOR_CCT_MCCAMY        0x04    // color_ext.cct (McCamy)
+#define COLOR_CCT_ROBERTSON     0x08    // color_ext.cct (Robertson, McCamy보다 우선)
+#define COLOR_DUV               0x10    // color_ext.duv
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // pattern 부가 색 정보
+    struct color_ext {
+        float X, Y, Z;              // CIE 1931 XYZ
+        float cct;                  // 상관 색온도 (K)
+        float duv;                  // 흑체 궤적 거리
+    };
+
+    // struct output과 같은 배치의 부가 색 정보
+    struct output_color {
+        struct color_ext data[7][17];
+        struct color_ext IPVS_data[7][10];
+        struct color_ext measure[7];
+    };
+
+    // ===== 색 변환 (26.10.16) =====
+
+    /// <summary>
+    /// pattern n개 변환 - u'v'는 제자리 기록, 나머지는 ext[n]에 기록 (COLOR_UV만 지정하면 ext nullptr 허용)
+    /// 반환값: 변환한 pattern 수 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_color_convert(struct pattern* p, int n, struct color_ext* ext, int flags);
+
+    /// <summary>
+    /// output count개의 data / IPVS_data / measure 전체 변환 (ext: output_color[count])
+    /// 반환값: 변환한 pattern 수 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_color_output(struct output* outs, int count, struct output_color* ext,
+                                                   int flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
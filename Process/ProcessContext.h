@@ -0,0 +1,122 @@
+#pragma once
+// ProcessContext.h : Zone별 엔진 컨텍스트 (DLL 내부 전용)
+// C#에는 불투명 포인터(IntPtr)로만 노출됨
+
+#include "ProcessTypes.h"
+#include "ProcessDevice.h"
+#include "ProcessHvi.h"
+#include "ProcessMeterCal.h"
+#include "ProcessUniformity.h"
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+struct judge_spec;
+
+// 26.10.16 - Zone별 엔진 상태 (전역 변수 대체)
+// 포트 상태, 난수 생성기, 작업 버퍼를 컨텍스트마다 소유하여
+// MTP_ZONE/IPVS_ZONE이 여러 개일 때 Zone 간 공유/경쟁이 없도록 함
+struct process_context {
+    int zone;                               // Zone 번호 (0: 기본 컨텍스트)
+
+    port_state ports;                       // 포트 연결 상태
+    bool mtp_initialized;                   // MTP 난수 시드 초기화 여부
+    bool ipvs_initialized;                  // IPVS 난수 시드 초기화 여부
+
+    std::mt19937 rng;                       // Zone 전용 난수 생성기 (rand() 대체)
+
+    int backend;                            // 장비 백엔드 (device_backend)
+    serial_config serial;                   // 시리얼 백엔드 설정
+    std::shared_ptr<sim_panel> panel;       // 시뮬레이터 패널 모델/지연 설정 (PG·측정기 공유)
+    std::unique_ptr<pg_device> pg;          // PG 장비
+    std::unique_ptr<meter_device> meter;    // 측정기 장비 (WAD 0)
+    std::unique_ptr<meter_device> wad_meters[7];    // WAD별 측정기 (인덱스 1~6, 0은 meter 사용)
+    int wad_ports[7];                       // WAD별 측정기 포트 (-1: 연결 안 됨, 0은 ports.meas_port 사용)
+    int pg_pattern;                         // 마지막으로 설정한 PG 패턴 (-1: 미설정)
+    meter_cal_state cal;                    // 측정기별 XYZ 보정 (포트 + WAD)
+
+    // 전압 목표 탐색용 Jacobian (정규화 XYZ / ln 전압, 인접 계조 목표에서 재사용)
+    double vt_jacobian[9];
+    bool vt_jacobian_valid;
+    int vt_last[3];                         // 마지막 수렴 전압 (다음 목표의 시작점)
+
+    std::shared_ptr<const judge_spec> judge;   // 스펙 판정 설정 (nullptr: 판정 대신 난수 결과, Zone 간 공유 가능)
+
+    std::vector<result_planes> hvi_planes[2];   // HVI 시퀀스별 결과 평면 [MTP, IPVS]
+    uniformity_state uni;                   // IPVS 포인트 균일도 (IPVS_test_ctx 호출마다 CELL_ID별로 갱신)
+
+    std::vector<LUT_Data> lut_points[3];    // 마지막 LUT 계조 스윕 원시 측정점 [RGB]
+
+    output_dirty dirty;                     // 마지막 process_take_dirty 이후 기록된 영역 (모든 output의 합집합)
+
+    // 배치 병렬 처리용 작업 컨텍스트 (스레드 조각별 1개, 필요 시 생성 후 재사용)
+    std::vector<std::unique_ptr<process_context>> batch_workers;
+};
+
+// 기존 export 함수들이 사용하는 기본 컨텍스트 (하위 호환)
+process_context* process_default_context();
+
+// 26.10.16 - 기본 컨텍스트 잠금: C# UI는 기존 export 함수를 Zone별 Task에서 동시에 호출하므로
+// 기본 컨텍스트 래퍼는 모두 이 잠금을 잡은 채 *_ctx 함수를 호출 (호출 단위 직렬화 - 기존 전역 상태와 같은 의미)
+std::mutex& process_default_lock();
+
+// 현재 백엔드로 PG/측정기 장비 생성 (기존 장비는 연결 해제 없이 교체됨)
+void create_devices(process_context* ctx);
+
+// WAD 인덱스 → 측정 각도 (C# WadAngle: 0, 30, 45, 60, 15, A, B - A/B는 0도로 취급)
+float wad_angle_deg(int wad);
+
+// WAD 인덱스의 측정기 (0: 기본 측정기, 범위 밖이면 nullptr)
+meter_device* wad_meter(process_context* ctx, int wad);
+
+// ===== 측정 단계 분리 (파이프라인 측정용) =====
+
+// 적분 단계 - 측정 트리거 후 적분 완료까지 대기 (이 동안 PG 패턴 유지 필요)
+bool meas_integrate(process_context* ctx);
+
+// 전송 + 후처리 단계 - 측정기 결과 수신 후 보정 + u', v' 계산
+// PG와 독립적이므로 다음 패턴의 PG 명령과 다른 스레드에서 병행 실행 가능
+bool meas_readout(const process_context* ctx, struct pattern* dst);
+
+// 지정 측정기의 전송 + 후처리 (WAD별 측정기 병행 수신용, cal: 측정기 보정 - nullptr 허용)
+bool meas_readout_from(meter_device* meter, struct pattern* dst, const meter_cal* cal = nullptr);
+
+// IPVS 포인트 1개 측정 (균일도 갱신 없음 - 배치 함수용, IPVS_test_ctx는 이후 균일도 갱신)
+int ipvs_test_point(process_context* ctx, const struct input* in, struct output* out);
+
+// 시뮬레이션 지연 (ms <= 0 이면 즉시 반환)
+void sim_delay_ms(float ms);
+
+// ===== 변경 영역 기록 (각 export 함수가 output에 쓴 위치 표시) =====
+
+inline void mark_dirty_data_all(process_context* ctx)
+{
+    for (int w = 0; w < 7; ++w) ctx->dirty.data[w] |= 0x1FFFFu;
+}
+
+inline void mark_dirty_ipvs(process_context* ctx, int point)
+{
+    for (int w = 0; w < 7; ++w) ctx->dirty.IPVS_data[w] |= (unsigned short)(1u << point);
+}
+
+inline void mark_dirty_measure(process_context* ctx, int wad)
+{
+    ctx->dirty.measure |= (unsigned char)(1u << wad);
+}
+
+inline void mark_dirty_lut(process_context* ctx, int rgb)
+{
+    ctx->dirty.lut |= (unsigned char)(1u << rgb);
+}
+
+// src의 변경 영역을 dst에 합침
+inline void merge_dirty(output_dirty* dst, const output_dirty* src)
+{
+    for (int w = 0; w < 7; ++w) {
+        dst->data[w] |= src->data[w];
+        dst->IPVS_data[w] |= src->IPVS_data[w];
+    }
+    dst->measure |= src->measure;
+    dst->lut |= src->lut;
+}
@@ -0,0 +1,88 @@
+// ProcessCpu.cpp : 실행 중 CPU 명령어 집합 확인
+
+#include "pch.h"
+#include "ProcessCpu.h"
+#include <atomic>
+
+#if defined(PROCESS_CPU_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace {
+
+#if defined(PROCESS_CPU_X86)
+    void cpuid(int leaf, int sub, unsigned int r[4])
+    {
+#if defined(_MSC_VER)
+        int v[4];
+        __cpuidex(v, leaf, sub);
+        for (int i = 0; i < 4; ++i) r[i] = (unsigned int)v[i];
+#else
+        __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+    }
+
+    // OS가 YMM 레지스터 상태를 저장하는지 확인 (XCR0 bit 1, 2)
+    bool os_saves_ymm()
+    {
+#if defined(_MSC_VER)
+        return (_xgetbv(0) & 0x6) == 0x6;
+#else
+        unsigned int eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (eax & 0x6) == 0x6;
+#endif
+    }
+#endif
+
+    int detect_simd_level()
+    {
+#if defined(PROCESS_CPU_X86)
+        unsigned int r[4];
+        cpuid(0, 0, r);
+        const unsigned int max_leaf = r[0];
+
+        cpuid(1, 0, r);
+        int level = (r[3] & (1u << 26)) ? CPU_SIMD_SSE2 : CPU_SIMD_SCALAR;
+
+        const bool avx = (r[2] & (1u << 28)) != 0;
+        const bool osxsave = (r[2] & (1u << 27)) != 0;
+        if (level == CPU_SIMD_SSE2 && avx && osxsave && max_leaf >= 7 && os_saves_ymm()) {
+            cpuid(7, 0, r);
+            if (r[1] & (1u << 5)) level = CPU_SIMD_AVX2;
+        }
+        return level;
+#else
+        return CPU_SIMD_SCALAR;
+#endif
+    }
+
+    int supported_level()
+    {
+        static const int s_level = detect_simd_level();
+        return s_level;
+    }
+
+    std::atomic<int> s_limit(CPU_SIMD_AVX2);
+}
+
+int cpu_simd_level()
+{
+    const int limit = s_limit.load(std::memory_order_relaxed);
+    const int level = supported_level();
+    return level < limit ? level : limit;
+}
+
+extern "C" {
+
+    __declspec(dllexport) int process_set_simd_limit(int level)
+    {
+        s_limit.store(level < 0 ? CPU_SIMD_AVX2 : level, std::memory_order_relaxed);
+        return cpu_simd_level();
+    }
+
+} // extern "C"
@@ -0,0 +1,80 @@
+#pragma once
+// ProcessCpu.h : 실행 중 CPU 명령어 집합 확인 (DLL 내부 전용 + 제한 설정 export)
+// 빌드는 SSE2 기준 - AVX2 경로는 함수 단위로 컴파일하고 실행 시 확인 후 호출
+// (MSVC는 /arch 없이 AVX2 intrinsic 사용 가능, GCC/Clang은 target 속성 필요)
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PROCESS_CPU_X86 1
+#endif
+
+// SSE2는 빌드 기준 명령어 집합 (x64 기본) - 실행 시 확인 없이 사용
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define PROCESS_CPU_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(PROCESS_CPU_X86) && (defined(_MSC_VER) || defined(__GNUC__))
+#define PROCESS_CPU_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define PROCESS_TARGET_AVX2
+#else
+#define PROCESS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// SIMD 수준 (높을수록 상위 집합)
+enum cpu_simd_level {
+    CPU_SIMD_SCALAR = 0,
+    CPU_SIMD_SSE2 = 1,
+    CPU_SIMD_AVX2 = 2
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // ===== SIMD 경로 제한 (26.10.16 - 경로별 결과 비교/성능 측정용) =====
+
+    /// <summary>
+    /// 사용할 최대 SIMD 수준 제한 (cpu_simd_level, 음수: 제한 해제) - 실제 사용 수준 반환
+    /// </summary>
+    __declspec(dllexport) int process_set_simd_limit(int level);
+
+#ifdef __cplusplus
+}
+#endif
+
+// 현재 사용할 SIMD 수준 (CPU 지원 수준과 제한값 중 낮은 값)
+int cpu_simd_level();
+
+#if defined(PROCESS_CPU_AVX2)
+// 32비트 필드 8개짜리 레코드 8개(AoS) → 필드별 레지스터 8개 (f[k]: 8개 레코드의 k번째 필드)
+// struct pattern (x, y, u, v, L, cur, eff, result) 8개를 SoA로 읽을 때 사용
+PROCESS_TARGET_AVX2 inline void transpose8_ps(const float* src, __m256 f[8])
+{
+    __m256 r0 = _mm256_loadu_ps(src + 0), r1 = _mm256_loadu_ps(src + 8);
+    __m256 r2 = _mm256_loadu_ps(src + 16), r3 = _mm256_loadu_ps(src + 24);
+    __m256 r4 = _mm256_loadu_ps(src + 32), r5 = _mm256_loadu_ps(src + 40);
+    __m256 r6 = _mm256_loadu_ps(src + 48), r7 = _mm256_loadu_ps(src + 56);
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 t4 = _mm256_unpacklo_ps(r4, r5), t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 t6 = _mm256_unpacklo_ps(r6, r7), t7 = _mm256_unpackhi_ps(r6, r7);
+
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, 0x44), s1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, 0x44), s3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, 0x44), s5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, 0x44), s7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+
+    f[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    f[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    f[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    f[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    f[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    f[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    f[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    f[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+#endif
@@ -0,0 +1,314 @@
+// ProcessDevice.cpp : 장비 계층 - 시뮬레이터 백엔드 및 장비 생성/설정
+
+#include "pch.h"
+#include "ProcessDevice.h"
+#include "ProcessContext.h"
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+sim_panel::sim_panel()
+    : timing(), behavior(), pattern(0), vmax(3300.0f), angle_exponent(1.3f)
+{
+    angle_shift[0] = 0.015f;
+    angle_shift[1] = -0.010f;
+
+    // OLED 패널 대표값 (W 최대 휘도 약 1300 cd/m²)
+    const float lmax_init[3] = { 280.0f, 880.0f, 110.0f };
+    const float gamma_init[3] = { 2.20f, 2.25f, 2.30f };
+    const float black_init[3] = { 0.02f, 0.05f, 0.01f };
+    const float primary_init[3][2] = { { 0.680f, 0.310f }, { 0.260f, 0.690f }, { 0.140f, 0.050f } };
+
+    for (int c = 0; c < 3; ++c) {
+        voltage[c] = (int)vmax;
+        lmax[c] = lmax_init[c];
+        gamma[c] = gamma_init[c];
+        black[c] = black_init[c];
+        primary[c][0] = primary_init[c][0];
+        primary[c][1] = primary_init[c][1];
+    }
+}
+
+void sim_panel::current_xyz(double xyz[3])
+{
+    // 패턴별 채널 사용 여부 및 계조 배율 (WG ~ WG13: 13/14 ~ 1/14)
+    bool on[3] = { true, true, true };
+    double scale = 1.0;
+    if (pattern >= 1 && pattern <= 3) {
+        on[0] = on[1] = on[2] = false;
+        on[pattern - 1] = true;
+    }
+    else if (pattern >= 4 && pattern <= 16) {
+        scale = (17 - pattern) / 14.0;
+    }
+    else if (pattern != 0) {
+        on[0] = on[1] = on[2] = false;  // 정의되지 않은 패턴 = 블랙
+    }
+
+    xyz[0] = xyz[1] = xyz[2] = 0.0;
+    for (int c = 0; c < 3; ++c) {
+        double level = on[c] ? (voltage[c] * scale) / vmax : 0.0;
+        if (level < 0.0) level = 0.0;
+        if (level > 1.0) level = 1.0;
+
+        double Y = black[c] + lmax[c] * std::pow(level, (double)gamma[c]);
+        double x = primary[c][0];
+        double y = primary[c][1];
+        xyz[0] += x / y * Y;
+        xyz[1] += Y;
+        xyz[2] += (1.0 - x - y) / y * Y;
+    }
+}
+
+namespace {
+
+    typedef std::chrono::steady_clock clock_type;
+
+    // 지연 + 편차 (음수가 되지 않도록 보정)
+    float jittered(float base_ms, float jitter_ms, std::mt19937& rng)
+    {
+        if (jitter_ms <= 0.0f) return base_ms;
+        std::uniform_real_distribution<float> dis(-jitter_ms, jitter_ms);
+        float ms = base_ms + dis(rng);
+        return ms > 0.0f ? ms : 0.0f;
+    }
+
+    bool roll_failure(float rate, std::mt19937& rng)
+    {
+        if (rate <= 0.0f) return false;
+        std::uniform_real_distribution<float> dis(0.0f, 1.0f);
+        return dis(rng) < rate;
+    }
+
+    // PG 시뮬레이터
+    class sim_pg : public pg_device {
+    public:
+        sim_pg(const std::shared_ptr<sim_panel>& panel, unsigned int seed)
+            : m_panel(panel), m_rng(seed) {}
+
+        bool open(int port) override { return port >= 0; }
+        bool close() override { return true; }
+
+        bool set_pattern(int pattern) override
+        {
+            if (!command()) return false;
+            std::lock_guard<std::mutex> lock(m_panel->lock);
+            m_panel->pattern = pattern;
+            return true;
+        }
+
+        bool set_voltage(int RV, int GV, int BV) override
+        {
+            if (!command()) return false;
+            std::lock_guard<std::mutex> lock(m_panel->lock);
+            m_panel->voltage[0] = RV;
+            m_panel->voltage[1] = GV;
+            m_panel->voltage[2] = BV;
+            return true;
+        }
+
+    private:
+        // 명령 지연 + 실패 판정
+        bool command()
+        {
+            float delay;
+            bool failed;
+            {
+                std::lock_guard<std::mutex> lock(m_panel->lock);
+                delay = jittered(m_panel->timing.pg_command_ms, m_panel->behavior.jitter_ms, m_rng);
+                failed = roll_failure(m_panel->behavior.pg_fail_rate, m_rng);
+            }
+            sim_delay_ms(delay);
+            return !failed;
+        }
+
+        std::shared_ptr<sim_panel> m_panel;
+        std::mt19937 m_rng;
+    };
+
+    // 측정기 시뮬레이터
+    class sim_meter : public meter_device {
+    public:
+        sim_meter(const std::shared_ptr<sim_panel>& panel, unsigned int seed, float angle_deg)
+            : m_panel(panel), m_rng(seed), m_cos_angle(std::cos(angle_deg * 3.14159265358979 / 180.0)),
+              m_state(IDLE), m_readout_ms(0.0f) {}
+
+        bool open(int port) override { return port >= 0; }
+        bool close() override { m_state = IDLE; return true; }
+
+        bool trigger() override
+        {
+            std::lock_guard<std::mutex> lock(m_panel->lock);
+            const sim_behavior& b = m_panel->behavior;
+
+            if (roll_failure(b.meas_fail_rate, m_rng)) {
+                m_state = IDLE;
+                return false;
+            }
+
+            // 트리거 시점의 패널 상태로 측정값 결정 (적분 중 패턴 유지 가정)
+            double xyz[3];
+            m_panel->current_xyz(xyz);
+
+            std::normal_distribution<double> noise(0.0, 1.0);
+            double sum = xyz[0] + xyz[1] + xyz[2];
+            double x = sum > 0.0 ? xyz[0] / sum : 0.0;
+            double y = sum > 0.0 ? xyz[1] / sum : 0.0;
+            double L = xyz[1];
+
+            //26.10.16 - 시야각 모델 (WAD별 측정기)
+            if (m_cos_angle < 1.0) {
+                double off = 1.0 - m_cos_angle;
+                L *= std::pow(m_cos_angle, (double)m_panel->angle_exponent);
+                x += m_panel->angle_shift[0] * off;
+                y += m_panel->angle_shift[1] * off;
+            }
+
+            if (b.noise > 0.0f) {
+                L *= 1.0 + b.noise * noise(m_rng);
+                x += b.noise * 0.01 * noise(m_rng);
+                y += b.noise * 0.01 * noise(m_rng);
+            }
+
+            m_sample.x = (float)x;
+            m_sample.y = (float)y;
+            m_sample.L = (float)(L > 0.0 ? L : 0.0);
+            m_sample.cur = 20.0f + 0.05f * m_sample.L;      // 패널 전류 모델 (mA)
+            m_sample.eff = m_sample.L / m_sample.cur;        // 효율 (cd/A 환산)
+
+            m_integrate_end = clock_type::now() + std::chrono::microseconds(
+                (long long)(jittered(m_panel->timing.meas_integration_ms, b.jitter_ms, m_rng) * 1000.0f));
+            m_readout_ms = jittered(m_panel->timing.meas_readout_ms, b.jitter_ms, m_rng);
+            m_state = TRIGGERED;
+            return true;
+        }
+
+        bool wait_integrated() override
+        {
+            if (m_state == IDLE) return false;
+            if (m_state == TRIGGERED) {
+                std::this_thread::sleep_until(m_integrate_end);
+                m_state = INTEGRATED;
+            }
+            return true;
+        }
+
+        bool read_result(struct pattern* dst) override
+        {
+            if (!wait_integrated()) return false;
+
+            sim_delay_ms(m_readout_ms);
+            dst->x = m_sample.x;
+            dst->y = m_sample.y;
+            dst->L = m_sample.L;
+            dst->cur = m_sample.cur;
+            dst->eff = m_sample.eff;
+            m_state = IDLE;
+            return true;
+        }
+
+    private:
+        enum state { IDLE, TRIGGERED, INTEGRATED };
+
+        std::shared_ptr<sim_panel> m_panel;
+        std::mt19937 m_rng;
+        double m_cos_angle;
+        state m_state;
+        struct pattern m_sample;
+        clock_type::time_point m_integrate_end;
+        float m_readout_ms;
+    };
+}
+
+serial_config default_serial_config()
+{
+    serial_config config;
+    std::memset(&config, 0, sizeof(config));
+#ifdef _WIN32
+    std::strcpy(config.pg_path, "\\\\.\\COM%d");
+    std::strcpy(config.meas_path, "\\\\.\\COM%d");
+#else
+    std::strcpy(config.pg_path, "/dev/ttyUSB%d");
+    std::strcpy(config.meas_path, "/dev/ttyUSB%d");
+#endif
+    config.baud = 115200;
+    config.timeout_ms = 1000;
+    return config;
+}
+
+std::unique_ptr<pg_device> create_pg_device(int backend, const std::shared_ptr<sim_panel>& panel,
+                                            const serial_config& serial, unsigned int seed)
+{
+    if (backend == DEVICE_BACKEND_SERIAL) {
+        return create_serial_pg(serial);
+    }
+    return std::unique_ptr<pg_device>(new sim_pg(panel, seed));
+}
+
+std::unique_ptr<meter_device> create_meter_device(int backend, const std::shared_ptr<sim_panel>& panel,
+                                                  const serial_config& serial, unsigned int seed,
+                                                  float angle_deg)
+{
+    if (backend == DEVICE_BACKEND_SERIAL) {
+        return create_serial_meter(serial);
+    }
+    return std::unique_ptr<meter_device>(new sim_meter(panel, seed, angle_deg));
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_set_device_backend(process_context* ctx, int backend)
+    {
+        if (ctx == nullptr || (backend != DEVICE_BACKEND_SIM && backend != DEVICE_BACKEND_SERIAL)) {
+            return false;
+        }
+
+        // 기존 장비 해제 후 새 백엔드로 교체
+        pg_off_ctx(ctx);
+        meas_off_ctx(ctx);
+
+        ctx->backend = backend;
+        create_devices(ctx);
+        return true;
+    }
+
+    __declspec(dllexport) bool process_set_serial_config(process_context* ctx, const struct serial_config* config)
+    {
+        if (ctx == nullptr) {
+            return false;
+        }
+
+        serial_config next = (config != nullptr) ? *config : default_serial_config();
+        next.pg_path[sizeof(next.pg_path) - 1] = '\0';
+        next.meas_path[sizeof(next.meas_path) - 1] = '\0';
+        std::string path;
+        if (!serial_format_path(next.pg_path, 0, &path) || !serial_format_path(next.meas_path, 0, &path)) {
+            return false;
+        }
+
+        ctx->serial = next;
+        if (ctx->serial.baud <= 0) ctx->serial.baud = 115200;
+        if (ctx->serial.timeout_ms <= 0) ctx->serial.timeout_ms = 1000;
+
+        // 연결되지 않은 장비는 새 설정으로 다시 생성
+        bool connected = ctx->ports.pg_connected || ctx->ports.meas_connected;
+        for (int w = 1; w < 7; ++w) connected = connected || ctx->wad_ports[w] >= 0;
+        if (ctx->backend == DEVICE_BACKEND_SERIAL && !connected) {
+            create_devices(ctx);
+        }
+        return true;
+    }
+
+    __declspec(dllexport) bool process_set_sim_behavior(process_context* ctx, const struct sim_behavior* behavior)
+    {
+        if (ctx == nullptr) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(ctx->panel->lock);
+        ctx->panel->behavior = (behavior != nullptr) ? *behavior : sim_behavior();
+        return true;
+    }
+
+} // extern "C"
@@ -0,0 +1,143 @@
+#pragma once
+// ProcessDevice.h : PG / 측정기 장비 계층
+// 모든 장비 관련 export 함수(PGTurn, PGPattern, PGVoltagesnd, Meas_Turn, Getdata, pg_off, meas_off)는
+// 컨텍스트의 pg_device / meter_device를 통해 장비에 접근함
+//
+// 백엔드:
+//   DEVICE_BACKEND_SIM    : 프로세스 내부 시뮬레이터 (지연/편차/실패율/패널 응답 모델) - 기본값
+//   DEVICE_BACKEND_SERIAL : 시리얼 포트 (Linux termios 비차단 / Windows COM 포트)
+//
+// 시리얼 명령 규약 (ASCII, '\n' 종료 - 실제 장비 프로토콜 적용 전 임시 규약):
+//   PG   : "PTN <n>" → "OK",  "VOL <r> <g> <b>" → "OK",  "PWR OFF" → "OK"
+//   측정기: "MEAS" → "ACK"(적분 완료) → "DATA <x>,<y>,<L>,<cur>,<eff>"
+//   응답이 "OK"/"ACK"/"DATA"가 아니거나 시간 초과 시 실패
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 장비 백엔드 종류
+    enum device_backend {
+        DEVICE_BACKEND_SIM = 0,
+        DEVICE_BACKEND_SERIAL = 1
+    };
+
+    // 시뮬레이터 동작 설정 (지연 시간은 sim_timing 참고)
+    struct sim_behavior {
+        float jitter_ms;            // 지연 편차 (± 균등 분포)
+        float pg_fail_rate;         // PG 명령 실패 확률 (0~1)
+        float meas_fail_rate;       // 측정 실패 확률 (0~1)
+        float noise;                // 측정 잡음 (휘도 상대 표준편차, 색좌표는 1/100 배)
+    };
+
+    // 시리얼 백엔드 설정
+    struct serial_config {
+        char pg_path[128];          // PG 장치 경로 형식 (%d: 포트 번호, 최대 1개 / %%: '%') 예) "/dev/ttyUSB%d", "\\\\.\\COM%d"
+        char meas_path[128];        // 측정기 장치 경로 형식
+        int baud;                   // 통신 속도 (기본 115200)
+        int timeout_ms;             // 응답 대기 시간 (기본 1000)
+    };
+
+    // ===== 장비 계층 설정 (26.10.16) =====
+
+    /// <summary>
+    /// 장비 백엔드 선택 - 연결된 장비는 해제되며 PGTurn/Meas_Turn으로 다시 연결해야 함
+    /// </summary>
+    __declspec(dllexport) bool process_set_device_backend(process_context* ctx, int backend);
+
+    /// <summary>
+    /// 시리얼 백엔드 설정 (다음 PGTurn/Meas_Turn부터 적용, nullptr: 기본값)
+    /// 경로 형식에 %d 이외의 변환이나 %d가 두 개 이상 있으면 false (설정 유지)
+    /// </summary>
+    __declspec(dllexport) bool process_set_serial_config(process_context* ctx, const struct serial_config* config);
+
+    /// <summary>
+    /// 시뮬레이터 편차/실패율/잡음 설정 (nullptr: 모두 0)
+    /// </summary>
+    __declspec(dllexport) bool process_set_sim_behavior(process_context* ctx, const struct sim_behavior* behavior);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+
+// PG(Pattern Generator) 인터페이스
+class pg_device {
+public:
+    virtual ~pg_device() {}
+
+    virtual bool open(int port) = 0;
+    virtual bool close() = 0;                               // 전원 차단 + 포트 해제
+    virtual bool set_pattern(int pattern) = 0;
+    virtual bool set_voltage(int RV, int GV, int BV) = 0;
+};
+
+// 측정기 인터페이스 - 측정을 3단계로 나누어 여러 측정기 동시 트리거/파이프라인 측정 지원
+class meter_device {
+public:
+    virtual ~meter_device() {}
+
+    virtual bool open(int port) = 0;
+    virtual bool close() = 0;
+
+    virtual bool trigger() = 0;                             // 측정 시작 (즉시 반환)
+    virtual bool wait_integrated() = 0;                     // 적분 완료 대기 (이후 패턴 변경 가능)
+    virtual bool read_result(struct pattern* dst) = 0;      // 결과 수신 (x, y, L, cur, eff)
+};
+
+// 시뮬레이터 패널 응답 모델 - PG 시뮬레이터가 쓰고 측정기 시뮬레이터가 읽음
+// 채널 휘도: L_c = Lmax_c * (V_c / vmax)^gamma_c + black_c, 패턴별 채널 조합/계조 배율 적용
+struct sim_panel {
+    std::mutex lock;
+
+    sim_timing timing;
+    sim_behavior behavior;
+
+    int pattern;                    // 현재 패턴 (0:W 1:R 2:G 3:B 4~16:WG~WG13)
+    int voltage[3];                 // 현재 RGB 전압 코드
+
+    float vmax;                     // 최대 전압 코드
+    float lmax[3];                  // 채널 최대 휘도
+    float gamma[3];                 // 채널 감마
+    float black[3];                 // 채널 블랙 휘도
+    float primary[3][2];            // 채널 색좌표 (x, y)
+
+    float angle_exponent;           // 시야각 휘도 저하 (L × cos(θ)^n)
+    float angle_shift[2];           // 시야각 색좌표 이동 (Δx, Δy) × (1 - cos(θ))
+
+    sim_panel();
+
+    // 현재 PG 상태의 CIE XYZ 계산
+    void current_xyz(double xyz[3]);
+};
+
+// 백엔드별 장비 생성
+std::unique_ptr<pg_device> create_pg_device(int backend, const std::shared_ptr<sim_panel>& panel,
+                                            const serial_config& serial, unsigned int seed);
+// angle_deg: 측정기 설치 각도 (WAD, 시뮬레이터 시야각 모델에만 사용)
+std::unique_ptr<meter_device> create_meter_device(int backend, const std::shared_ptr<sim_panel>& panel,
+                                                  const serial_config& serial, unsigned int seed,
+                                                  float angle_deg = 0.0f);
+
+// 시리얼 백엔드 (ProcessSerial.cpp)
+std::unique_ptr<pg_device> create_serial_pg(const serial_config& serial);
+std::unique_ptr<meter_device> create_serial_meter(const serial_config& serial);
+// 경로 형식의 %d를 포트 번호로 치환 (%%는 '%', %d 없으면 그대로) - 그 외 변환이 있으면 false
+bool serial_format_path(const char* pattern, int port, std::string* path);
+
+// 기본 시리얼 설정
+serial_config default_serial_config();
+
+#endif
@@ -0,0 +1,121 @@
+// ProcessDirty.cpp : 변경 영역 조회 및 부분 복사 구현
+
+#include "pch.h"
+#include "ProcessDirty.h"
+#include "ProcessContext.h"
+#include <cstring>
+
+namespace {
+
+    int popcount32(unsigned int v)
+    {
+        int n = 0;
+        while (v) {
+            v &= v - 1;
+            ++n;
+        }
+        return n;
+    }
+
+    // bits에 표시된 패턴을 연속 구간 단위로 복사 (count: 행 길이)
+    int copy_runs(const struct pattern* src, struct pattern* dst, unsigned int bits, int count)
+    {
+        int copied = 0;
+        int i = 0;
+        while (i < count) {
+            if (!(bits & (1u << i))) {
+                ++i;
+                continue;
+            }
+            int start = i;
+            while (i < count && (bits & (1u << i))) ++i;
+
+            const size_t bytes = sizeof(struct pattern) * (size_t)(i - start);
+            std::memcpy(&dst[start], &src[start], bytes);
+            copied += (int)bytes;
+        }
+        return copied;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) int process_take_dirty(process_context* ctx, struct output_dirty* mask)
+    {
+        if (ctx == nullptr) {
+            return 0;
+        }
+
+        if (mask != nullptr) {
+            *mask = ctx->dirty;
+        }
+
+        int bytes = process_dirty_bytes(&ctx->dirty);
+        ctx->dirty = output_dirty();
+        return bytes;
+    }
+
+    __declspec(dllexport) int process_take_dirty_default(struct output_dirty* mask)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_take_dirty(process_default_context(), mask);
+    }
+
+    __declspec(dllexport) void process_clear_dirty(process_context* ctx)
+    {
+        if (ctx != nullptr) {
+            ctx->dirty = output_dirty();
+        }
+    }
+
+    __declspec(dllexport) int process_dirty_bytes(const struct output_dirty* mask)
+    {
+        if (mask == nullptr) {
+            return 0;
+        }
+
+        int patterns = 0;
+        for (int w = 0; w < 7; ++w) {
+            patterns += popcount32(mask->data[w] & 0x1FFFFu);
+            patterns += popcount32(mask->IPVS_data[w] & 0x3FFu);
+        }
+        patterns += popcount32(mask->measure & 0x7Fu);
+
+        return patterns * (int)sizeof(struct pattern) +
+               popcount32(mask->lut & 0x7u) * (int)sizeof(struct lut_parameter);
+    }
+
+    __declspec(dllexport) int process_copy_dirty(const struct output* src, struct output* dst,
+                                                 const struct output_dirty* mask)
+    {
+        if (src == nullptr || dst == nullptr || mask == nullptr) {
+            return -1;
+        }
+        if (src == dst) {
+            return 0;
+        }
+
+        int copied = 0;
+        for (int w = 0; w < 7; ++w) {
+            if (mask->data[w]) {
+                copied += copy_runs(src->data[w], dst->data[w], mask->data[w], 17);
+            }
+            if (mask->IPVS_data[w]) {
+                copied += copy_runs(src->IPVS_data[w], dst->IPVS_data[w], mask->IPVS_data[w], 10);
+            }
+        }
+
+        if (mask->measure) {
+            copied += copy_runs(src->measure, dst->measure, mask->measure, 7);
+        }
+
+        for (int c = 0; c < 3; ++c) {
+            if (mask->lut & (1u << c)) {
+                dst->lut[c] = src->lut[c];
+                copied += (int)sizeof(struct lut_parameter);
+            }
+        }
+        return copied;
+    }
+
+} // extern "C"
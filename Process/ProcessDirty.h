@@ -0,0 +1,51 @@
+#pragma once
+// ProcessDirty.h : 변경 영역(output_dirty) 조회 및 부분 복사 함수 선언
+// 모든 *_ctx 함수(및 기본 컨텍스트 래퍼)는 output에 기록한 위치를 컨텍스트에 누적함
+// 호출 측은 process_take_dirty로 누적 영역을 받아 process_copy_dirty로 해당 영역만 복사
+//
+// 26.10.16 - 누적 영역은 컨텍스트 단위의 합집합 (output별로 구분하지 않음)
+//   마지막 take 이후 그 컨텍스트로 호출한 모든 output(배치의 모든 셀 포함)의 기록이 합쳐짐
+//   따라서 한 output만 쓰는 Zone 전용 컨텍스트에서만 그 output의 변경 영역으로 사용 가능
+//   기본 컨텍스트를 여러 Zone이 함께 쓰면 다른 Zone의 기록까지 섞이므로 사용 불가
+//   → output별 영역이 필요하면 *_batch_dirty(_ctx)의 셀별 masks 사용 (ProcessBatch.h)
+
+#include "ProcessFunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // ===== 변경 영역 추적 (26.10.16) =====
+
+    /// <summary>
+    /// 컨텍스트에 누적된 변경 영역(모든 output의 합집합)을 mask에 복사하고 초기화
+    /// 반환값: 변경 영역 바이트 수 (변경 없음: 0)
+    /// </summary>
+    __declspec(dllexport) int process_take_dirty(process_context* ctx, struct output_dirty* mask);
+
+    /// <summary>
+    /// 기본 컨텍스트용 process_take_dirty
+    /// 기본 컨텍스트를 함께 쓰는 모든 Zone의 합집합 - Zone별 영역은 *_batch_dirty의 masks 사용
+    /// </summary>
+    __declspec(dllexport) int process_take_dirty_default(struct output_dirty* mask);
+
+    /// <summary>
+    /// 누적된 변경 영역 초기화
+    /// </summary>
+    __declspec(dllexport) void process_clear_dirty(process_context* ctx);
+
+    /// <summary>
+    /// mask가 가리키는 바이트 수 계산
+    /// </summary>
+    __declspec(dllexport) int process_dirty_bytes(const struct output_dirty* mask);
+
+    /// <summary>
+    /// mask에 표시된 영역만 src → dst 복사 (연속 구간은 한 번에 복사)
+    /// 반환값: 복사한 바이트 수 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_copy_dirty(const struct output* src, struct output* dst,
+                                                 const struct output_dirty* mask);
+
+#ifdef __cplusplus
+}
+#endif
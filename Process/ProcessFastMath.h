@@ -0,0 +1,174 @@
+#pragma once
+// ProcessFastMath.h : 근사 log/exp/pow (DLL 내부 전용)
+// Cephes logf/expf 다항식 기반 - SSE2 4개 동시 계산 + 같은 연산 순서의 스칼라 버전
+// SSE2 경로와 스칼라 경로는 같은 연산을 같은 순서로 수행하므로 결과가 비트 단위로 동일함
+//
+// 오차 (x: 정규화 float, 단정밀도 기준):
+//   fast_log : 절대 오차 < 2e-7 (|ln x| < 1), 상대 오차 < 2e-7 (그 외)
+//   fast_exp : 상대 오차 < 2e-7 (|x| < 88)
+//   fast_pow : 상대 오차 < (|g·ln x| + 1) × 2.5e-7  →  x ∈ [1e-6, 1], g ≤ 3 에서 1.2e-5 미만
+//   x <= 0 이면 fast_pow = 0
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define PROCESS_FASTMATH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace fastmath {
+
+    const float SQRTHF = 0.707106781186547524f;
+    const float LOG_P[9] = { 7.0376836292E-2f, -1.1514610310E-1f, 1.1676998740E-1f,
+                             -1.2420140846E-1f, 1.4249322787E-1f, -1.6668057665E-1f,
+                             2.0000714765E-1f, -2.4999993993E-1f, 3.3333331174E-1f };
+    const float LOG_Q1 = -2.12194440e-4f;
+    const float LOG_Q2 = 0.693359375f;
+
+    const float EXP_HI = 88.3762626647949f;
+    const float EXP_LO = -88.3762626647949f;
+    const float LOG2EF = 1.44269504088896341f;
+    const float EXP_C1 = 0.693359375f;
+    const float EXP_C2 = -2.12194440e-4f;
+    const float EXP_P[6] = { 1.9875691500E-4f, 1.3981999507E-3f, 8.3334519073E-3f,
+                             4.1665795894E-2f, 1.6666665459E-1f, 5.0000001201E-1f };
+
+    const float MIN_NORM = 1.17549435e-38f;
+
+    inline float bits_to_float(uint32_t u) { float f; std::memcpy(&f, &u, sizeof(f)); return f; }
+    inline uint32_t float_to_bits(float f) { uint32_t u; std::memcpy(&u, &f, sizeof(u)); return u; }
+
+    // 자연로그 (x > 0)
+    inline float fast_log(float x)
+    {
+        if (x < MIN_NORM) x = MIN_NORM;
+
+        uint32_t u = float_to_bits(x);
+        float e = (float)((int)(u >> 23) - 127) + 1.0f;
+        float m = bits_to_float((u & 0x007FFFFFu) | 0x3F000000u);    // [0.5, 1)
+
+        if (m < SQRTHF) {
+            e -= 1.0f;
+            m = m + m - 1.0f;
+        }
+        else {
+            m = m - 1.0f;
+        }
+
+        float z = m * m;
+        float y = LOG_P[0];
+        for (int i = 1; i < 9; ++i) y = y * m + LOG_P[i];
+        y = y * m;
+        y = y * z;
+        y = y + e * LOG_Q1;
+        y = y - 0.5f * z;
+        m = m + y;
+        m = m + e * LOG_Q2;
+        return m;
+    }
+
+    // 지수 함수
+    inline float fast_exp(float x)
+    {
+        if (x > EXP_HI) x = EXP_HI;
+        if (x < EXP_LO) x = EXP_LO;
+
+        float fx = x * LOG2EF + 0.5f;
+        float t = (float)(int)fx;
+        if (t > fx) t -= 1.0f;                  // floor
+        fx = t;
+
+        x = x - fx * EXP_C1;
+        x = x - fx * EXP_C2;
+        float z = x * x;
+
+        float y = EXP_P[0];
+        for (int i = 1; i < 6; ++i) y = y * x + EXP_P[i];
+        y = y * z + x + 1.0f;
+
+        return y * bits_to_float((uint32_t)((int)fx + 127) << 23);
+    }
+
+    // x^g (x <= 0 이면 0)
+    inline float fast_pow(float x, float g)
+    {
+        if (!(x > 0.0f)) return 0.0f;
+        return fast_exp(g * fast_log(x));
+    }
+
+#ifdef PROCESS_FASTMATH_SSE2
+
+    inline __m128 fast_log_ps(__m128 x)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        x = _mm_max_ps(x, _mm_set1_ps(MIN_NORM));
+
+        __m128i u = _mm_castps_si128(x);
+        __m128i ei = _mm_sub_epi32(_mm_srli_epi32(u, 23), _mm_set1_epi32(127));
+        __m128 e = _mm_add_ps(_mm_cvtepi32_ps(ei), one);
+        __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(u, _mm_set1_epi32(0x007FFFFF)),
+                                                 _mm_set1_epi32(0x3F000000)));
+
+        __m128 mask = _mm_cmplt_ps(m, _mm_set1_ps(SQRTHF));
+        e = _mm_sub_ps(e, _mm_and_ps(one, mask));
+        m = _mm_sub_ps(_mm_add_ps(m, _mm_and_ps(m, mask)), one);
+
+        __m128 z = _mm_mul_ps(m, m);
+        __m128 y = _mm_set1_ps(LOG_P[0]);
+        for (int i = 1; i < 9; ++i) y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(LOG_P[i]));
+        y = _mm_mul_ps(y, m);
+        y = _mm_mul_ps(y, z);
+        y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(LOG_Q1)));
+        y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+        m = _mm_add_ps(m, y);
+        m = _mm_add_ps(m, _mm_mul_ps(e, _mm_set1_ps(LOG_Q2)));
+        return m;
+    }
+
+    inline __m128 fast_exp_ps(__m128 x)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        x = _mm_min_ps(x, _mm_set1_ps(EXP_HI));
+        x = _mm_max_ps(x, _mm_set1_ps(EXP_LO));
+
+        __m128 fx = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(LOG2EF)), _mm_set1_ps(0.5f));
+        __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(fx));
+        t = _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, fx), one));
+        fx = t;
+
+        x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(EXP_C1)));
+        x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(EXP_C2)));
+        __m128 z = _mm_mul_ps(x, x);
+
+        __m128 y = _mm_set1_ps(EXP_P[0]);
+        for (int i = 1; i < 6; ++i) y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(EXP_P[i]));
+        y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), x), one);
+
+        __m128i pow2n = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(fx), _mm_set1_epi32(127)), 23);
+        return _mm_mul_ps(y, _mm_castsi128_ps(pow2n));
+    }
+
+    inline __m128 fast_pow_ps(__m128 x, __m128 g)
+    {
+        __m128 positive = _mm_cmpgt_ps(x, _mm_setzero_ps());
+        return _mm_and_ps(fast_exp_ps(_mm_mul_ps(g, fast_log_ps(x))), positive);
+    }
+
+#endif
+
+    // 배열 x^g (4개 단위 SSE2, 나머지 스칼라 - 결과 동일)
+    inline void fast_pow_array(const float* x, float g, float* dst, int n)
+    {
+        int i = 0;
+#ifdef PROCESS_FASTMATH_SSE2
+        const __m128 gv = _mm_set1_ps(g);
+        for (; i + 4 <= n; i += 4) {
+            _mm_storeu_ps(dst + i, fast_pow_ps(_mm_loadu_ps(x + i), gv));
+        }
+#endif
+        for (; i < n; ++i) {
+            dst[i] = fast_pow(x[i], g);
+        }
+    }
+}
@@ -3,42 +3,223 @@
 
 #include "pch.h"
 #include "ProcessFunctions.h"
-#include "Process.h"
+#include "ProcessContext.h"
+#include "ProcessThreadPool.h"
+#include "ProcessLut.h"
+#include "ProcessLutFit.h"
+#include "ProcessJudge.h"
+#ifndef PROCESS_PORTABLE
+#include "Process.h"     // MFC 앱 클래스 (이식용 빌드에서는 제외)
+#endif
 #include <random>
+#include <chrono>
 #include <cmath>
 #include <ctime>
+#include <new>
+#include <thread>
 
-// 전역 초기화 플래그 (함수 외부)
 namespace {
-    bool g_mtp_initialized = false;
-    bool g_ipvs_initialized = false;
-    
-    // 25.02.08 - 포트 연결 상태 추가 (종료 처리 강화)
-    port_state g_port_state = { -1, -1, 0, 0 };
+
+    // 26.10.16 - 컨텍스트 난수 시드 (time + zone + 컨텍스트 주소 + random_device 조합)
+    void seed_context(process_context* ctx)
+    {
+        std::random_device rd;
+        std::seed_seq seq{ rd(), (unsigned int)time(NULL), (unsigned int)ctx->zone,
+                           (unsigned int)(uintptr_t)ctx };
+        ctx->rng.seed(seq);
+    }
+
+    // 랜덤 판정 생성 (80% OK, 10% NG, 10% PTN)
+    int random_result(process_context* ctx)
+    {
+        std::uniform_int_distribution<int> dis(0, 9);
+        int random = dis(ctx->rng);
+
+        if (random < 8) return 0;       // OK
+        if (random == 8) return 1;      // NG
+        return 2;                       // PTN
+    }
+
+    void init_context(process_context* ctx, int zone)
+    {
+        ctx->zone = zone;
+        ctx->ports = { -1, -1, 0, 0 };
+        ctx->mtp_initialized = false;
+        ctx->ipvs_initialized = false;
+        ctx->dirty = output_dirty();
+        ctx->pg_pattern = -1;
+        for (int w = 0; w < 7; ++w) ctx->wad_ports[w] = -1;
+        ctx->vt_jacobian_valid = false;
+        ctx->vt_last[0] = ctx->vt_last[1] = ctx->vt_last[2] = 0;
+        meter_cal_init(&ctx->cal);
+        uniformity_init(&ctx->uni);
+        seed_context(ctx);
+
+        //26.10.16 - 장비 계층 (기본: 시뮬레이터)
+        ctx->backend = DEVICE_BACKEND_SIM;
+        ctx->serial = default_serial_config();
+        ctx->panel = std::make_shared<sim_panel>();
+        create_devices(ctx);
+    }
+}
+
+void sim_delay_ms(float ms)
+{
+    if (ms > 0.0f) {
+        std::this_thread::sleep_for(std::chrono::microseconds((long long)(ms * 1000.0f)));
+    }
+}
+
+bool meas_integrate(process_context* ctx)
+{
+    return ctx->meter->trigger() && ctx->meter->wait_integrated();
+}
+
+bool meas_readout(const process_context* ctx, struct pattern* dst)
+{
+    return meas_readout_from(ctx->meter.get(), dst, &ctx->cal.wad[0]);
+}
+
+bool meas_readout_from(meter_device* meter, struct pattern* dst, const meter_cal* cal)
+{
+    if (!meter->read_result(dst)) {
+        return false;
+    }
+
+    //26.10.16 - 측정기 보정 (u', v'는 보정된 x, y로 계산)
+    if (cal != nullptr) {
+        meter_cal_apply(*cal, dst);
+    }
+
+    dst->u = (4 * dst->x) / (-2 * dst->x + 12 * dst->y + 3);
+    dst->v = (9 * dst->y) / (-2 * dst->x + 12 * dst->y + 3);
+    return true;
+}
+
+void create_devices(process_context* ctx)
+{
+    ctx->pg = create_pg_device(ctx->backend, ctx->panel, ctx->serial, ctx->rng());
+    ctx->meter = create_meter_device(ctx->backend, ctx->panel, ctx->serial, ctx->rng());
+
+    //26.10.16 - WAD별 측정기 (다중 각도 동시 측정)
+    for (int w = 1; w < 7; ++w) {
+        ctx->wad_meters[w] = create_meter_device(ctx->backend, ctx->panel, ctx->serial, ctx->rng(),
+                                                 wad_angle_deg(w));
+    }
+}
+
+float wad_angle_deg(int wad)
+{
+    static const float angles[7] = { 0.0f, 30.0f, 45.0f, 60.0f, 15.0f, 0.0f, 0.0f };
+    return (wad >= 0 && wad < 7) ? angles[wad] : 0.0f;
+}
+
+meter_device* wad_meter(process_context* ctx, int wad)
+{
+    if (wad == 0) return ctx->meter.get();
+    if (wad < 0 || wad >= 7) return nullptr;
+    return ctx->wad_meters[wad].get();
+}
+
+// IPVS 포인트 1개 측정 (IPVS_test_ctx / 배치 함수 공용)
+int ipvs_test_point(process_context* ctx, const struct input* in, struct output* out)
+{
+    if (ctx == nullptr || in == nullptr || out == nullptr) {
+        return 0;
+    }
+
+    int point = in->cur_point;
+    if (point < 0 || point >= 10) {
+        return 0;
+    }
+
+    // 랜덤 시드 초기화 (첫 호출 시에만)
+    if (!ctx->ipvs_initialized) {
+        seed_context(ctx);
+        ctx->ipvs_initialized = true;
+    }
+
+    int cnt = 0;
+
+    // 7개 WAD의 현재 포인트 데이터 생성
+    for (int i = 0; i < 7; i++) {
+        out->IPVS_data[i][point].x = cnt + 1.0f;
+        out->IPVS_data[i][point].y = cnt + 2.0f;
+        out->IPVS_data[i][point].L = cnt + 3.0f;
+        out->IPVS_data[i][point].cur = cnt + 4.0f;
+        out->IPVS_data[i][point].eff = cnt + 5.0f;
+        out->IPVS_data[i][point].result = ctx->judge ? 0 : random_result(ctx);
+        cnt++;
+    }
+
+    //26.10.16 - 스펙이 설정되어 있으면 난수 대신 스펙 판정
+    if (ctx->judge) {
+        judge_ipvs_point(ctx->judge.get(), out, point, nullptr);
+    }
+    mark_dirty_ipvs(ctx, point);
+    return 1;
+}
+
+// 기존 export 함수들이 사용하는 기본 컨텍스트 (첫 사용 시 생성)
+process_context* process_default_context()
+{
+    static process_context s_default;
+    static bool s_initialized = (init_context(&s_default, 0), true);
+    (void)s_initialized;
+    return &s_default;
+}
+
+std::mutex& process_default_lock()
+{
+    static std::mutex s_lock;
+    return s_lock;
 }
 
 extern "C" {
 
+    // ===== Zone별 컨텍스트 API (26.10.16 - 전역 상태 제거) =====
+
+    __declspec(dllexport) process_context* process_create_context(int zone)
+    {
+        if (zone < 0) {
+            return nullptr;
+        }
+
+        process_context* ctx = new (std::nothrow) process_context();
+        if (ctx == nullptr) {
+            return nullptr;
+        }
+
+        init_context(ctx, zone);
+        return ctx;
+    }
+
+    __declspec(dllexport) void process_destroy_context(process_context* ctx)
+    {
+        if (ctx == nullptr || ctx == process_default_context()) {
+            return;
+        }
+
+        cleanup_all_devices_ctx(ctx);
+        delete ctx;
+    }
+
     //25.10.30 - MTP 테스트 함수 - 7x17 패턴 데이터 생성
     // AFX_MANAGE_STATE 제거 (전역 Lock으로 인한 Zone 간 경쟁 제거)
-    __declspec(dllexport) int MTP_test(struct input* in, struct output* out) 
+    //26.10.16 - rand() 제거, 컨텍스트 난수 생성기 사용
+    __declspec(dllexport) int MTP_test_ctx(process_context* ctx, const struct input* in, struct output* out)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거! (MFC 리소스 미사용)
-
-        if (in == nullptr || out == nullptr) {
+        if (ctx == nullptr || in == nullptr || out == nullptr) {
             return 0;
         }
 
         // 랜덤 시드 초기화 (첫 호출 시에만)
-        if (!g_mtp_initialized) {
-            srand((unsigned int)(time(NULL) * 1000 + (uintptr_t)in));
-            g_mtp_initialized = true;
+        if (!ctx->mtp_initialized) {
+            seed_context(ctx);
+            ctx->mtp_initialized = true;
         }
 
         int cnt = 0;
-        int ok = 0;
-        int ng = 0;
-        int ptn = 0;
 
         // 7개 WAD, 17개 패턴 데이터 생성
         for (int i = 0; i < 7; i++) {
@@ -48,191 +229,132 @@ extern "C" {
                 out->data[i][j].L = cnt + 3.0f;
                 out->data[i][j].cur = cnt + 4.0f;
                 out->data[i][j].eff = cnt + 5.0f;
-
-                // 랜덤 판정 생성 (80% OK, 10% NG, 10% PTN)
-                int random = (rand() + cnt) % 10;
-
-                if (random < 8) {
-                    out->data[i][j].result = 0;  // OK
-                    ok++;
-                }
-                else if (random == 8) {
-                    out->data[i][j].result = 1;  // NG
-                    ng++;
-                }
-                else {
-                    out->data[i][j].result = 2;  // PTN
-                    ptn++;
-                }
+                out->data[i][j].result = ctx->judge ? 0 : random_result(ctx);
                 cnt++;
             }
         }
+
+        //26.10.16 - 스펙이 설정되어 있으면 난수 대신 스펙 판정 (119개 슬롯 일괄)
+        if (ctx->judge) {
+            judge_mtp_slots(ctx->judge.get(), out, 0, 0, 7 * 17, nullptr);
+        }
+        mark_dirty_data_all(ctx);
         return 1;
     }
 
     //25.10.30 - IPVS 테스트 함수 - 7xN 포인트 데이터 생성
-    // AFX_MANAGE_STATE 제거 (전역 Lock으로 인한 Zone 간 경쟁 제거)
-    __declspec(dllexport) int IPVS_test(struct input* in, struct output* out) 
+    //26.10.16 - rand() 제거, 컨텍스트 난수 생성기 사용
+    __declspec(dllexport) int IPVS_test_ctx(process_context* ctx, const struct input* in, struct output* out)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거! (MFC 리소스 미사용)
-
-        if (in == nullptr || out == nullptr) {
-            return 0;
-        }
-
-        int point = in->cur_point;
-
-        // 랜덤 시드 초기화 (첫 호출 시에만)
-        if (!g_ipvs_initialized) {
-            srand((unsigned int)(time(NULL) * 1000 + (uintptr_t)in));
-            g_ipvs_initialized = true;
-        }
+        int result = ipvs_test_point(ctx, in, out);
 
-        int cnt = 0;
-        int ok = 0;
-        int ng = 0;
-        int ptn = 0;
-
-        // 7개 WAD의 현재 포인트 데이터 생성
-        for (int i = 0; i < 7; i++) {
-            out->IPVS_data[i][point].x = cnt + 1.0f;
-            out->IPVS_data[i][point].y = cnt + 2.0f;
-            out->IPVS_data[i][point].L = cnt + 3.0f;
-            out->IPVS_data[i][point].cur = cnt + 4.0f;
-            out->IPVS_data[i][point].eff = cnt + 5.0f;
-
-            // 랜덤 판정 생성
-            int random = (rand() + cnt) % 10;
-
-            if (random < 8) {
-                out->IPVS_data[i][point].result = 0;  // OK
-                ok++;
-            }
-            else if (random == 8) {
-                out->IPVS_data[i][point].result = 1;  // NG
-                ng++;
-            }
-            else {
-                out->IPVS_data[i][point].result = 2;  // PTN
-                ptn++;
-            }
-            cnt++;
+        //26.10.16 - 포인트가 들어올 때마다 균일도 갱신
+        if (result == 1) {
+            uniformity_update(ctx, in, out);
         }
-        return 1;
+        return result;
     }
 
     // PG 포트 제어
-    //25.10.30 - AFX_MANAGE_STATE 제거 (전역 Lock 제거)
     //25.02.08 - 포트 상태 저장 추가
-    __declspec(dllexport) bool PGTurn(int port) 
+    __declspec(dllexport) bool PGTurn_ctx(process_context* ctx, int port)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거!
+        if (ctx == nullptr || port < 0)
+            return false;
 
-        if (port < 0)
+        //26.10.16 - 장비 계층으로 연결 (재연결 시 기존 연결 해제)
+        if (ctx->ports.pg_connected) {
+            ctx->pg->close();
+        }
+        if (!ctx->pg->open(port)) {
+            ctx->ports.pg_port = -1;
+            ctx->ports.pg_connected = 0;
             return false;
-        
+        }
+
         // 포트 연결 성공 시 상태 저장
-        g_port_state.pg_port = port;
-        g_port_state.pg_connected = 1;
-        
-        // TODO: 실제 하드웨어와 통신하는 경우 여기에 연결 코드 추가
-        // 예: OpenSerialPort(port); 또는 InitializeUSB(port);
-        
+        ctx->ports.pg_port = port;
+        ctx->ports.pg_connected = 1;
+
         return true;
     }
 
-    //25.10.30 - PG 패턴 제어 (AFX_MANAGE_STATE 제거)
-    __declspec(dllexport) bool PGPattern(int pattern) 
+    // PG 패턴 제어
+    __declspec(dllexport) bool PGPattern_ctx(process_context* ctx, int pattern)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거!
+        if (ctx == nullptr || pattern < 0)
+            return false;
 
-        if (pattern < 0)
+        if (!ctx->pg->set_pattern(pattern))
             return false;
+
+        ctx->pg_pattern = pattern;
         return true;
     }
 
-    //25.10.30 - PG 전압 전송 (AFX_MANAGE_STATE 제거)
-    __declspec(dllexport) bool PGVoltagesnd(int RV, int GV, int BV) 
+    // PG 전압 전송
+    __declspec(dllexport) bool PGVoltagesnd_ctx(process_context* ctx, int RV, int GV, int BV)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거!
+        if (ctx == nullptr)
+            return false;
 
         if (RV == 0 || GV == 0 || BV == 0)
             return false;
-        return true;
+
+        return ctx->pg->set_voltage(RV, GV, BV);
     }
 
-    //25.10.30 - 측정 포트 제어 (AFX_MANAGE_STATE 제거)
+    // 측정 포트 제어
     //25.02.08 - 포트 상태 저장 추가
-    __declspec(dllexport) bool Meas_Turn(int port) 
+    __declspec(dllexport) bool Meas_Turn_ctx(process_context* ctx, int port)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거!
+        if (ctx == nullptr || port < 0)
+            return false;
 
-        if (port < 0)
+        //26.10.16 - 장비 계층으로 연결 (재연결 시 기존 연결 해제)
+        if (ctx->ports.meas_connected) {
+            ctx->meter->close();
+        }
+        if (!ctx->meter->open(port)) {
+            ctx->ports.meas_port = -1;
+            ctx->ports.meas_connected = 0;
             return false;
-        
+        }
+
         // 포트 연결 성공 시 상태 저장
-        g_port_state.meas_port = port;
-        g_port_state.meas_connected = 1;
-        
-        // TODO: 실제 하드웨어와 통신하는 경우 여기에 연결 코드 추가
-        
+        ctx->ports.meas_port = port;
+        ctx->ports.meas_connected = 1;
+        meter_cal_resolve(ctx, 0);
+
         return true;
     }
 
-    //25.10.30 - 측정 데이터 획득 (AFX_MANAGE_STATE 제거)
-    __declspec(dllexport) bool Getdata(struct output* out) 
+    // 측정 데이터 획득
+    //26.10.16 - 함수 내부 static mt19937 제거 (Zone 간 공유 방지)
+    __declspec(dllexport) bool Getdata_ctx(process_context* ctx, struct output* out)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거!
-
-        if (out == nullptr) {
+        if (ctx == nullptr || out == nullptr) {
             return false;
         }
 
         // 기본 WAD 인덱스 (0) 사용
         int wad = 0;
+        meter_cal_refresh(ctx);
 
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_real_distribution<float> dis_xy(0.28f, 0.35f);
-        static std::uniform_real_distribution<float> dis_L(1000.0f, 1500.0f);
-        static std::uniform_real_distribution<float> dis_eff_cur(30.0f, 800.0f);
-
-        // 랜덤값 생성
-        out->measure[wad].x = dis_xy(gen);
-        out->measure[wad].y = dis_xy(gen);
-        out->measure[wad].L = dis_L(gen);
-        out->measure[wad].eff = dis_eff_cur(gen);
-        out->measure[wad].cur = dis_eff_cur(gen);
-        out->measure[wad].u = (4 * out->measure[wad].x) / 
-                              (-2 * out->measure[wad].x + 12 * out->measure[wad].y + 3);
-        out->measure[wad].v = (9 * out->measure[wad].y) / 
-                              (-2 * out->measure[wad].x + 12 * out->measure[wad].y + 3);
+        //26.10.16 - 장비 계층 측정기 사용 (적분/전송 단계 분리 - 파이프라인 측정과 같은 경로)
+        if (!meas_integrate(ctx) || !meas_readout(ctx, &out->measure[wad])) {
+            return false;
+        }
+        mark_dirty_measure(ctx, wad);
         return true;
     }
 
-    //25.10.30 - LUT 데이터 계산 (AFX_MANAGE_STATE 제거)
-    __declspec(dllexport) bool getLUTdata(int rgb, float RV, float GV, float BV, 
-                                          int interval, int cnt, struct output* out) 
+    // LUT 데이터 계산
+    //26.10.16 - 랜덤 값 대신 장비 계층으로 계조 스윕 후 계산 (원시 측정점은 getLUTdata_series_ctx 참고)
+    __declspec(dllexport) bool getLUTdata_ctx(process_context* ctx, int rgb, float RV, float GV, float BV,
+                                              int interval, int cnt, struct output* out)
     {
-        // AFX_MANAGE_STATE(AfxGetStaticModuleState()); // 제거!
-
-        if (out == nullptr) {
-            return false;
-        }
-
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_real_distribution<float> max_L(1000.0f, 1500.0f);
-        static std::uniform_int_distribution<int> max_index(3000, 3500);
-        static std::uniform_real_distribution<float> gamma(2.0f, 2.9f);
-        static std::uniform_real_distribution<float> black(0.0f, 0.1f);
-
-        out->lut[rgb].max_lumi = max_L(gen);
-        out->lut[rgb].max_index = (float)max_index(gen);
-        out->lut[rgb].gamma = gamma(gen);
-        out->lut[rgb].black = black(gen);
-
-        return true;
+        return getLUTdata_series_ctx(ctx, rgb, RV, GV, BV, interval, cnt, nullptr, 0, nullptr, out);
     }
 
     // ===== 장비 종료 함수 (25.02.08 - 종료 처리 강화) =====
@@ -240,38 +362,37 @@ extern "C" {
     /// <summary>
     /// PG 포트 연결 해제 및 전원 차단
     /// </summary>
-    __declspec(dllexport) bool pg_off()
+    __declspec(dllexport) bool pg_off_ctx(process_context* ctx)
     {
+        if (ctx == nullptr) {
+            return false;
+        }
+
         try
         {
-            if (!g_port_state.pg_connected)
+            if (!ctx->ports.pg_connected)
             {
                 // 이미 연결 해제된 상태
                 return true;
             }
 
-            // TODO: 실제 하드웨어 전원 차단 로직 추가
-            // 예:
-            // if (g_pg_handle != nullptr) {
-            //     SendCommand(g_pg_handle, "POWER_OFF");
-            //     CloseSerialPort(g_pg_handle);
-            //     g_pg_handle = nullptr;
-            // }
+            //26.10.16 - 장비 계층으로 전원 차단 + 포트 해제
+            bool closed = ctx->pg->close();
 
-            // 포트 상태 초기화
-            g_port_state.pg_port = -1;
-            g_port_state.pg_connected = 0;
+            // 포트 상태 초기화 (전원 차단 응답 실패 시에도 해제)
+            ctx->ports.pg_port = -1;
+            ctx->ports.pg_connected = 0;
 
             // 로그 출력 (디버깅용)
             OutputDebugStringA("[Process.dll] PG 포트 연결 해제 완료\n");
 
-            return true;
+            return closed;
         }
         catch (...)
         {
             // 예외 발생 시에도 상태는 초기화
-            g_port_state.pg_port = -1;
-            g_port_state.pg_connected = 0;
+            ctx->ports.pg_port = -1;
+            ctx->ports.pg_connected = 0;
             return false;
         }
     }
@@ -279,33 +400,43 @@ extern "C" {
     /// <summary>
     /// 측정기 포트 연결 해제
     /// </summary>
-    __declspec(dllexport) bool meas_off()
+    __declspec(dllexport) bool meas_off_ctx(process_context* ctx)
     {
+        if (ctx == nullptr) {
+            return false;
+        }
+
         try
         {
-            if (!g_port_state.meas_connected)
+            //26.10.16 - WAD별 측정기 연결 해제
+            bool closed = true;
+            for (int w = 1; w < 7; ++w) {
+                if (ctx->wad_ports[w] >= 0) {
+                    closed = ctx->wad_meters[w]->close() && closed;
+                    ctx->wad_ports[w] = -1;
+                }
+            }
+
+            if (!ctx->ports.meas_connected)
             {
-                return true;
+                return closed;
             }
 
-            // TODO: 실제 하드웨어 연결 해제 로직 추가
-            // 예:
-            // if (g_meas_handle != nullptr) {
-            //     DisconnectMeasurementDevice(g_meas_handle);
-            //     g_meas_handle = nullptr;
-            // }
+            //26.10.16 - 장비 계층으로 연결 해제
+            closed = ctx->meter->close() && closed;
 
-            g_port_state.meas_port = -1;
-            g_port_state.meas_connected = 0;
+            ctx->ports.meas_port = -1;
+            ctx->ports.meas_connected = 0;
 
             OutputDebugStringA("[Process.dll] 측정기 포트 연결 해제 완료\n");
 
-            return true;
+            return closed;
         }
         catch (...)
         {
-            g_port_state.meas_port = -1;
-            g_port_state.meas_connected = 0;
+            ctx->ports.meas_port = -1;
+            ctx->ports.meas_connected = 0;
+            for (int w = 1; w < 7; ++w) ctx->wad_ports[w] = -1;
             return false;
         }
     }
@@ -313,18 +444,23 @@ extern "C" {
     /// <summary>
     /// 모든 장비 리소스 해제
     /// </summary>
-    __declspec(dllexport) bool cleanup_all_devices()
+    __declspec(dllexport) bool cleanup_all_devices_ctx(process_context* ctx)
     {
-        bool pg_result = pg_off();
-        bool meas_result = meas_off();
+        if (ctx == nullptr) {
+            return false;
+        }
+
+        bool pg_result = pg_off_ctx(ctx);
+        bool meas_result = meas_off_ctx(ctx);
 
         // 초기화 플래그도 리셋
-        g_mtp_initialized = false;
-        g_ipvs_initialized = false;
+        ctx->mtp_initialized = false;
+        ctx->ipvs_initialized = false;
 
         char log_buffer[256];
-        sprintf_s(log_buffer, sizeof(log_buffer), 
-                  "[Process.dll] 모든 장비 리소스 해제 완료 (PG: %s, MEAS: %s)\n",
+        sprintf_s(log_buffer, sizeof(log_buffer),
+                  "[Process.dll] Zone %d 장비 리소스 해제 완료 (PG: %s, MEAS: %s)\n",
+                  ctx->zone,
                   pg_result ? "성공" : "실패",
                   meas_result ? "성공" : "실패");
         OutputDebugStringA(log_buffer);
@@ -335,99 +471,110 @@ extern "C" {
     /// <summary>
     /// 현재 포트 연결 상태 조회
     /// </summary>
-    __declspec(dllexport) void get_port_state(struct port_state* state)
+    __declspec(dllexport) void get_port_state_ctx(process_context* ctx, struct port_state* state)
     {
-        if (state != nullptr)
+        if (ctx != nullptr && state != nullptr)
         {
-            *state = g_port_state;
+            *state = ctx->ports;
         }
     }
 
+    // ===== 기존 export 함수 (기본 컨텍스트 래퍼) =====
+
+    __declspec(dllexport) int MTP_test(struct input* in, struct output* out)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return MTP_test_ctx(process_default_context(), in, out);
+    }
+
+    __declspec(dllexport) int IPVS_test(struct input* in, struct output* out)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return IPVS_test_ctx(process_default_context(), in, out);
+    }
+
+    __declspec(dllexport) bool PGTurn(int port)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return PGTurn_ctx(process_default_context(), port);
+    }
+
+    __declspec(dllexport) bool PGPattern(int pattern)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return PGPattern_ctx(process_default_context(), pattern);
+    }
+
+    __declspec(dllexport) bool PGVoltagesnd(int RV, int GV, int BV)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return PGVoltagesnd_ctx(process_default_context(), RV, GV, BV);
+    }
+
+    __declspec(dllexport) bool Meas_Turn(int port)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return Meas_Turn_ctx(process_default_context(), port);
+    }
+
+    __declspec(dllexport) bool Getdata(struct output* out)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return Getdata_ctx(process_default_context(), out);
+    }
+
+    __declspec(dllexport) bool getLUTdata(int rgb, float RV, float GV, float BV,
+                                          int interval, int cnt, struct output* out)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return getLUTdata_ctx(process_default_context(), rgb, RV, GV, BV, interval, cnt, out);
+    }
+
+    __declspec(dllexport) bool pg_off()
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return pg_off_ctx(process_default_context());
+    }
+
+    __declspec(dllexport) bool meas_off()
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return meas_off_ctx(process_default_context());
+    }
+
+    __declspec(dllexport) bool cleanup_all_devices()
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        bool result = cleanup_all_devices_ctx(process_default_context());
+
+        //26.10.16 - 배치용 작업 스레드도 종료 (프로그램 종료 시 스레드 잔존 방지)
+        process_shutdown_thread_pool();
+
+        return result;
+    }
+
+    __declspec(dllexport) void get_port_state(struct port_state* state)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        get_port_state_ctx(process_default_context(), state);
+    }
+
 } // extern "C"
 
 // C++ 내부 함수 - LUT 계산 로직
+//26.10.16 - 유효점 4개 이상이면 black 포함 전체 모델 적합 (process_lut_fit)
+//            그 외에는 로그-앵커 회귀 (lut_accumulator, 적합 초기값과 동일)
 void cal_lut(std::vector<LUT_Data> pattern_inf[3], struct output* out)
 {
     if (!out) return;
 
-    float max_index_val = 0.0f;
-    float max_lumi_val = 0.0f;
-    float gamma_val = 1.0f;
-    float black_val = 0.0f;
-
     for (int ch = 0; ch < 3; ++ch)
     {
-        // 각 채널마다 기본값으로 초기화
-        max_index_val = 0.0f;
-        max_lumi_val = 0.0f;
-        gamma_val = 1.0f;
-        black_val = 0.0f;
-
         const auto& vec = pattern_inf[ch];
         if (vec.empty()) {
-            out->lut[ch].max_index = max_index_val;
-            out->lut[ch].max_lumi = max_lumi_val;
-            out->lut[ch].gamma = gamma_val;
-            out->lut[ch].black = black_val;
-            continue;
-        }
-
-        // 1) 마지막 유효점 찾기
-        int anchor = -1;
-        for (int i = (int)vec.size() - 1; i >= 0; --i) {
-            if (vec[i].index > 0 && vec[i].luminance > 0.0) {
-                anchor = i;
-                break;
-            }
-        }
-
-        if (anchor < 0) {
-            out->lut[ch].max_index = max_index_val;
-            out->lut[ch].max_lumi = max_lumi_val;
-            out->lut[ch].gamma = gamma_val;
-            out->lut[ch].black = black_val;
+            out->lut[ch] = lut_accumulator().result();
             continue;
         }
-
-        double Xmax = static_cast<double>(vec[anchor].index);
-        double Ymax = vec[anchor].luminance;
-        max_index_val = static_cast<float>(Xmax);
-        max_lumi_val = static_cast<float>(Ymax);
-
-        // 2) 로그-앵커 회귀로 gamma 추정
-        if (Xmax > 0.0 && Ymax > 0.0) {
-            const double xM = std::log(Xmax);
-            const double yM = std::log(Ymax);
-            double num = 0.0;
-            double den = 0.0;
-            int used = 0;
-
-            for (const auto& p : vec) {
-                if (p.index <= 0 || p.luminance <= 0.0) continue;
-                const double xi = std::log(static_cast<double>(p.index));
-                const double yi = std::log(p.luminance);
-                const double dx = xi - xM;
-                const double dy = yi - yM;
-                num += dx * dy;
-                den += dx * dx;
-                ++used;
-            }
-
-            if (used >= 2 && std::fabs(den) > 1e-12) {
-                gamma_val = static_cast<float>(num / den);
-            }
-            else {
-                gamma_val = 1.0f;
-            }
-        }
-        else {
-            gamma_val = 1.0f;
-        }
-
-        // 3) 결과 기록
-        out->lut[ch].max_index = max_index_val;
-        out->lut[ch].max_lumi = max_lumi_val;
-        out->lut[ch].gamma = gamma_val;
-        out->lut[ch].black = black_val;
+        process_lut_fit(vec.data(), (int)vec.size(), &out->lut[ch]);
     }
 }
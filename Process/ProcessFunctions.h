@@ -53,6 +53,43 @@ extern "C" {
     /// </summary>
     __declspec(dllexport) void get_port_state(struct port_state* state);
 
+    // ===== Zone별 컨텍스트 API (26.10.16 - 전역 상태 제거) =====
+    // 컨텍스트마다 포트 상태/난수 생성기/작업 버퍼를 별도로 가지므로
+    // 서로 다른 컨텍스트로의 호출은 Lock 없이 병렬 실행 가능
+    // (같은 컨텍스트를 여러 스레드에서 동시에 사용하는 것은 허용되지 않음)
+    // 위의 기존 함수들은 기본 컨텍스트(zone 0)에 대한 래퍼이며, 여러 스레드에서 동시에 불러도 되도록
+    // 호출마다 내부 잠금으로 직렬화됨 (Zone 병렬 처리가 필요하면 Zone별 컨텍스트 사용)
+
+    typedef struct process_context process_context;
+
+    /// <summary>
+    /// Zone 컨텍스트 생성 (실패 시 nullptr)
+    /// </summary>
+    __declspec(dllexport) process_context* process_create_context(int zone);
+
+    /// <summary>
+    /// Zone 컨텍스트 해제 (연결된 포트도 해제됨, nullptr 허용)
+    /// </summary>
+    __declspec(dllexport) void process_destroy_context(process_context* ctx);
+
+    __declspec(dllexport) int MTP_test_ctx(process_context* ctx, const struct input* in, struct output* out);
+    __declspec(dllexport) int IPVS_test_ctx(process_context* ctx, const struct input* in, struct output* out);
+
+    __declspec(dllexport) bool PGTurn_ctx(process_context* ctx, int port);
+    __declspec(dllexport) bool PGPattern_ctx(process_context* ctx, int pattern);
+    __declspec(dllexport) bool PGVoltagesnd_ctx(process_context* ctx, int RV, int GV, int BV);
+
+    __declspec(dllexport) bool Meas_Turn_ctx(process_context* ctx, int port);
+    __declspec(dllexport) bool Getdata_ctx(process_context* ctx, struct output* out);
+
+    __declspec(dllexport) bool getLUTdata_ctx(process_context* ctx, int rgb, float RV, float GV, float BV,
+                                              int interval, int cnt, struct output* out);
+
+    __declspec(dllexport) bool pg_off_ctx(process_context* ctx);
+    __declspec(dllexport) bool meas_off_ctx(process_context* ctx);
+    __declspec(dllexport) bool cleanup_all_devices_ctx(process_context* ctx);
+    __declspec(dllexport) void get_port_state_ctx(process_context* ctx, struct port_state* state);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,155 @@
+// ProcessHvi.cpp : HVI 다중 시퀀스 비트 평면 판정 구현
+
+#include "pch.h"
+#include "ProcessHvi.h"
+#include "ProcessContext.h"
+
+namespace {
+
+    const int MTP_SLOTS = 7 * 17;
+    const int IPVS_SLOTS = 7 * 10;
+
+    int popcount64(unsigned long long v)
+    {
+        v = v - ((v >> 1) & 0x5555555555555555ull);
+        v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+        v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return (int)((v * 0x0101010101010101ull) >> 56);
+    }
+
+    int kind_slots(int kind)
+    {
+        if (kind == HVI_KIND_MTP) return MTP_SLOTS;
+        if (kind == HVI_KIND_IPVS) return IPVS_SLOTS;
+        return 0;
+    }
+
+    // 슬롯 수 이후 비트 제거용 마스크 (워드 w)
+    unsigned long long valid_mask(int slots, int w)
+    {
+        const int bits = slots - w * 64;
+        if (bits >= 64) return ~0ull;
+        if (bits <= 0) return 0ull;
+        return (1ull << bits) - 1ull;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_pack_results(const struct output* out, int kind, struct result_planes* planes)
+    {
+        const int slots = kind_slots(kind);
+        if (out == nullptr || planes == nullptr || slots == 0) {
+            return false;
+        }
+
+        const struct pattern* src = (kind == HVI_KIND_MTP) ? &out->data[0][0] : &out->IPVS_data[0][0];
+        result_planes p = result_planes();
+        p.slots = slots;
+        for (int s = 0; s < slots; ++s) {
+            const unsigned long long bit = 1ull << (s & 63);
+            const int result = src[s].result;
+            if (result == 2) p.ptn[s >> 6] |= bit;
+            else if (result != 0) p.ng[s >> 6] |= bit;
+        }
+
+        *planes = p;
+        return true;
+    }
+
+    __declspec(dllexport) bool process_hvi_aggregate(const struct result_planes* planes, int n, int ok_threshold,
+                                                     int ptn_threshold, struct judge_counts* counts, int* worst)
+    {
+        if (planes == nullptr || n <= 0) {
+            return false;
+        }
+
+        const int slots = planes[0].slots;
+        if (slots != MTP_SLOTS && slots != IPVS_SLOTS) {
+            return false;
+        }
+        if (ok_threshold <= 0 || ptn_threshold <= 0) {
+            judge_thresholds(nullptr, slots == IPVS_SLOTS, &ok_threshold, &ptn_threshold);
+        }
+
+        // 시퀀스별 OK/PTN 개수 합계 + 슬롯별 NG/PTN 합집합
+        unsigned long long any_ng[2] = { 0, 0 }, any_ptn[2] = { 0, 0 };
+        int not_ok = 0, ptn = 0;
+        for (int i = 0; i < n; ++i) {
+            const result_planes& p = planes[i];
+            if (p.slots != slots) {
+                return false;
+            }
+            for (int w = 0; w < 2; ++w) {
+                const unsigned long long m = valid_mask(slots, w);
+                const unsigned long long ng_w = p.ng[w] & m, ptn_w = p.ptn[w] & m;
+                not_ok += popcount64(ng_w | ptn_w);
+                ptn += popcount64(ptn_w);
+                any_ng[w] |= ng_w;
+                any_ptn[w] |= ptn_w;
+            }
+        }
+
+        if (counts != nullptr) {
+            judge_counts c;
+            c.ok = n * slots - not_ok;
+            c.ptn = ptn;
+            c.ng = not_ok - ptn;
+            if (c.ok >= ok_threshold * n) c.verdict = 0;
+            else if (c.ptn >= ptn_threshold * n) c.verdict = 2;
+            else c.verdict = 1;
+            *counts = c;
+        }
+
+        if (worst != nullptr) {
+            for (int s = 0; s < slots; ++s) {
+                const unsigned long long bit = 1ull << (s & 63);
+                worst[s] = (any_ng[s >> 6] & bit) ? 1 : ((any_ptn[s >> 6] & bit) ? 2 : 0);
+            }
+        }
+        return true;
+    }
+
+    __declspec(dllexport) int process_hvi_record_ctx(process_context* ctx, const struct output* out, int kind)
+    {
+        result_planes p;
+        if (ctx == nullptr || !process_pack_results(out, kind, &p)) {
+            return -1;
+        }
+
+        ctx->hvi_planes[kind].push_back(p);
+        return (int)ctx->hvi_planes[kind].size();
+    }
+
+    __declspec(dllexport) int process_hvi_count_ctx(process_context* ctx, int kind)
+    {
+        if (ctx == nullptr || kind_slots(kind) == 0) {
+            return 0;
+        }
+        return (int)ctx->hvi_planes[kind].size();
+    }
+
+    __declspec(dllexport) bool process_hvi_judge_ctx(process_context* ctx, int kind, struct judge_counts* counts,
+                                                     int* worst)
+    {
+        if (ctx == nullptr || kind_slots(kind) == 0 || ctx->hvi_planes[kind].empty()) {
+            return false;
+        }
+
+        int ok_threshold, ptn_threshold;
+        judge_thresholds(ctx->judge.get(), kind == HVI_KIND_IPVS, &ok_threshold, &ptn_threshold);
+
+        const std::vector<result_planes>& planes = ctx->hvi_planes[kind];
+        return process_hvi_aggregate(planes.data(), (int)planes.size(), ok_threshold, ptn_threshold, counts, worst);
+    }
+
+    __declspec(dllexport) void process_hvi_reset_ctx(process_context* ctx)
+    {
+        if (ctx == nullptr) {
+            return;
+        }
+        ctx->hvi_planes[HVI_KIND_MTP].clear();
+        ctx->hvi_planes[HVI_KIND_IPVS].clear();
+    }
+
+} // extern "C"
@@ -0,0 +1,68 @@
+#pragma once
+// ProcessHvi.h : HVI 다중 시퀀스 판정 - 시퀀스별 결과를 비트 평면으로 압축 보관
+// 슬롯별 결과 코드(0:OK, 1:NG, 2:PTN)를 2비트로 나누어 ng/ptn 평면에 기록
+//   OK = (ng 0, ptn 0),  NG = (1, 0),  PTN = (0, 1)  - 그 외 코드는 NG로 취급
+//   MTP 119 슬롯(wad × 17 + 패턴), IPVS 70 슬롯(wad × 10 + 포인트) → 평면당 64비트 워드 2개
+// Zone 판정은 OpticJudgment.JudgeZoneFromResults_HVI와 같음
+//   OK 합계 >= OK_THRESHOLD × 시퀀스 수 → OK,  PTN 합계 >= PTN_THRESHOLD × 시퀀스 수 → PTN,  나머지 NG
+// 슬롯별 최악 코드: 어느 시퀀스든 NG가 있으면 NG, 없고 PTN이 있으면 PTN, 나머지 OK
+// 집계는 워드 단위 OR + popcount (시퀀스 수 × 워드 4개)
+
+#include "ProcessJudge.h"
+
+#define HVI_KIND_MTP    0
+#define HVI_KIND_IPVS   1
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 시퀀스 1개의 결과 평면
+    struct result_planes {
+        unsigned long long ng[2];           // bit s: 슬롯 s가 NG
+        unsigned long long ptn[2];          // bit s: 슬롯 s가 PTN
+        int slots;                          // 슬롯 수 (MTP 119, IPVS 70)
+    };
+
+    // ===== HVI 비트 평면 판정 (26.10.16) =====
+
+    /// <summary>
+    /// output의 결과 코드를 평면으로 압축 (kind: HVI_KIND_MTP / HVI_KIND_IPVS)
+    /// </summary>
+    __declspec(dllexport) bool process_pack_results(const struct output* out, int kind, struct result_planes* planes);
+
+    /// <summary>
+    /// n개 시퀀스 평면 집계 - Zone 판정과 슬롯별 최악 코드(worst[slots], nullptr 허용) 기록
+    /// 임계값은 시퀀스 1개 기준 (0 이하: 기본 스펙 MTP 100/13, IPVS 5/2)
+    /// </summary>
+    __declspec(dllexport) bool process_hvi_aggregate(const struct result_planes* planes, int n, int ok_threshold,
+                                                     int ptn_threshold, struct judge_counts* counts, int* worst);
+
+    /// <summary>
+    /// 현재 시퀀스 결과를 Zone 컨텍스트에 추가 - 추가 후 시퀀스 수 반환 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_hvi_record_ctx(process_context* ctx, const struct output* out, int kind);
+
+    /// <summary>
+    /// 기록된 시퀀스 수
+    /// </summary>
+    __declspec(dllexport) int process_hvi_count_ctx(process_context* ctx, int kind);
+
+    /// <summary>
+    /// 기록된 시퀀스 전체 집계 (임계값: 설정된 스펙 또는 기본값) - 기록이 없으면 false
+    /// </summary>
+    __declspec(dllexport) bool process_hvi_judge_ctx(process_context* ctx, int kind, struct judge_counts* counts,
+                                                     int* worst);
+
+    /// <summary>
+    /// 기록된 시퀀스 초기화 (셀 시작 시)
+    /// </summary>
+    __declspec(dllexport) void process_hvi_reset_ctx(process_context* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
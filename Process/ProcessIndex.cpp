@@ -0,0 +1,509 @@
+// ProcessIndex.cpp : 보관 파일 결과 CELL_ID / INNER_ID 색인 구현
+
+#include "pch.h"
+#include "ProcessIndex.h"
+#include "ProcessMappedFile.h"
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace {
+    const uint32_t INDEX_MAGIC = 0x5849584F;       // 'OXIX'
+    const uint32_t INDEX_VERSION = 1;
+    const uint32_t STATE_CLEAN = 0;
+    const uint32_t STATE_OPEN = 1;                  // 쓰기 중 (정상 종료 시 CLEAN)
+
+    const int MAX_FILES = 256;
+    const int PATH_SIZE = 496;
+    const uint64_t INITIAL_CAPACITY = 4096;         // 2의 거듭제곱
+
+#pragma pack(push, 1)
+    struct index_header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t state;
+        uint32_t files;         // 등록된 보관 파일 수
+        uint64_t capacity;      // 슬롯 수 (2의 거듭제곱)
+        uint64_t count;         // 사용 중 슬롯 수
+        uint64_t slot_offset;   // 슬롯 영역 오프셋
+        uint8_t reserved[24];
+    };
+
+    struct index_file {
+        char path[PATH_SIZE];
+        int64_t indexed_rows;   // 색인 완료 행 수 ([0, indexed_rows))
+        uint8_t reserved[8];
+    };
+
+    struct index_slot {
+        uint64_t hash;          // 0: 빈 슬롯 (마지막에 기록)
+        int64_t row;
+        int64_t offset;
+        int32_t file_id;
+        int32_t zone;
+        int32_t sequence;
+        uint8_t kind;
+        uint8_t reserved[11];
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(index_header) == 64, "index_header는 64바이트여야 함");
+    static_assert(sizeof(index_file) == 512, "index_file은 512바이트여야 함");
+    static_assert(sizeof(index_slot) == 48, "index_slot은 48바이트여야 함");
+
+    const uint64_t SLOT_OFFSET = mapped_align_up(sizeof(index_header) + sizeof(index_file) * MAX_FILES);
+
+    // FNV-1a 64 (키 종류 + ID, 0은 빈 슬롯 표시이므로 1로 대체)
+    uint64_t key_hash(int kind, const char* id)
+    {
+        uint64_t h = 1469598103934665603ULL;
+        h = (h ^ (uint8_t)kind) * 1099511628211ULL;
+        for (int i = 0; i < 255 && id[i] != '\0'; ++i) {
+            h = (h ^ (uint8_t)id[i]) * 1099511628211ULL;
+        }
+        return h != 0 ? h : 1;
+    }
+}
+
+// 색인 핸들 (DLL 내부 전용)
+struct process_index {
+    std::mutex lock;
+    mapped_file file;
+    uint8_t* base;
+    size_t mapped;
+    std::vector<process_archive*> readers;  // 파일 번호별 읽기 핸들 (필요 시 열기)
+
+    index_header* header() { return reinterpret_cast<index_header*>(base); }
+    index_file* files() { return reinterpret_cast<index_file*>(base + sizeof(index_header)); }
+    index_slot* slots() { return reinterpret_cast<index_slot*>(base + header()->slot_offset); }
+};
+
+namespace {
+
+    bool map_all(process_index* ix)
+    {
+        const int64_t size = ix->file.size();
+        if (size < (int64_t)SLOT_OFFSET) {
+            return false;
+        }
+        ix->base = (uint8_t*)ix->file.map(0, (size_t)size);
+        ix->mapped = ix->base != nullptr ? (size_t)size : 0;
+        return ix->base != nullptr;
+    }
+
+    void unmap_all(process_index* ix)
+    {
+        ix->file.unmap(ix->base, ix->mapped);
+        ix->base = nullptr;
+        ix->mapped = 0;
+    }
+
+    bool valid_header(process_index* ix)
+    {
+        const index_header* h = ix->header();
+        return h->magic == INDEX_MAGIC && h->version == INDEX_VERSION && h->slot_offset == SLOT_OFFSET &&
+               h->files <= (uint32_t)MAX_FILES && h->capacity >= INITIAL_CAPACITY &&
+               (h->capacity & (h->capacity - 1)) == 0 && h->count < h->capacity &&
+               h->slot_offset + h->capacity * sizeof(index_slot) <= ix->mapped;
+    }
+
+    // 빈 색인 파일 생성 (기존 내용 삭제)
+    bool init_file(process_index* ix)
+    {
+        unmap_all(ix);
+        if (!ix->file.resize(0) || !ix->file.resize((int64_t)(SLOT_OFFSET + INITIAL_CAPACITY * sizeof(index_slot))) ||
+            !map_all(ix)) {
+            return false;
+        }
+
+        index_header* h = ix->header();
+        h->version = INDEX_VERSION;
+        h->state = STATE_OPEN;
+        h->files = 0;
+        h->capacity = INITIAL_CAPACITY;
+        h->count = 0;
+        h->slot_offset = SLOT_OFFSET;
+        h->magic = INDEX_MAGIC;
+        return true;
+    }
+
+    void place(index_slot* slots, uint64_t capacity, const index_slot& entry)
+    {
+        uint64_t i = entry.hash & (capacity - 1);
+        while (slots[i].hash != 0) {
+            i = (i + 1) & (capacity - 1);
+        }
+        index_slot& s = slots[i];
+        s.row = entry.row;
+        s.offset = entry.offset;
+        s.file_id = entry.file_id;
+        s.zone = entry.zone;
+        s.sequence = entry.sequence;
+        s.kind = entry.kind;
+        s.hash = entry.hash;
+    }
+
+    // 용량 2배로 확장 후 재배치
+    bool grow(process_index* ix)
+    {
+        const uint64_t old_capacity = ix->header()->capacity;
+        std::vector<index_slot> entries;
+        entries.reserve((size_t)ix->header()->count);
+        for (uint64_t i = 0; i < old_capacity; ++i) {
+            if (ix->slots()[i].hash != 0) entries.push_back(ix->slots()[i]);
+        }
+
+        const uint64_t capacity = old_capacity * 2;
+        const int64_t old_size = (int64_t)ix->mapped;
+        unmap_all(ix);
+        if (!ix->file.resize((int64_t)(SLOT_OFFSET + capacity * sizeof(index_slot))) || !map_all(ix)) {
+            //26.10.16 - 확장 실패 (디스크 부족 등): 원래 크기로 되돌려 다시 매핑 - 기존 항목은 그대로 사용
+            ix->file.resize(old_size);
+            map_all(ix);
+            return false;
+        }
+
+        std::memset(ix->slots(), 0, (size_t)(capacity * sizeof(index_slot)));
+        for (const index_slot& e : entries) {
+            place(ix->slots(), capacity, e);
+        }
+        ix->header()->capacity = capacity;
+        return true;
+    }
+
+    bool insert(process_index* ix, const index_slot& entry)
+    {
+        index_header* h = ix->header();
+        if ((h->count + 1) * 10 > h->capacity * 7) {
+            if (!grow(ix)) return false;
+            h = ix->header();
+        }
+        place(ix->slots(), h->capacity, entry);
+        h->count++;
+        return true;
+    }
+
+    // 행 1개의 CELL_ID / INNER_ID 항목 추가 (빈 ID는 생략)
+    bool index_row(process_index* ix, int file_id, process_archive* archive, int64_t row)
+    {
+        archive_row info;
+        if (!process_archive_read_row(archive, row, &info, nullptr)) {
+            return false;
+        }
+
+        index_slot entry;
+        std::memset(&entry, 0, sizeof(entry));
+        entry.row = row;
+        entry.offset = archive_row_offset(archive, row);
+        entry.file_id = file_id;
+        entry.zone = info.zone;
+        entry.sequence = info.sequence;
+
+        const char* ids[2] = { info.CELL_ID, info.INNER_ID };
+        for (int kind = INDEX_KEY_CELL; kind <= INDEX_KEY_INNER; ++kind) {
+            if (ids[kind][0] == '\0') continue;
+            entry.kind = (uint8_t)kind;
+            entry.hash = key_hash(kind, ids[kind]);
+            if (!insert(ix, entry)) return false;
+        }
+        return true;
+    }
+
+    // 파일 번호의 읽기 핸들 (need_row가 아직 보이지 않으면 새 행 반영, -1: 항상 반영)
+    process_archive* reader(process_index* ix, int file_id, int64_t need_row = -1)
+    {
+        if (file_id < 0 || file_id >= (int)ix->header()->files) {
+            return nullptr;
+        }
+        if ((int)ix->readers.size() <= file_id) {
+            ix->readers.resize(file_id + 1, nullptr);
+        }
+        if (ix->readers[file_id] == nullptr) {
+            ix->readers[file_id] = process_archive_open_read(ix->files()[file_id].path);
+        }
+        else if (need_row < 0 || need_row >= process_archive_rows(ix->readers[file_id])) {
+            process_archive_refresh(ix->readers[file_id]);
+        }
+        return ix->readers[file_id];
+    }
+
+    // [indexed_rows, 현재 행 수) 색인
+    bool catch_up(process_index* ix, int file_id, process_archive* archive)
+    {
+        if (archive == nullptr) {
+            return false;
+        }
+
+        const int64_t rows = process_archive_rows(archive);
+        for (int64_t row = ix->files()[file_id].indexed_rows; row < rows; ++row) {
+            if (!index_row(ix, file_id, archive, row)) return false;
+            ix->files()[file_id].indexed_rows = row + 1;
+        }
+        return true;
+    }
+
+    int64_t rebuild(process_index* ix)
+    {
+        index_header* h = ix->header();
+        std::memset(ix->slots(), 0, (size_t)(h->capacity * sizeof(index_slot)));
+        h->count = 0;
+
+        // 열 수 없는 보관 파일은 건너뜀 (이동 / 삭제)
+        for (int f = 0; f < (int)h->files; ++f) {
+            ix->files()[f].indexed_rows = 0;
+            catch_up(ix, f, reader(ix, f));
+            h = ix->header();
+        }
+        return (int64_t)h->count;
+    }
+
+    // 위치 일치 항목 수집
+    void collect(process_index* ix, uint64_t hash, int kind, std::vector<index_location>* found)
+    {
+        const uint64_t capacity = ix->header()->capacity;
+        const index_slot* slots = ix->slots();
+        for (uint64_t i = hash & (capacity - 1); slots[i].hash != 0; i = (i + 1) & (capacity - 1)) {
+            const index_slot& s = slots[i];
+            if (s.hash != hash || s.kind != (uint8_t)kind) continue;
+
+            index_location loc;
+            loc.file_id = s.file_id;
+            loc.zone = s.zone;
+            loc.sequence = s.sequence;
+            loc.reserved = 0;
+            loc.row = s.row;
+            loc.offset = s.offset;
+            found->push_back(loc);
+        }
+    }
+
+    void close_readers(process_index* ix)
+    {
+        for (process_archive* ar : ix->readers) {
+            process_archive_close(ar);
+        }
+        ix->readers.clear();
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) process_index* process_index_open(const char* path)
+    {
+        process_index* ix = new (std::nothrow) process_index();
+        if (ix == nullptr) return nullptr;
+
+        ix->base = nullptr;
+        ix->mapped = 0;
+        if (!ix->file.open(path, true, true)) {
+            delete ix;
+            return nullptr;
+        }
+
+        bool ok;
+        if (!map_all(ix) || !valid_header(ix)) {
+            ok = init_file(ix);
+        }
+        else {
+            // 비정상 종료 후라면 보관 파일로 다시 구성
+            const bool crashed = ix->header()->state != STATE_CLEAN;
+            ix->header()->state = STATE_OPEN;
+            ok = !crashed || rebuild(ix) >= 0;
+        }
+
+        if (!ok || !ix->file.sync(ix->base, sizeof(index_header))) {
+            close_readers(ix);
+            unmap_all(ix);
+            delete ix;
+            return nullptr;
+        }
+        return ix;
+    }
+
+    __declspec(dllexport) void process_index_close(process_index* index)
+    {
+        if (index == nullptr) return;
+
+        if (index->base != nullptr && index->file.sync(index->base, index->mapped)) {
+            index->header()->state = STATE_CLEAN;
+            index->file.sync(index->base, sizeof(index_header));
+        }
+        close_readers(index);
+        unmap_all(index);
+        delete index;
+    }
+
+    __declspec(dllexport) int process_index_add_archive(process_index* index, const char* archive_path)
+    {
+        if (index == nullptr || archive_path == nullptr || archive_path[0] == '\0' ||
+            std::strlen(archive_path) >= (size_t)PATH_SIZE) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> guard(index->lock);
+        if (index->base == nullptr) return -1;   // 확장 후 다시 매핑하지 못한 경우
+        index_header* h = index->header();
+        int id = -1;
+        for (int f = 0; f < (int)h->files; ++f) {
+            if (std::strcmp(index->files()[f].path, archive_path) == 0) {
+                id = f;
+                break;
+            }
+        }
+
+        if (id < 0) {
+            if (h->files >= (uint32_t)MAX_FILES) {
+                return -1;
+            }
+            id = (int)h->files;
+            index_file& entry = index->files()[id];
+            std::memset(&entry, 0, sizeof(entry));
+            std::memcpy(entry.path, archive_path, std::strlen(archive_path));
+            h->files++;
+        }
+
+        catch_up(index, id, reader(index, id));
+        return id;
+    }
+
+    __declspec(dllexport) int process_index_archive_path(process_index* index, int file_id, char* path, int size)
+    {
+        if (index == nullptr) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> guard(index->lock);
+        if (index->base == nullptr) return -1;
+        if (file_id < 0 || file_id >= (int)index->header()->files) {
+            return -1;
+        }
+
+        const char* src = index->files()[file_id].path;
+        const int length = (int)std::strlen(src);
+        if (path != nullptr && size > 0) {
+            const int n = length < size - 1 ? length : size - 1;
+            std::memcpy(path, src, n);
+            path[n] = '\0';
+        }
+        return length;
+    }
+
+    __declspec(dllexport) bool process_index_record(process_index* index, int file_id, process_archive* archive,
+                                                    int64_t row)
+    {
+        if (index == nullptr || archive == nullptr || row < 0) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> guard(index->lock);
+        if (index->base == nullptr) return false;
+        if (file_id < 0 || file_id >= (int)index->header()->files) {
+            return false;
+        }
+
+        // 이미 색인된 행은 건너뛰고, 빠진 행이 있으면 함께 색인
+        // (확장 시 다시 매핑되므로 files()는 매번 다시 참조)
+        for (int64_t next = index->files()[file_id].indexed_rows; next <= row; ++next) {
+            if (!index_row(index, file_id, archive, next)) return false;
+            index->files()[file_id].indexed_rows = next + 1;
+        }
+        return true;
+    }
+
+    __declspec(dllexport) int64_t process_index_append(process_index* index, int file_id, process_archive* archive,
+                                                       const struct input* in, const struct output* out,
+                                                       int zone, int sequence, int judgment,
+                                                       int64_t start_ms, int64_t end_ms)
+    {
+        if (index == nullptr) {
+            return -1;
+        }
+
+        const int64_t row = process_archive_append(archive, in, out, zone, sequence, judgment, start_ms, end_ms);
+        if (row < 0 || !process_index_record(index, file_id, archive, row)) {
+            return -1;
+        }
+        return row;
+    }
+
+    __declspec(dllexport) int64_t process_index_rebuild(process_index* index)
+    {
+        if (index == nullptr) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> guard(index->lock);
+        if (index->base == nullptr) return -1;
+        return rebuild(index);
+    }
+
+    __declspec(dllexport) int process_index_lookup(process_index* index, const char* id, int kind,
+                                                   struct index_location* locations, int capacity)
+    {
+        if (index == nullptr || id == nullptr || (kind != INDEX_KEY_CELL && kind != INDEX_KEY_INNER)) {
+            return -1;
+        }
+
+        std::vector<index_location> found;
+        {
+            std::lock_guard<std::mutex> guard(index->lock);
+            if (index->base == nullptr) return -1;
+            collect(index, key_hash(kind, id), kind, &found);
+        }
+
+        for (int i = 0; i < (int)found.size() && i < capacity && locations != nullptr; ++i) {
+            locations[i] = found[i];
+        }
+        return (int)found.size();
+    }
+
+    __declspec(dllexport) int process_index_fetch(process_index* index, const char* id, int kind,
+                                                  struct output* outs, struct archive_row* infos,
+                                                  struct index_location* locations, int capacity)
+    {
+        if (index == nullptr || id == nullptr || (kind != INDEX_KEY_CELL && kind != INDEX_KEY_INNER)) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> guard(index->lock);
+        if (index->base == nullptr) return -1;
+        std::vector<index_location> found;
+        collect(index, key_hash(kind, id), kind, &found);
+
+        int matched = 0;
+        for (const index_location& loc : found) {
+            process_archive* ar = reader(index, loc.file_id, loc.row);
+            archive_row info;
+            if (ar == nullptr || !process_archive_read_row(ar, loc.row, &info, nullptr)) {
+                continue;
+            }
+
+            // 해시 충돌 배제 - ID 문자열 확인
+            const char* stored = (kind == INDEX_KEY_CELL) ? info.CELL_ID : info.INNER_ID;
+            if (std::strncmp(stored, id, 255) != 0) {
+                continue;
+            }
+
+            if (matched < capacity) {
+                if (outs != nullptr) process_archive_read_row(ar, loc.row, nullptr, &outs[matched]);
+                if (infos != nullptr) infos[matched] = info;
+                if (locations != nullptr) locations[matched] = loc;
+            }
+            matched++;
+        }
+        return matched;
+    }
+
+    __declspec(dllexport) int64_t process_index_count(process_index* index)
+    {
+        if (index == nullptr) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> guard(index->lock);
+        if (index->base == nullptr) return -1;
+        return (int64_t)index->header()->count;
+    }
+
+} // extern "C"
@@ -0,0 +1,109 @@
+#pragma once
+// ProcessIndex.h : 보관 파일(ProcessArchive) 결과의 CELL_ID / INNER_ID 색인
+// 재검사 셀이나 고객 문의 CELL_ID를 CSV 폴더 검색 없이 바로 찾기 위한 영구 해시 색인
+//
+// 파일 배치 (매핑, 64KB 정렬):
+//   [index_header 64B][보관 파일 목록 index_file × 256][정렬 패딩][index_slot × capacity]
+//   개방 주소법(선형 탐사) 해시 표 - 키 = FNV-1a 64(키 종류 + ID), 같은 키의 항목이 여러 개면 모두 저장 (재검사)
+//   채움률 70% 초과 시 용량 2배로 확장 후 재배치
+//
+// 손상 복구: 쓰기로 열 때 상태를 '사용 중'으로 표시하고 닫을 때 해제
+//   열 때 '사용 중'(비정상 종료)이거나 헤더가 맞지 않으면 보관 파일 목록의 행 정보만 읽어 다시 구성
+//   (행 정보 영역만 읽으므로 측정값 열은 접근하지 않음)
+// 한 핸들의 함수는 여러 스레드에서 호출 가능 (내부 잠금)
+
+#include "ProcessArchive.h"
+
+// 키 종류
+#define INDEX_KEY_CELL      0       // input.CELL_ID
+#define INDEX_KEY_INNER     1       // input.INNER_ID
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 결과 위치
+    struct index_location {
+        int32_t file_id;        // 보관 파일 번호 (process_index_add_archive 반환값)
+        int32_t zone;
+        int32_t sequence;
+        int32_t reserved;
+        int64_t row;            // 보관 파일 행 번호
+        int64_t offset;         // 보관 파일 내 행 정보(archive_row) 바이트 오프셋
+    };
+
+    typedef struct process_index process_index;
+
+    // ===== 색인 열기/닫기 (26.10.16) =====
+
+    /// <summary>
+    /// 색인 파일 열기 (없으면 생성, 손상 / 비정상 종료 시 자동 재구성) - 실패 시 nullptr
+    /// </summary>
+    __declspec(dllexport) process_index* process_index_open(const char* path);
+
+    /// <summary>
+    /// 닫기 (디스크 기록 후 정상 종료 표시)
+    /// </summary>
+    __declspec(dllexport) void process_index_close(process_index* index);
+
+    /// <summary>
+    /// 보관 파일 등록 - 파일 번호 반환 (이미 등록되어 있으면 기존 번호, 실패: -1)
+    /// 아직 색인되지 않은 기존 행도 함께 색인
+    /// </summary>
+    __declspec(dllexport) int process_index_add_archive(process_index* index, const char* archive_path);
+
+    /// <summary>
+    /// 등록된 보관 파일 경로 조회 - 경로 길이 반환 (없는 번호: -1)
+    /// </summary>
+    __declspec(dllexport) int process_index_archive_path(process_index* index, int file_id, char* path, int size);
+
+    // ===== 색인 갱신 =====
+
+    /// <summary>
+    /// 보관 파일에 기록된 행 1개 색인 (CELL_ID, INNER_ID 각 1항목) - 실패 시 false
+    /// </summary>
+    __declspec(dllexport) bool process_index_record(process_index* index, int file_id, process_archive* archive,
+                                                    int64_t row);
+
+    /// <summary>
+    /// 보관 파일에 결과 추가 + 색인 (MTP_test / IPVS_test 결과 저장 시) - 행 번호 반환 (실패: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_index_append(process_index* index, int file_id, process_archive* archive,
+                                                       const struct input* in, const struct output* out,
+                                                       int zone, int sequence, int judgment,
+                                                       int64_t start_ms, int64_t end_ms);
+
+    /// <summary>
+    /// 등록된 보관 파일 전체로 색인 재구성 - 색인 항목 수 반환 (실패: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_index_rebuild(process_index* index);
+
+    // ===== 조회 =====
+
+    /// <summary>
+    /// ID의 결과 위치 조회 (kind: INDEX_KEY_*) - 전체 일치 수 반환 (capacity개까지 기록)
+    /// 64비트 해시 일치로 판단 (ID 문자열 확인은 process_index_fetch)
+    /// </summary>
+    __declspec(dllexport) int process_index_lookup(process_index* index, const char* id, int kind,
+                                                   struct index_location* locations, int capacity);
+
+    /// <summary>
+    /// ID의 저장 결과 읽기 - ID 문자열까지 일치하는 결과 수 반환 (capacity개까지 기록, 인자 오류: -1)
+    /// outs / infos / locations 중 nullptr인 배열은 생략
+    /// </summary>
+    __declspec(dllexport) int process_index_fetch(process_index* index, const char* id, int kind,
+                                                  struct output* outs, struct archive_row* infos,
+                                                  struct index_location* locations, int capacity);
+
+    /// <summary>
+    /// 색인 항목 수 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_index_count(process_index* index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
@@ -0,0 +1,141 @@
+// ProcessIni.cpp : Recipe INI 파일 읽기 구현
+
+#include "pch.h"
+#include "ProcessIni.h"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+std::string ini_trim(const std::string& s)
+{
+    size_t b = 0;
+    size_t e = s.size();
+    while (b < e && std::isspace((unsigned char)s[b])) ++b;
+    while (e > b && std::isspace((unsigned char)s[e - 1])) --e;
+    return s.substr(b, e - b);
+}
+
+std::string ini_upper(const std::string& s)
+{
+    std::string r = s;
+    for (auto& c : r) c = (char)std::toupper((unsigned char)c);
+    return r;
+}
+
+std::vector<std::string> ini_split(const std::string& s, char delim)
+{
+    std::vector<std::string> parts;
+    size_t start = 0;
+    for (;;) {
+        size_t pos = s.find(delim, start);
+        parts.push_back(ini_trim(s.substr(start, pos == std::string::npos ? std::string::npos : pos - start)));
+        if (pos == std::string::npos) break;
+        start = pos + 1;
+    }
+    return parts;
+}
+
+bool process_ini::load(const char* path)
+{
+    m_sections.clear();
+    if (path == nullptr) return false;
+
+    FILE* fp = nullptr;
+#ifdef _WIN32
+    if (fopen_s(&fp, path, "rb") != 0) fp = nullptr;
+#else
+    fp = std::fopen(path, "rb");
+#endif
+    if (fp == nullptr) return false;
+
+    std::string text;
+    char buffer[4096];
+    size_t n;
+    while ((n = std::fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+        text.append(buffer, n);
+    }
+    std::fclose(fp);
+
+    load_text(text);
+    return true;
+}
+
+void process_ini::load_text(const std::string& text)
+{
+    m_sections.clear();
+
+    size_t pos = 0;
+    if (text.size() >= 3 && (unsigned char)text[0] == 0xEF && (unsigned char)text[1] == 0xBB &&
+        (unsigned char)text[2] == 0xBF) {
+        pos = 3;  // UTF-8 BOM
+    }
+
+    std::string current;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string::npos) end = text.size();
+        std::string line = ini_trim(text.substr(pos, end - pos));
+        pos = end + 1;
+
+        if (line.empty() || line[0] == ';' || line[0] == '#' || line.compare(0, 2, "//") == 0) {
+            continue;
+        }
+
+        if (line.front() == '[' && line.back() == ']') {
+            current = ini_upper(ini_trim(line.substr(1, line.size() - 2)));
+            m_sections[current];
+            continue;
+        }
+
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) continue;
+
+        std::string key = ini_trim(line.substr(0, eq));
+        std::string upper = ini_upper(key);
+        section_data& sec = m_sections[current];
+        if (sec.values.find(upper) == sec.values.end()) {
+            sec.order.push_back(key);
+            sec.values[upper] = ini_trim(line.substr(eq + 1));  // GetPrivateProfileString과 같이 첫 항목 우선
+        }
+    }
+}
+
+bool process_ini::has_section(const std::string& section) const
+{
+    return m_sections.find(ini_upper(section)) != m_sections.end();
+}
+
+std::string process_ini::get(const std::string& section, const std::string& key, const std::string& def) const
+{
+    auto sec = m_sections.find(ini_upper(section));
+    if (sec == m_sections.end()) return def;
+
+    auto it = sec->second.values.find(ini_upper(key));
+    return it != sec->second.values.end() ? it->second : def;
+}
+
+int process_ini::get_int(const std::string& section, const std::string& key, int def) const
+{
+    std::string v = get(section, key);
+    if (v.empty()) return def;
+
+    char* end = nullptr;
+    long r = std::strtol(v.c_str(), &end, 10);
+    return (end != v.c_str() && *end == '\0') ? (int)r : def;
+}
+
+double process_ini::get_double(const std::string& section, const std::string& key, double def) const
+{
+    std::string v = get(section, key);
+    if (v.empty()) return def;
+
+    char* end = nullptr;
+    double r = std::strtod(v.c_str(), &end);
+    return (end != v.c_str() && *end == '\0') ? r : def;
+}
+
+std::vector<std::string> process_ini::keys(const std::string& section) const
+{
+    auto sec = m_sections.find(ini_upper(section));
+    return sec != m_sections.end() ? sec->second.order : std::vector<std::string>();
+}
@@ -0,0 +1,39 @@
+#pragma once
+// ProcessIni.h : Recipe INI 파일 읽기 (DLL 내부 전용)
+// C# IniFileManager(GetPrivateProfileString)와 같은 규칙: 섹션/키 대소문자 무시, 값 앞뒤 공백 제거
+// '//', ';', '#' 으로 시작하는 줄은 주석으로 처리
+
+#include <map>
+#include <string>
+#include <vector>
+
+class process_ini {
+public:
+    // 파일 읽기 (실패 시 false, 기존 내용은 비워짐)
+    bool load(const char* path);
+
+    // 문자열에서 읽기 (시퀀스 텍스트 직접 전달 등)
+    void load_text(const std::string& text);
+
+    bool has_section(const std::string& section) const;
+
+    std::string get(const std::string& section, const std::string& key, const std::string& def = "") const;
+    int get_int(const std::string& section, const std::string& key, int def) const;
+    double get_double(const std::string& section, const std::string& key, double def) const;
+
+    // 섹션의 키 목록 (파일에 나온 순서)
+    std::vector<std::string> keys(const std::string& section) const;
+
+private:
+    struct section_data {
+        std::vector<std::string> order;
+        std::map<std::string, std::string> values;  // 키: 대문자
+    };
+
+    std::map<std::string, section_data> m_sections;  // 섹션명: 대문자
+};
+
+// 문자열 유틸리티
+std::string ini_trim(const std::string& s);
+std::string ini_upper(const std::string& s);
+std::vector<std::string> ini_split(const std::string& s, char delim);  // 각 항목 trim
@@ -0,0 +1,515 @@
+// ProcessJournal.cpp : Zone별 선기록 로그 구현
+
+#include "pch.h"
+#include "ProcessJournal.h"
+#include "ProcessDirty.h"
+#include "ProcessMappedFile.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    const uint32_t RECORD_MAGIC = 0x524A584F;      // 'OXJR'
+    const int DEFAULT_INTERVAL_MS = 10;
+    const int DEFAULT_COMMIT_BYTES = 256 * 1024;
+
+#pragma pack(push, 1)
+    struct record_header {
+        uint32_t magic;
+        uint32_t crc;           // type ~ payload 범위 CRC-32
+        uint32_t type;
+        uint32_t length;        // payload 바이트 수
+        int64_t lsn;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(record_header) == 24, "record_header는 24바이트여야 함");
+
+    const size_t CRC_OFFSET = 8;                    // crc 계산 시작 (type)
+    const uint32_t MAX_PAYLOAD = (uint32_t)(sizeof(struct output_dirty) + sizeof(struct output));
+
+    // CRC-32 (IEEE 802.3, 반사 다항식 0xEDB88320)
+    const uint32_t* crc_table()
+    {
+        static uint32_t table[256];
+        static bool ready = [] {
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+                table[i] = c;
+            }
+            return true;
+        }();
+        (void)ready;
+        return table;
+    }
+
+    uint32_t crc32_update(uint32_t crc, const uint8_t* p, size_t n)
+    {
+        const uint32_t* t = crc_table();
+        crc = ~crc;
+        for (size_t i = 0; i < n; ++i) crc = t[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    std::string zone_path(const std::string& directory, int zone)
+    {
+        std::string path = directory;
+        if (!path.empty() && path.back() != '/' && path.back() != '\\') path += '/';
+        return path + "zone_" + std::to_string(zone) + ".wal";
+    }
+
+    bool sync_file(FILE* fp)
+    {
+        if (std::fflush(fp) != 0) return false;
+#ifdef _WIN32
+        return _commit(_fileno(fp)) == 0;
+#else
+        return fsync(fileno(fp)) == 0;
+#endif
+    }
+
+    // 열린 로그 파일을 0바이트로 자르고 디스크에 기록 (추가 모드이므로 이후 기록은 파일 처음부터)
+    bool truncate_file(FILE* fp)
+    {
+        if (std::fflush(fp) != 0) return false;
+#ifdef _WIN32
+        if (_chsize_s(_fileno(fp), 0) != 0) return false;
+#else
+        if (ftruncate(fileno(fp), 0) != 0) return false;
+#endif
+        return sync_file(fp);
+    }
+
+    // 레코드 1개를 버퍼 끝에 추가 (payload는 이미 buf에 이어서 기록된 상태)
+    void seal_record(std::vector<uint8_t>* buf, size_t start, uint32_t type, int64_t lsn)
+    {
+        record_header* h = reinterpret_cast<record_header*>(buf->data() + start);
+        h->magic = RECORD_MAGIC;
+        h->type = type;
+        h->length = (uint32_t)(buf->size() - start - sizeof(record_header));
+        h->lsn = lsn;
+        h->crc = crc32_update(0, buf->data() + start + CRC_OFFSET, buf->size() - start - CRC_OFFSET);
+    }
+
+    void put(std::vector<uint8_t>* buf, const void* p, size_t n)
+    {
+        const uint8_t* b = static_cast<const uint8_t*>(p);
+        buf->insert(buf->end(), b, b + n);
+    }
+
+    // 변경분 직렬화 - mask 뒤에 표시된 pattern / lut_parameter를 영역 순서대로
+    void put_delta(std::vector<uint8_t>* buf, const struct output* out, const struct output_dirty& mask)
+    {
+        put(buf, &mask, sizeof(mask));
+        for (int w = 0; w < 7; ++w) {
+            for (int j = 0; j < 17; ++j) {
+                if (mask.data[w] & (1u << j)) put(buf, &out->data[w][j], sizeof(struct pattern));
+            }
+        }
+        for (int w = 0; w < 7; ++w) {
+            for (int p = 0; p < 10; ++p) {
+                if (mask.IPVS_data[w] & (1u << p)) put(buf, &out->IPVS_data[w][p], sizeof(struct pattern));
+            }
+        }
+        for (int w = 0; w < 7; ++w) {
+            if (mask.measure & (1u << w)) put(buf, &out->measure[w], sizeof(struct pattern));
+        }
+        for (int c = 0; c < 3; ++c) {
+            if (mask.lut & (1u << c)) put(buf, &out->lut[c], sizeof(struct lut_parameter));
+        }
+    }
+
+    // 변경분 적용 (길이가 맞지 않으면 false)
+    bool apply_delta(const uint8_t* p, uint32_t length, struct output* out)
+    {
+        struct output_dirty mask;
+        if (length < sizeof(mask)) return false;
+        std::memcpy(&mask, p, sizeof(mask));
+        if (length != sizeof(mask) + (uint32_t)process_dirty_bytes(&mask)) return false;
+        p += sizeof(mask);
+
+        for (int w = 0; w < 7; ++w) {
+            for (int j = 0; j < 17; ++j) {
+                if (!(mask.data[w] & (1u << j))) continue;
+                std::memcpy(&out->data[w][j], p, sizeof(struct pattern));
+                p += sizeof(struct pattern);
+            }
+        }
+        for (int w = 0; w < 7; ++w) {
+            for (int k = 0; k < 10; ++k) {
+                if (!(mask.IPVS_data[w] & (1u << k))) continue;
+                std::memcpy(&out->IPVS_data[w][k], p, sizeof(struct pattern));
+                p += sizeof(struct pattern);
+            }
+        }
+        for (int w = 0; w < 7; ++w) {
+            if (!(mask.measure & (1u << w))) continue;
+            std::memcpy(&out->measure[w], p, sizeof(struct pattern));
+            p += sizeof(struct pattern);
+        }
+        for (int c = 0; c < 3; ++c) {
+            if (!(mask.lut & (1u << c))) continue;
+            std::memcpy(&out->lut[c], p, sizeof(struct lut_parameter));
+            p += sizeof(struct lut_parameter);
+        }
+        return true;
+    }
+
+    bool read_file(const std::string& path, std::vector<uint8_t>* data)
+    {
+        FILE* fp = std::fopen(path.c_str(), "rb");
+        if (fp == nullptr) return false;
+
+        uint8_t block[65536];
+        size_t n;
+        while ((n = std::fread(block, 1, sizeof(block), fp)) > 0) {
+            data->insert(data->end(), block, block + n);
+        }
+        std::fclose(fp);
+        return true;
+    }
+
+    // 로그 순회 - 레코드마다 fn(header, payload), 유효한 마지막 레코드 끝 오프셋 반환
+    template <typename Fn>
+    size_t scan(const std::vector<uint8_t>& data, Fn fn)
+    {
+        size_t pos = 0;
+        while (pos + sizeof(record_header) <= data.size()) {
+            record_header h;
+            std::memcpy(&h, data.data() + pos, sizeof(h));
+            if (h.magic != RECORD_MAGIC || h.length > MAX_PAYLOAD ||
+                pos + sizeof(h) + h.length > data.size() ||
+                crc32_update(0, data.data() + pos + CRC_OFFSET, sizeof(h) - CRC_OFFSET + h.length) != h.crc) {
+                break;
+            }
+            fn(h, data.data() + pos + sizeof(h));
+            pos += sizeof(h) + h.length;
+        }
+        return pos;
+    }
+}
+
+// 로그 핸들 (DLL 내부 전용)
+struct process_journal {
+    std::string directory;
+    int zones;
+    int interval_ms;
+    size_t commit_bytes;
+
+    std::mutex io;                          // 파일 기록 (커밋 / checkpoint) - 항상 lock보다 먼저 잠금
+    std::mutex lock;                        // 버퍼 / LSN 상태
+    std::condition_variable wake;           // 커밋 스레드 깨우기
+    std::condition_variable committed;      // 커밋 완료 알림
+
+    std::vector<FILE*> files;               // Zone별 로그 파일 (추가 모드)
+    std::vector<std::vector<uint8_t>> pending;  // Zone별 미커밋 레코드
+    size_t pending_bytes;
+    int64_t next_lsn;
+    int64_t durable_lsn;
+    bool urgent;                            // 즉시 커밋 요청
+    bool stop;
+    bool failed;                            // 기록 / fsync 실패 (이후 wait는 false)
+    std::thread worker;
+};
+
+namespace {
+
+    // 버퍼 교체 후 기록 + fsync (io 잠금 상태에서 호출)
+    void commit_once(process_journal* j)
+    {
+        std::vector<std::vector<uint8_t>> batch(j->zones);
+        int64_t target;
+        {
+            std::lock_guard<std::mutex> guard(j->lock);
+            batch.swap(j->pending);
+            j->pending.assign(j->zones, std::vector<uint8_t>());
+            j->pending_bytes = 0;
+            j->urgent = false;
+            target = j->next_lsn - 1;
+        }
+
+        bool ok = true;
+        for (int z = 0; z < j->zones; ++z) {
+            if (batch[z].empty()) continue;
+            ok = ok && j->files[z] != nullptr;
+            ok = ok && std::fwrite(batch[z].data(), 1, batch[z].size(), j->files[z]) == batch[z].size();
+            ok = ok && sync_file(j->files[z]);
+        }
+
+        std::lock_guard<std::mutex> guard(j->lock);
+        if (ok) {
+            if (target > j->durable_lsn) j->durable_lsn = target;
+        }
+        else {
+            j->failed = true;
+        }
+        j->committed.notify_all();
+    }
+
+    void commit_loop(process_journal* j)
+    {
+        for (;;) {
+            bool stopping;
+            {
+                std::unique_lock<std::mutex> guard(j->lock);
+                j->wake.wait_for(guard, std::chrono::milliseconds(j->interval_ms), [j] {
+                    return j->stop || j->urgent || j->pending_bytes >= j->commit_bytes;
+                });
+                stopping = j->stop;
+            }
+
+            std::lock_guard<std::mutex> io(j->io);
+            commit_once(j);
+            if (stopping) return;
+        }
+    }
+
+    // 잘린 꼬리 제거 후 다음 LSN 계산
+    bool prepare_zone(const std::string& path, int64_t* max_lsn)
+    {
+        std::vector<uint8_t> data;
+        if (!read_file(path, &data)) {
+            return true;    // 새 로그
+        }
+
+        const size_t valid = scan(data, [max_lsn](const record_header& h, const uint8_t*) {
+            if (h.lsn > *max_lsn) *max_lsn = h.lsn;
+        });
+        if (valid == data.size()) {
+            return true;
+        }
+
+        mapped_file f;
+        return f.open(path.c_str(), true, false) && f.resize((int64_t)valid);
+    }
+
+    int64_t enqueue(process_journal* j, int zone, uint32_t type, const std::vector<uint8_t>& payload)
+    {
+        std::lock_guard<std::mutex> guard(j->lock);
+        const int64_t lsn = j->next_lsn++;
+
+        std::vector<uint8_t>& buf = j->pending[zone];
+        const size_t start = buf.size();
+        buf.resize(start + sizeof(record_header));
+        buf.insert(buf.end(), payload.begin(), payload.end());
+        seal_record(&buf, start, type, lsn);
+
+        j->pending_bytes += buf.size() - start;
+        if (j->pending_bytes >= j->commit_bytes) {
+            j->wake.notify_one();
+        }
+        return lsn;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) process_journal* process_journal_open(const char* directory, int zones,
+                                                                int commit_interval_ms, int commit_bytes)
+    {
+        if (directory == nullptr || zones <= 0) {
+            return nullptr;
+        }
+
+        process_journal* j = new (std::nothrow) process_journal();
+        if (j == nullptr) return nullptr;
+
+        j->directory = directory;
+        j->zones = zones;
+        j->interval_ms = commit_interval_ms > 0 ? commit_interval_ms : DEFAULT_INTERVAL_MS;
+        j->commit_bytes = (size_t)(commit_bytes > 0 ? commit_bytes : DEFAULT_COMMIT_BYTES);
+        j->pending.assign(zones, std::vector<uint8_t>());
+        j->pending_bytes = 0;
+        j->urgent = j->stop = j->failed = false;
+
+        int64_t max_lsn = 0;
+        bool ok = true;
+        for (int z = 0; z < zones && ok; ++z) {
+            const std::string path = zone_path(j->directory, z);
+            ok = prepare_zone(path, &max_lsn);
+            FILE* fp = ok ? std::fopen(path.c_str(), "ab") : nullptr;
+            ok = fp != nullptr;
+            if (ok) j->files.push_back(fp);
+        }
+        if (!ok) {
+            for (FILE* fp : j->files) std::fclose(fp);
+            delete j;
+            return nullptr;
+        }
+
+        j->next_lsn = max_lsn + 1;
+        j->durable_lsn = max_lsn;
+        j->worker = std::thread(commit_loop, j);
+        return j;
+    }
+
+    __declspec(dllexport) void process_journal_close(process_journal* journal)
+    {
+        if (journal == nullptr) return;
+
+        {
+            std::lock_guard<std::mutex> guard(journal->lock);
+            journal->stop = true;
+            journal->wake.notify_one();
+        }
+        if (journal->worker.joinable()) {
+            journal->worker.join();
+        }
+        for (FILE* fp : journal->files) std::fclose(fp);
+        delete journal;
+    }
+
+    __declspec(dllexport) int64_t process_journal_begin(process_journal* journal, int zone, const struct input* in)
+    {
+        if (journal == nullptr || zone < 0 || zone >= journal->zones || in == nullptr) {
+            return -1;
+        }
+
+        std::vector<uint8_t> payload;
+        put(&payload, in, sizeof(struct input));
+        return enqueue(journal, zone, JOURNAL_REC_BEGIN, payload);
+    }
+
+    __declspec(dllexport) int64_t process_journal_append(process_journal* journal, int zone,
+                                                         const struct output* out, const struct output_dirty* mask)
+    {
+        if (journal == nullptr || zone < 0 || zone >= journal->zones || out == nullptr) {
+            return -1;
+        }
+
+        struct output_dirty m;
+        if (mask != nullptr) {
+            m = *mask;
+        }
+        else {
+            for (int w = 0; w < 7; ++w) {
+                m.data[w] = 0x1FFFFu;
+                m.IPVS_data[w] = 0x3FFu;
+            }
+            m.measure = 0x7Fu;
+            m.lut = 0x7u;
+        }
+        if (process_dirty_bytes(&m) == 0) {
+            return 0;
+        }
+
+        std::vector<uint8_t> payload;
+        payload.reserve(sizeof(m) + (size_t)process_dirty_bytes(&m));
+        put_delta(&payload, out, m);
+        return enqueue(journal, zone, JOURNAL_REC_DELTA, payload);
+    }
+
+    __declspec(dllexport) bool process_journal_wait(process_journal* journal, int64_t lsn, int timeout_ms)
+    {
+        if (journal == nullptr) {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> guard(journal->lock);
+        auto done = [journal, lsn] { return journal->failed || journal->durable_lsn >= lsn; };
+        if (timeout_ms < 0) {
+            journal->committed.wait(guard, done);
+        }
+        else {
+            journal->committed.wait_for(guard, std::chrono::milliseconds(timeout_ms), done);
+        }
+        return !journal->failed && journal->durable_lsn >= lsn;
+    }
+
+    __declspec(dllexport) bool process_journal_sync(process_journal* journal)
+    {
+        if (journal == nullptr) {
+            return false;
+        }
+
+        int64_t target;
+        {
+            std::lock_guard<std::mutex> guard(journal->lock);
+            target = journal->next_lsn - 1;
+            journal->urgent = true;
+            journal->wake.notify_one();
+        }
+        return process_journal_wait(journal, target, -1);
+    }
+
+    __declspec(dllexport) int64_t process_journal_durable_lsn(process_journal* journal)
+    {
+        if (journal == nullptr) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> guard(journal->lock);
+        return journal->durable_lsn;
+    }
+
+    __declspec(dllexport) bool process_journal_checkpoint(process_journal* journal, int zone)
+    {
+        if (journal == nullptr || zone < 0 || zone >= journal->zones) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> io(journal->io);
+        {
+            std::lock_guard<std::mutex> guard(journal->lock);
+            journal->pending_bytes -= journal->pending[zone].size();
+            journal->pending[zone].clear();
+        }
+
+        //26.10.16 - 열린 핸들 그대로 파일 비우기 (freopen은 실패 시 원래 핸들까지 닫아 이후 커밋이 null에 기록)
+        if (!truncate_file(journal->files[zone])) {
+            std::lock_guard<std::mutex> guard(journal->lock);
+            journal->failed = true;
+            return false;
+        }
+        return true;
+    }
+
+    __declspec(dllexport) int process_journal_recover(const char* directory, int zone,
+                                                      struct input* in, struct output* out)
+    {
+        if (directory == nullptr || zone < 0) {
+            return -1;
+        }
+
+        std::vector<uint8_t> data;
+        if (!read_file(zone_path(directory, zone), &data)) {
+            return -1;
+        }
+
+        struct input cell;
+        struct output state;
+        std::memset(&cell, 0, sizeof(cell));
+        std::memset(&state, 0, sizeof(state));
+        int applied = 0;
+
+        // 레코드 단위로 적용 (레코드 1개 = 완료된 단계 1개이므로 각 경계가 일관 상태)
+        scan(data, [&](const record_header& h, const uint8_t* payload) {
+            if (h.type == JOURNAL_REC_BEGIN && h.length == sizeof(struct input)) {
+                std::memcpy(&cell, payload, sizeof(cell));
+                std::memset(&state, 0, sizeof(state));
+                applied = 0;
+            }
+            else if (h.type == JOURNAL_REC_DELTA && apply_delta(payload, h.length, &state)) {
+                applied++;
+            }
+        });
+
+        if (in != nullptr) *in = cell;
+        if (out != nullptr) *out = state;
+        return applied;
+    }
+
+} // extern "C"
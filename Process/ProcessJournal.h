@@ -0,0 +1,88 @@
+#pragma once
+// ProcessJournal.h : Zone별 진행 중 결과 선기록 로그(write-ahead journal)
+// UI 프로세스가 종료 중 멈추거나 시퀀스 도중 비정상 종료되어도 SharedOutput에만 있던 결과를 복구하기 위함
+//
+// 파일: <directory>/zone_<n>.wal - 레코드를 이어서 기록
+//   레코드 = [magic 'OXJR'][crc32][type][length][lsn][payload(length)]   crc32는 type ~ payload 범위
+//   JOURNAL_REC_BEGIN : 셀 시작 (payload = struct input) - 복구 시 output을 0으로 초기화
+//   JOURNAL_REC_DELTA : 단계 완료 변경분 (payload = output_dirty + 표시된 pattern / lut_parameter를 순서대로)
+//
+// 그룹 커밋: append는 메모리 버퍼에만 추가하고 즉시 반환
+//   커밋 스레드가 commit_interval_ms마다 또는 버퍼가 commit_bytes 이상이면 모든 Zone 버퍼를 기록 후 fsync 1회
+//   (패턴마다 fsync하지 않음) - process_journal_wait(lsn)로 해당 레코드의 디스크 기록 확인
+//
+// 복구: process_journal_recover가 마지막 BEGIN 이후 CRC가 맞는 레코드까지 적용한 output을 반환
+//   중간에 잘린(기록 중 종료) 레코드부터는 버림 - process_journal_open도 잘린 꼬리를 잘라낸 뒤 이어서 기록
+// 셀 결과를 다른 곳(보관 파일, CSV)에 저장한 뒤 process_journal_checkpoint로 Zone 로그를 비움
+//
+// 주의: 커밋 스레드는 DLL 언로드 중 join하지 않도록 반드시 process_journal_close로 종료
+
+#include "ProcessFunctions.h"
+#include <stdint.h>
+
+// 레코드 종류
+#define JOURNAL_REC_BEGIN   1
+#define JOURNAL_REC_DELTA   2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    typedef struct process_journal process_journal;
+
+    // ===== 선기록 로그 (26.10.16) =====
+
+    /// <summary>
+    /// Zone 수만큼 로그 열기 (directory는 미리 존재해야 함, 잘린 꼬리 정리 후 이어서 기록) - 실패 시 nullptr
+    /// commit_interval_ms <= 0: 10ms, commit_bytes <= 0: 256KB
+    /// </summary>
+    __declspec(dllexport) process_journal* process_journal_open(const char* directory, int zones,
+                                                                int commit_interval_ms, int commit_bytes);
+
+    /// <summary>
+    /// 남은 버퍼 커밋 후 커밋 스레드 종료 및 해제
+    /// </summary>
+    __declspec(dllexport) void process_journal_close(process_journal* journal);
+
+    /// <summary>
+    /// 셀 시작 기록 - 레코드 LSN 반환 (실패: -1)
+    /// </summary>
+    __declspec(dllexport) int64_t process_journal_begin(process_journal* journal, int zone, const struct input* in);
+
+    /// <summary>
+    /// 단계 완료 변경분 기록 (mask: process_take_dirty 결과 또는 *_batch_dirty의 셀별 mask, nullptr이면 output 전체) - LSN 반환
+    /// 변경 영역이 없으면 0, 실패 시 -1
+    /// </summary>
+    __declspec(dllexport) int64_t process_journal_append(process_journal* journal, int zone,
+                                                         const struct output* out, const struct output_dirty* mask);
+
+    /// <summary>
+    /// lsn까지 디스크 기록 완료 대기 (timeout_ms < 0: 무한) - 완료되면 true
+    /// </summary>
+    __declspec(dllexport) bool process_journal_wait(process_journal* journal, int64_t lsn, int timeout_ms);
+
+    /// <summary>
+    /// 즉시 커밋 후 완료 대기 (로트 종료 / 프로그램 종료 시)
+    /// </summary>
+    __declspec(dllexport) bool process_journal_sync(process_journal* journal);
+
+    /// <summary>
+    /// 디스크 기록이 완료된 마지막 LSN
+    /// </summary>
+    __declspec(dllexport) int64_t process_journal_durable_lsn(process_journal* journal);
+
+    /// <summary>
+    /// Zone 로그 비우기 (셀 결과를 다른 곳에 저장한 뒤) - 아직 커밋되지 않은 Zone 레코드도 버림
+    /// </summary>
+    __declspec(dllexport) bool process_journal_checkpoint(process_journal* journal, int zone);
+
+    /// <summary>
+    /// Zone 로그에서 마지막 일관 상태 복구 (in / out: nullptr 허용)
+    /// 마지막 BEGIN 이후 적용한 DELTA 수 반환 (BEGIN도 없이 비어 있으면 0, 로그 없음: -1)
+    /// </summary>
+    __declspec(dllexport) int process_journal_recover(const char* directory, int zone,
+                                                      struct input* in, struct output* out);
+
+#ifdef __cplusplus
+}
+#endif
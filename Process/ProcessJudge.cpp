@@ -0,0 +1,327 @@
+// ProcessJudge.cpp : 측정 결과 스펙 판정 구현
+
+#include "pch.h"
+#include "ProcessJudge.h"
+#include "ProcessContext.h"
+#include "ProcessCpu.h"
+#include "ProcessIni.h"
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+    const int JUDGE_ITEMS = 5;              // X, Y, L, CUR, EFF
+    const int JUDGE_CAPACITY = 120;         // 슬롯 수 상한 (MTP 119)
+    const int MTP_SLOTS = 7 * 17;
+    const int IPVS_SLOTS = 7 * 10;
+
+    const char* const ITEM_NAMES[JUDGE_ITEMS] = { "X", "Y", "L", "CUR", "EFF" };
+    const float ITEM_MIN[JUDGE_ITEMS] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    const float ITEM_MAX[JUDGE_ITEMS] = { 1.0f, 1.0f, 1000.0f, 100.0f, 100.0f };
+
+    // [17]:패턴 => 0:W, 1:R, 2:G, 3:B, 4:WG, 5:WG2, 6:WG3 ~ 16:WG13
+    const char* const PATTERN_NAMES[17] = {
+        "W", "R", "G", "B", "WG", "WG2", "WG3", "WG4", "WG5",
+        "WG6", "WG7", "WG8", "WG9", "WG10", "WG11", "WG12", "WG13"
+    };
+
+    // [7]:WAD => 0:0도, 1:30도, 2:45도, 3:60도, 4:15도, 5:A도, 6:B도
+    const char* const WAD_NAMES[7] = { "0", "30", "45", "60", "15", "A", "B" };
+
+    static_assert(sizeof(struct pattern) == 8 * sizeof(float), "pattern must be 8 x 32-bit fields");
+}
+
+// 슬롯별 스펙 (항목별 SoA)
+struct judge_table {
+    int slots;
+    float lo[JUDGE_ITEMS][JUDGE_CAPACITY];
+    float hi[JUDGE_ITEMS][JUDGE_CAPACITY];
+    float ptn_l[JUDGE_CAPACITY];            // L <= ptn_l 이면 PTN
+};
+
+struct judge_spec {
+    judge_table mtp;                        // 슬롯 = wad × 17 + 패턴
+    judge_table ipvs;                       // 슬롯 = wad × 10 + 포인트
+    int mtp_ok_threshold, mtp_ptn_threshold;
+    int ipvs_ok_threshold, ipvs_ptn_threshold;
+};
+
+namespace {
+
+    void init_table(judge_table* t, int slots)
+    {
+        t->slots = slots;
+        for (int s = 0; s < JUDGE_CAPACITY; ++s) {
+            for (int k = 0; k < JUDGE_ITEMS; ++k) {
+                t->lo[k][s] = ITEM_MIN[k];
+                t->hi[k][s] = ITEM_MAX[k];
+            }
+            t->ptn_l[s] = 0.0f;
+        }
+    }
+
+    void init_spec(judge_spec* spec)
+    {
+        init_table(&spec->mtp, MTP_SLOTS);
+        init_table(&spec->ipvs, IPVS_SLOTS);
+        spec->mtp_ok_threshold = 100;
+        spec->mtp_ptn_threshold = 13;
+        //26.10.16 - IpvsJudgment.JudgeZoneFromResults가 실제로 쓰는 값 (DllConstants IPVS 60/10은 미사용)
+        spec->ipvs_ok_threshold = 5;
+        spec->ipvs_ptn_threshold = 2;
+    }
+
+    const judge_spec* default_spec()
+    {
+        static const judge_spec s_spec = [] {
+            judge_spec spec;
+            init_spec(&spec);
+            return spec;
+        }();
+        return &s_spec;
+    }
+
+    bool parse_float(const std::string& s, float* value)
+    {
+        if (s.empty()) return false;
+        char* end = nullptr;
+        double v = std::strtod(s.c_str(), &end);
+        if (end == s.c_str() || *end != '\0') return false;
+        *value = (float)v;
+        return true;
+    }
+
+    // 키 하나 적용 ("min,max" - 빈 쪽은 유지)
+    void apply_key(const process_ini& ini, const char* section, const std::string& prefix,
+                   const std::string& suffix, judge_table* t, int slot)
+    {
+        for (int k = 0; k < JUDGE_ITEMS; ++k) {
+            std::string value = ini.get(section, prefix + ITEM_NAMES[k] + suffix);
+            if (value.empty()) continue;
+
+            std::vector<std::string> parts = ini_split(value, ',');
+            if (parts.size() > 0) parse_float(parts[0], &t->lo[k][slot]);
+            if (parts.size() > 1) parse_float(parts[1], &t->hi[k][slot]);
+        }
+        parse_float(ini.get(section, prefix + "PTN_L" + suffix), &t->ptn_l[slot]);
+    }
+
+    void load_spec(const process_ini& ini, judge_spec* spec)
+    {
+        for (int w = 0; w < 7; ++w) {
+            const std::string wad = std::string("_") + WAD_NAMES[w];
+
+            for (int j = 0; j < 17; ++j) {
+                const int slot = w * 17 + j;
+                const std::string ptn = std::string(PATTERN_NAMES[j]) + "_";
+                apply_key(ini, "MTP_SPEC", "", "", &spec->mtp, slot);
+                apply_key(ini, "MTP_SPEC", ptn, "", &spec->mtp, slot);
+                apply_key(ini, "MTP_SPEC", ptn, wad, &spec->mtp, slot);
+            }
+
+            for (int p = 0; p < 10; ++p) {
+                const int slot = w * 10 + p;
+                const std::string point = "P" + std::to_string(p + 1) + "_";
+                apply_key(ini, "IPVS_SPEC", "", "", &spec->ipvs, slot);
+                apply_key(ini, "IPVS_SPEC", "", wad, &spec->ipvs, slot);
+                apply_key(ini, "IPVS_SPEC", point, "", &spec->ipvs, slot);
+                apply_key(ini, "IPVS_SPEC", point, wad, &spec->ipvs, slot);
+            }
+        }
+
+        spec->mtp_ok_threshold = ini.get_int("MTP_SPEC", "OK_THRESHOLD", spec->mtp_ok_threshold);
+        spec->mtp_ptn_threshold = ini.get_int("MTP_SPEC", "PTN_THRESHOLD", spec->mtp_ptn_threshold);
+        spec->ipvs_ok_threshold = ini.get_int("IPVS_SPEC", "OK_THRESHOLD", spec->ipvs_ok_threshold);
+        spec->ipvs_ptn_threshold = ini.get_int("IPVS_SPEC", "PTN_THRESHOLD", spec->ipvs_ptn_threshold);
+    }
+
+    void count_result(int result, judge_counts* counts)
+    {
+        if (counts == nullptr) return;
+        if (result == 0) counts->ok++;
+        else if (result == 2) counts->ptn++;
+        else counts->ng++;
+    }
+
+    // 슬롯 1개 판정 (AVX2 경로와 같은 비교: NaN은 범위 밖)
+    int judge_one(const judge_table& t, int slot, const struct pattern& p)
+    {
+        if (!(p.L > t.ptn_l[slot])) {
+            return 2;
+        }
+
+        const float v[JUDGE_ITEMS] = { p.x, p.y, p.L, p.cur, p.eff };
+        for (int k = 0; k < JUDGE_ITEMS; ++k) {
+            if (!(v[k] >= t.lo[k][slot] && v[k] <= t.hi[k][slot])) {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+#if defined(PROCESS_CPU_AVX2)
+    // 8개 슬롯 단위 판정 - 처리한 슬롯 수 반환 (8의 배수, 나머지는 스칼라)
+    PROCESS_TARGET_AVX2
+    int judge_block_avx2(const judge_table& t, int slot0, struct pattern* p, int n, judge_counts* counts)
+    {
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            // pattern 8개(행) → 필드별 레지스터
+            __m256 f[8];
+            transpose8_ps(reinterpret_cast<const float*>(p + i), f);
+            const __m256 field[JUDGE_ITEMS] = { f[0], f[1], f[4], f[5], f[6] };    // x, y, L, cur, eff
+
+            const int slot = slot0 + i;
+            __m256 pass = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (int k = 0; k < JUDGE_ITEMS; ++k) {
+                __m256 ge = _mm256_cmp_ps(field[k], _mm256_loadu_ps(&t.lo[k][slot]), _CMP_GE_OQ);
+                __m256 le = _mm256_cmp_ps(field[k], _mm256_loadu_ps(&t.hi[k][slot]), _CMP_LE_OQ);
+                pass = _mm256_and_ps(pass, _mm256_and_ps(ge, le));
+            }
+            __m256 lit = _mm256_cmp_ps(field[2], _mm256_loadu_ps(&t.ptn_l[slot]), _CMP_GT_OQ);
+
+            const unsigned ptn = ~(unsigned)_mm256_movemask_ps(lit) & 0xFFu;
+            const unsigned ng = ~(unsigned)_mm256_movemask_ps(pass) & 0xFFu & ~ptn;
+            for (int k = 0; k < 8; ++k) {
+                const int result = ((ptn >> k) & 1u) ? 2 : (int)((ng >> k) & 1u);
+                p[i + k].result = result;
+                count_result(result, counts);
+            }
+        }
+        return i;
+    }
+#endif
+
+    // 연속 슬롯 [slot0, slot0 + n) 판정 (p: slot0의 pattern)
+    void judge_range(const judge_table& t, int slot0, struct pattern* p, int n, judge_counts* counts)
+    {
+        int i = 0;
+#if defined(PROCESS_CPU_AVX2)
+        if (cpu_simd_level() >= CPU_SIMD_AVX2) {
+            i = judge_block_avx2(t, slot0, p, n, counts);
+        }
+#endif
+        for (; i < n; ++i) {
+            p[i].result = judge_one(t, slot0 + i, p[i]);
+            count_result(p[i].result, counts);
+        }
+    }
+
+    void set_verdict(judge_counts* counts, int ok_threshold, int ptn_threshold)
+    {
+        if (counts->ok >= ok_threshold) counts->verdict = 0;
+        else if (counts->ptn >= ptn_threshold) counts->verdict = 2;
+        else counts->verdict = 1;
+    }
+
+    const judge_spec* context_spec(const process_context* ctx)
+    {
+        return ctx->judge ? ctx->judge.get() : default_spec();
+    }
+}
+
+void judge_mtp_slots(const judge_spec* spec, struct output* out, int wad, int first, int n,
+                     struct judge_counts* counts)
+{
+    if (spec == nullptr) spec = default_spec();
+    judge_range(spec->mtp, wad * 17 + first, &out->data[wad][first], n, counts);
+}
+
+void judge_ipvs_point(const judge_spec* spec, struct output* out, int point, struct judge_counts* counts)
+{
+    if (spec == nullptr) spec = default_spec();
+    for (int w = 0; w < 7; ++w) {
+        struct pattern& p = out->IPVS_data[w][point];
+        p.result = judge_one(spec->ipvs, w * 10 + point, p);
+        count_result(p.result, counts);
+    }
+}
+
+void judge_thresholds(const judge_spec* spec, bool ipvs, int* ok_threshold, int* ptn_threshold)
+{
+    if (spec == nullptr) spec = default_spec();
+    *ok_threshold = ipvs ? spec->ipvs_ok_threshold : spec->mtp_ok_threshold;
+    *ptn_threshold = ipvs ? spec->ipvs_ptn_threshold : spec->mtp_ptn_threshold;
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_judge_load_ctx(process_context* ctx, const char* recipe_path)
+    {
+        if (ctx == nullptr) {
+            return false;
+        }
+
+        process_ini ini;
+        if (recipe_path != nullptr && !ini.load(recipe_path)) {
+            return false;
+        }
+
+        std::shared_ptr<judge_spec> spec = std::make_shared<judge_spec>();
+        init_spec(spec.get());
+        load_spec(ini, spec.get());
+        ctx->judge = spec;
+        return true;
+    }
+
+    __declspec(dllexport) void process_judge_clear_ctx(process_context* ctx)
+    {
+        if (ctx == nullptr) {
+            return;
+        }
+        ctx->judge.reset();
+    }
+
+    __declspec(dllexport) bool process_judge_mtp_ctx(process_context* ctx, struct output* out,
+                                                     struct judge_counts* counts)
+    {
+        if (ctx == nullptr || out == nullptr) {
+            return false;
+        }
+
+        const judge_spec* spec = context_spec(ctx);
+        judge_counts c = judge_counts();
+        judge_range(spec->mtp, 0, &out->data[0][0], MTP_SLOTS, &c);
+        set_verdict(&c, spec->mtp_ok_threshold, spec->mtp_ptn_threshold);
+
+        mark_dirty_data_all(ctx);
+        if (counts != nullptr) *counts = c;
+        return true;
+    }
+
+    __declspec(dllexport) bool process_judge_ipvs_ctx(process_context* ctx, struct output* out,
+                                                      struct judge_counts* counts)
+    {
+        if (ctx == nullptr || out == nullptr) {
+            return false;
+        }
+
+        const judge_spec* spec = context_spec(ctx);
+        judge_counts c = judge_counts();
+        judge_range(spec->ipvs, 0, &out->IPVS_data[0][0], IPVS_SLOTS, &c);
+        set_verdict(&c, spec->ipvs_ok_threshold, spec->ipvs_ptn_threshold);
+
+        for (int p = 0; p < 10; ++p) mark_dirty_ipvs(ctx, p);
+        if (counts != nullptr) *counts = c;
+        return true;
+    }
+
+    __declspec(dllexport) bool process_judge_load(const char* recipe_path)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_judge_load_ctx(process_default_context(), recipe_path);
+    }
+
+    __declspec(dllexport) bool process_judge_mtp(struct output* out, struct judge_counts* counts)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_judge_mtp_ctx(process_default_context(), out, counts);
+    }
+
+    __declspec(dllexport) bool process_judge_ipvs(struct output* out, struct judge_counts* counts)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_judge_ipvs_ctx(process_default_context(), out, counts);
+    }
+
+} // extern "C"
@@ -0,0 +1,85 @@
+#pragma once
+// ProcessJudge.h : 측정 결과 스펙 판정 (pattern.result 기록)
+// OpticJudgment.JudgeMeasurement / IpvsJudgment와 같은 범위 판정을 DLL 안에서 슬롯 전체에 대해 수행
+//   OK  (0): x, y, L, cur, eff 모두 [min, max] 이내
+//   NG  (1): 하나라도 범위 밖 (NaN 포함)
+//   PTN (2): L <= PTN_L 또는 L이 NaN (패턴 미점등/측정 실패) - NG보다 우선
+// 스펙은 슬롯별 SoA 배열(항목별 min/max[슬롯])로 보관 - MTP 119(7×17), IPVS 70(7×10)
+// AVX2 지원 시 8개 슬롯을 한 번에 비교 (AoS pattern 8개를 전치하여 항목별 레지스터로 변환)
+//
+// Recipe 섹션 [MTP_SPEC] / [IPVS_SPEC] - 값: "min,max" (빈 쪽은 상위 설정 유지)
+//   항목: X, Y, L, CUR, EFF, PTN_L (PTN_L은 단일 값)
+//   MTP : <항목>, <패턴>_<항목>, <패턴>_<항목>_<WAD>   (패턴: W, R, G, B, WG, WG2 ~ WG13)
+//   IPVS: <항목>, <항목>_<WAD>, P<n>_<항목>, P<n>_<항목>_<WAD>   (n: 포인트 1 ~ 10)
+//   WAD: 0, 30, 45, 60, 15, A, B  (뒤쪽 키가 우선)
+//   Zone 판정: OK_THRESHOLD (OK 개수 이상이면 OK), PTN_THRESHOLD (PTN 개수 이상이면 PTN), 나머지 NG
+// 기본값은 C# 판정과 같음 (x, y: 0~1, L: 0~1000, cur/eff: 0~100, MTP 100/13 - DllConstants.OPTIC_*)
+// IPVS Zone 기준은 IpvsJudgment의 okCount >= 5 / ptnCount >= 2 (DllConstants.IPVS_* 60/10은 UI 판정에서 미사용)
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // Zone 판정 집계
+    struct judge_counts {
+        int ok;                     // OK 슬롯 수
+        int ng;                     // NG 슬롯 수
+        int ptn;                    // PTN 슬롯 수
+        int verdict;                // Zone 판정 (0:OK, 1:NG, 2:PTN)
+    };
+
+    // ===== 스펙 판정 (26.10.16) =====
+
+    /// <summary>
+    /// Recipe [MTP_SPEC] / [IPVS_SPEC] 스펙을 읽어 컨텍스트에 설정 (recipe_path nullptr: 기본 스펙)
+    /// 설정 후 MTP_test / IPVS_test / MTP_sweep의 result는 스펙 판정 결과로 기록됨
+    /// 파일 읽기 실패 시 false (기존 설정 유지)
+    /// </summary>
+    __declspec(dllexport) bool process_judge_load_ctx(process_context* ctx, const char* recipe_path);
+
+    /// <summary>
+    /// 스펙 설정 해제 (MTP_test / IPVS_test의 result가 다시 난수로 기록됨)
+    /// </summary>
+    __declspec(dllexport) void process_judge_clear_ctx(process_context* ctx);
+
+    /// <summary>
+    /// MTP 119개 슬롯 전체 판정 - data[][].result 기록 후 Zone 집계 (스펙 미설정 시 기본 스펙)
+    /// </summary>
+    __declspec(dllexport) bool process_judge_mtp_ctx(process_context* ctx, struct output* out,
+                                                     struct judge_counts* counts);
+
+    /// <summary>
+    /// IPVS 70개 슬롯 전체 판정 - IPVS_data[][].result 기록 후 Zone 집계 (스펙 미설정 시 기본 스펙)
+    /// </summary>
+    __declspec(dllexport) bool process_judge_ipvs_ctx(process_context* ctx, struct output* out,
+                                                      struct judge_counts* counts);
+
+    // 기본 컨텍스트 래퍼
+    __declspec(dllexport) bool process_judge_load(const char* recipe_path);
+    __declspec(dllexport) bool process_judge_mtp(struct output* out, struct judge_counts* counts);
+    __declspec(dllexport) bool process_judge_ipvs(struct output* out, struct judge_counts* counts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+// C++ 전용 내부 함수 (측정 함수에서 직접 판정)
+struct judge_spec;
+
+// MTP data[wad][first .. first+n) 판정 (result 기록, counts nullptr 허용)
+void judge_mtp_slots(const judge_spec* spec, struct output* out, int wad, int first, int n,
+                     struct judge_counts* counts);
+
+// IPVS 포인트 1개 (7개 WAD) 판정
+void judge_ipvs_point(const judge_spec* spec, struct output* out, int point, struct judge_counts* counts);
+
+// Zone 판정 임계값 (spec nullptr: 기본값)
+void judge_thresholds(const judge_spec* spec, bool ipvs, int* ok_threshold, int* ptn_threshold);
+#endif
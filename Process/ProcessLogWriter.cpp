@@ -0,0 +1,808 @@
+// ProcessLogWriter.cpp : 결과 로그 비동기 기록 구현
+
+#include "pch.h"
+#include "ProcessLogWriter.h"
+#include "ProcessIni.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <set>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    const int DEFAULT_SLOTS = 64;
+    const int MAX_SLOTS = 4096;
+    const int DEFAULT_HVI_ZONES = 3;
+    const int MAX_HVI_ZONES = 64;
+    const size_t WRITE_BYTES = 1 << 20;         // 이 크기가 차면 큐가 남아 있어도 기록
+    const size_t VALUE_BYTES = 48;              // 값 1개 최대 글자 수 (float 최대값 44자)
+    const size_t FIXED_BYTES = 1024;            // 시각 / ID / 판정 등 값 이외 열
+    const int IDLE_WAIT_MS = 2;                 // 큐가 빈 동안 대기 상한 (알림 누락 대비)
+
+    const char* const WAD_NAMES[7] = { "", "_WAD_30", "_WAD_45", "_WAD_60", "_WAD_15", "_WAD_A", "_WAD_B" };
+    const char* const CIM_WAD_NAMES[7] = { "WAD_0", "WAD_30", "WAD_45", "WAD_60", "WAD_15", "WAD_A", "WAD_B" };
+    const char* const PATTERN_NAMES[17] = { "W", "R", "G", "B", "WG", "WG2", "WG3", "WG4", "WG5", "WG6",
+                                            "WG7", "WG8", "WG9", "WG10", "WG11", "WG12", "WG13" };
+    const char* const ZONE_SUFFIX[8] = { "_C", "_L", "_R", "_T", "_B", "_F", "_S", "_E" };
+    const char* const CURRENT = "\xEC\xA0\x84\xEB\xA5\x98";       // "전류" (UTF-8)
+    const char* const EFFICIENCY = "\xED\x9A\xA8\xEC\x9C\xA8";    // "효율" (UTF-8)
+    const char* const JUDGE = "\xED\x8C\x90\xEC\xA0\x95";         // "판정" (UTF-8)
+    const char* const DATA = "\xEB\x8D\xB0\xEC\x9D\xB4\xED\x84\xB0";  // "데이터" (UTF-8)
+
+    const uint64_t POW10[20] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+        1000000000000000000ull, 10000000000000000000ull
+    };
+
+    // ===== 값 서식 =====
+
+    char* put_text(char* p, const char* s)
+    {
+        while (*s) *p++ = *s++;
+        return p;
+    }
+
+    // 고정 길이 배열 문자열 (NUL 없이 꽉 찬 경우 대비)
+    char* put_field(char* p, const char* s, size_t size)
+    {
+        if (s == nullptr) return p;
+        const void* nul = std::memchr(s, '\0', size);
+        const size_t n = nul != nullptr ? (size_t)((const char*)nul - s) : size;
+        std::memcpy(p, s, n);
+        return p + n;
+    }
+
+    char* put_uint(char* p, uint64_t v)
+    {
+        char tmp[20];
+        int n = 0;
+        do {
+            tmp[n++] = (char)('0' + v % 10);
+            v /= 10;
+        } while (v != 0);
+        while (n > 0) *p++ = tmp[--n];
+        return p;
+    }
+
+    char* put_int(char* p, int64_t v)
+    {
+        if (v < 0) {
+            *p++ = '-';
+            return put_uint(p, (uint64_t)(-(v + 1)) + 1);
+        }
+        return put_uint(p, (uint64_t)v);
+    }
+
+    char* put_digits(char* p, uint64_t v, int width)
+    {
+        for (int i = width - 1; i >= 0; --i) {
+            p[i] = (char)('0' + v % 10);
+            v /= 10;
+        }
+        return p + width;
+    }
+
+    // 천분의 1 단위 정수 → "정수.소수3자리"
+    char* put_milli(char* p, bool negative, uint64_t milli)
+    {
+        if (milli == 0) negative = false;       // .NET Framework: 0으로 반올림되면 부호 없음
+        if (negative) *p++ = '-';
+        p = put_uint(p, milli / 1000);
+        *p++ = '.';
+        return put_digits(p, milli % 1000, 3);
+    }
+
+    // float.ToString("F3") (.NET Framework) - 유효 숫자 7자리로 반올림한 뒤 소수 3자리로 다시 반올림 (0.5는 0에서 먼 쪽)
+    char* put_fixed3(char* p, float value)
+    {
+        if (std::isnan(value)) return put_text(p, "NaN");
+        if (std::isinf(value)) return put_text(p, value < 0 ? "-Infinity" : "Infinity");
+
+        const bool negative = value < 0;
+        const double d = std::fabs((double)value);
+        if (d == 0.0) return put_text(p, "0.000");
+
+        int e = (int)std::floor(std::log10(d));
+        if (e < -4) return put_text(p, "0.000");    // 7자리 반올림으로도 0.0005에 못 미침
+
+        // m = 유효 숫자 7자리 정수 (값 = m × 10^(e - 6))
+        auto digits7 = [d](int exp) {
+            const int k = 6 - exp;
+            const double scaled = k >= 0 ? d * (double)POW10[k] : d / std::pow(10.0, -k);
+            return (uint64_t)std::llround(scaled);
+        };
+        uint64_t m = digits7(e);
+        if (m >= POW10[7]) m = digits7(++e);        // log10 오차 보정
+        else if (m < POW10[6]) m = digits7(--e);
+        if (m >= POW10[7]) {                        // 9999999.5 → 10000000
+            m /= 10;
+            ++e;
+        }
+
+        const int k = 6 - e;                        // m의 소수 자릿수
+        if (k < 0) {
+            if (negative) *p++ = '-';
+            p = put_uint(p, m);
+            for (int i = 0; i < -k; ++i) *p++ = '0';
+            return put_text(p, ".000");
+        }
+        if (k >= 3) {
+            const uint64_t q = POW10[k - 3];
+            return put_milli(p, negative, (m + q / 2) / q);
+        }
+        return put_milli(p, negative, m * POW10[3 - k]);
+    }
+
+    // TACT (초, 소수 3자리)
+    char* put_seconds(char* p, int64_t ms)
+    {
+        return put_milli(p, ms < 0, (uint64_t)(ms < 0 ? -ms : ms));
+    }
+
+    // 현지 시각 - 같은 초는 캐시 재사용 (행마다 localtime 호출 방지)
+    struct time_cache {
+        int64_t sec = INT64_MIN;
+        struct tm t;
+    };
+
+    const struct tm& local_time(int64_t sec)
+    {
+        thread_local time_cache cache;
+        if (cache.sec != sec) {
+            time_t s = (time_t)sec;
+#ifdef _WIN32
+            localtime_s(&cache.t, &s);
+#else
+            localtime_r(&s, &cache.t);
+#endif
+            cache.sec = sec;
+        }
+        return cache.t;
+    }
+
+    // "yyyy:MM:dd HH:mm:ss:fff" (C# 로거와 같은 형식)
+    char* put_time(char* p, int64_t ms)
+    {
+        if (ms < 0) ms = 0;
+        const struct tm& t = local_time(ms / 1000);
+        p = put_digits(p, (uint64_t)t.tm_year + 1900, 4);
+        *p++ = ':';
+        p = put_digits(p, (uint64_t)t.tm_mon + 1, 2);
+        *p++ = ':';
+        p = put_digits(p, (uint64_t)t.tm_mday, 2);
+        *p++ = ' ';
+        p = put_digits(p, (uint64_t)t.tm_hour, 2);
+        *p++ = ':';
+        p = put_digits(p, (uint64_t)t.tm_min, 2);
+        *p++ = ':';
+        p = put_digits(p, (uint64_t)t.tm_sec, 2);
+        *p++ = ':';
+        return put_digits(p, (uint64_t)(ms % 1000), 3);
+    }
+
+    // "[yyyy-MM-dd HH:mm:ss]" (CIM 항목 시작 줄)
+    char* put_stamp(char* p, int64_t ms)
+    {
+        const struct tm& t = local_time(ms / 1000);
+        *p++ = '[';
+        p = put_digits(p, (uint64_t)t.tm_year + 1900, 4);
+        *p++ = '-';
+        p = put_digits(p, (uint64_t)t.tm_mon + 1, 2);
+        *p++ = '-';
+        p = put_digits(p, (uint64_t)t.tm_mday, 2);
+        *p++ = ' ';
+        p = put_digits(p, (uint64_t)t.tm_hour, 2);
+        *p++ = ':';
+        p = put_digits(p, (uint64_t)t.tm_min, 2);
+        *p++ = ':';
+        p = put_digits(p, (uint64_t)t.tm_sec, 2);
+        *p++ = ']';
+        return p;
+    }
+
+    int64_t now_ms()
+    {
+        return (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    std::string zone_suffix(int zone)
+    {
+        return zone < 8 ? ZONE_SUFFIX[zone] : "_Z" + std::to_string(zone);
+    }
+
+    // ===== 열 헤더 =====
+
+    std::string build_schema(int layout, int zones)
+    {
+        std::string h;
+        char buf[256];
+
+        if (layout == LOG_LAYOUT_IPVS_EECP) {
+            h = "START TIME,END TIME,TACT,CELL ID,INNER ID,ZONE,POINT";
+            for (int k = 0; k < 10; ++k) {
+                for (int w = 0; w < 7; ++w) {
+                    const char* wn = WAD_NAMES[w];
+                    std::snprintf(buf, sizeof(buf), ",W%s_X_%d,W%s_Y_%d,W%s_L_%d,W%s_%s_%d,W%s_%s_%d",
+                                  wn, k + 1, wn, k + 1, wn, k + 1, wn, CURRENT, k + 1, wn, EFFICIENCY, k + 1);
+                    h += buf;
+                }
+            }
+            return h;
+        }
+
+        const bool hvi = layout == LOG_LAYOUT_EECP_HVI;
+        h = hvi ? "START TIME,END TIME,TACT,CELL ID,INNER ID,SEQUENCE" : "START TIME,END TIME,TACT,CELL ID,INNER ID,ZONE";
+        for (int z = 0; z < (hvi ? zones : 1); ++z) {
+            const std::string suffix = hvi ? zone_suffix(z) : std::string();
+            const char* s = suffix.c_str();
+            for (int p = 0; p < 17; ++p) {
+                for (int w = 0; w < 7; ++w) {
+                    const char* n = PATTERN_NAMES[p];
+                    const char* wn = WAD_NAMES[w];
+                    std::snprintf(buf, sizeof(buf), ",%s%s%s_X,%s%s%s_Y,%s%s%s_u,%s%s%s_v,%s%s%s_L,%s%s%s_%s,%s%s%s_%s",
+                                  n, wn, s, n, wn, s, n, wn, s, n, wn, s, n, wn, s, n, wn, s, CURRENT,
+                                  n, wn, s, EFFICIENCY);
+                    h += buf;
+                }
+            }
+        }
+        h += ",ERROR_NAME,JUDGMENT,TOTAL_POINT,CUR_POINT";
+        return h;
+    }
+
+    // ===== CIM 항목 =====
+
+    void format_cim(std::string* buf, const struct log_meta& meta, const log_cell& cell,
+                    const struct output& out, int64_t stamp_ms)
+    {
+        const size_t old = buf->size();
+        buf->resize(old + 2048 + 7 * 17 * (8 * (48 + VALUE_BYTES) + 2) + 7 * 64);
+        char* const begin = &(*buf)[old];
+        char* p = begin;
+
+        p = put_stamp(p, stamp_ms);
+        p = put_text(p, " CIM Log Entry\r\nSTART_TIME = ");
+        p = put_time(p, meta.start_ms);
+        p = put_text(p, "\r\nEND_TIME = ");
+        p = put_time(p, meta.end_ms);
+        p = put_text(p, "\r\nTACT = ");
+        p = put_seconds(p, meta.end_ms - meta.start_ms);
+        p = put_text(p, "\r\nCELL_ID = ");
+        p = put_field(p, cell.cell_id, 256);
+        p = put_text(p, "\r\nINNER_ID = ");
+        p = put_field(p, cell.inner_id, 256);
+        p = put_text(p, "\r\nZONE = ");
+        p = put_int(p, meta.zone);
+        p = put_text(p, "\r\nTOTAL_POINT = ");
+        p = put_int(p, cell.total_point);
+        p = put_text(p, "\r\nCUR_POINT = ");
+        p = put_int(p, cell.cur_point);
+        p = put_text(p, "\r\nERROR_NAME = ");
+        p = put_field(p, meta.error_name, sizeof(meta.error_name));
+        p = put_text(p, "\r\nJUDGMENT = ");
+        p = put_field(p, meta.judgment, sizeof(meta.judgment));
+        p = put_text(p, "\r\n\r\n[DATA]\r\n");
+
+        for (int w = 0; w < 7; ++w) {
+            p = put_text(p, "// ");
+            p = put_text(p, CIM_WAD_NAMES[w]);
+            *p++ = ' ';
+            p = put_text(p, DATA);
+            p = put_text(p, "\r\n");
+
+            for (int j = 0; j < 17; ++j) {
+                const struct pattern& d = out.data[w][j];
+                const float values[7] = { d.x, d.y, d.u, d.v, d.L, d.cur, d.eff };
+                const char* const names[7] = { "_X", "_Y", "_u", "_v", "_L", nullptr, nullptr };
+
+                for (int f = 0; f < 8; ++f) {
+                    p = put_text(p, CIM_WAD_NAMES[w]);
+                    *p++ = '_';
+                    p = put_text(p, PATTERN_NAMES[j]);
+                    if (f < 5) {
+                        p = put_text(p, names[f]);
+                    }
+                    else {
+                        *p++ = '_';
+                        p = put_text(p, f == 5 ? CURRENT : f == 6 ? EFFICIENCY : JUDGE);
+                    }
+                    p = put_text(p, " = ");
+                    p = f < 7 ? put_fixed3(p, values[f]) : put_text(p, d.result == 0 ? "OK" : d.result == 1 ? "NG" : "PTN");
+                    p = put_text(p, "\r\n");
+                }
+                p = put_text(p, "\r\n");
+            }
+        }
+        p = put_text(p, "========================================\r\n\r\n");
+        buf->resize(old + (size_t)(p - begin));
+    }
+
+    bool sync_file(FILE* fp)
+    {
+        if (std::fflush(fp) != 0) return false;
+#ifdef _WIN32
+        return _commit(_fileno(fp)) == 0;
+#else
+        return fsync(fileno(fp)) == 0;
+#endif
+    }
+
+    // 큐 슬롯 종류
+    enum slot_kind {
+        SLOT_RECORD,    // 셀 결과 1건 (HVI는 zones × sequences개 슬롯이 연속)
+        SLOT_FENCE      // flush 확인
+    };
+
+    struct log_slot {
+        std::atomic<uint64_t> seq;      // == 위치: 비어 있음, == 위치 + 1: 기록 대기
+        int kind;
+        int part;                       // HVI: zone × sequences + seq
+        int zones;
+        int sequences;
+        int64_t queued_ms;
+        struct log_meta meta;
+        struct input in;
+        struct output out;
+    };
+}
+
+// 기록기 (DLL 내부 전용)
+struct process_log_writer {
+    std::string path;
+    int layout;
+    int zones;                              // HVI 헤더 Zone 수
+    const std::string* schema;
+
+    std::unique_ptr<log_slot[]> slots;
+    uint64_t mask;
+    std::atomic<uint64_t> tail;             // 다음에 예약할 위치 (호출 측)
+    std::atomic<uint64_t> head;             // 다음에 꺼낼 위치 (기록 스레드)
+    std::atomic<bool> idle;                 // 기록 스레드 대기 중
+    std::atomic<bool> stop;
+
+    std::mutex lock;
+    std::condition_variable wake;           // 기록 스레드 깨우기
+    std::condition_variable fenced;         // flush 완료 알림
+    uint64_t fence_done;                    // 처리한 마지막 fence 위치 + 1 (lock)
+    bool failed;                            // 기록 / fsync 실패 (lock)
+
+    // 기록 스레드 전용
+    FILE* fp;
+    std::string out;                        // 서식화된 CSV 행
+    std::vector<struct output> group;       // HVI 묶음
+    std::map<int, std::string> cim;         // Zone별 마지막 CIM 항목 (미기록)
+    std::set<int> cim_unsynced;             // 기록 후 fsync 전인 CIM Zone
+    bool write_error;
+    std::thread worker;
+};
+
+namespace {
+
+    std::string cim_path(const std::string& directory, int zone)
+    {
+        std::string path = directory;
+        if (!path.empty() && path.back() != '/' && path.back() != '\\') path += '/';
+        return path + "ZONE" + std::to_string(zone) + ".dat";
+    }
+
+    // 모은 행 기록 (sync: fsync까지)
+    void write_out(process_log_writer* w, bool sync)
+    {
+        if (w->fp != nullptr) {
+            if (!w->out.empty()) {
+                if (std::fwrite(w->out.data(), 1, w->out.size(), w->fp) != w->out.size()) w->write_error = true;
+                w->out.clear();
+            }
+            if (sync ? !sync_file(w->fp) : std::fflush(w->fp) != 0) w->write_error = true;
+        }
+
+        for (auto& item : w->cim) {
+            FILE* fp = std::fopen(cim_path(w->path, item.first).c_str(), "wb");
+            if (fp == nullptr || std::fwrite(item.second.data(), 1, item.second.size(), fp) != item.second.size()) {
+                w->write_error = true;
+            }
+            if (fp != nullptr && std::fclose(fp) != 0) w->write_error = true;
+            w->cim_unsynced.insert(item.first);
+        }
+        w->cim.clear();
+
+        if (sync) {
+            for (int zone : w->cim_unsynced) {
+                FILE* fp = std::fopen(cim_path(w->path, zone).c_str(), "r+b");
+                if (fp == nullptr || !sync_file(fp)) w->write_error = true;
+                if (fp != nullptr) std::fclose(fp);
+            }
+            w->cim_unsynced.clear();
+        }
+    }
+
+    void handle(process_log_writer* w, log_slot* s, uint64_t pos)
+    {
+        if (s->kind == SLOT_FENCE) {
+            write_out(w, true);
+            w->head.store(pos + 1, std::memory_order_release);     // flush 반환 시 pending에 fence 미포함
+            std::lock_guard<std::mutex> guard(w->lock);
+            if (w->write_error) w->failed = true;
+            w->fence_done = pos + 1;
+            w->fenced.notify_all();
+            return;
+        }
+
+        const log_cell cell = { s->in.CELL_ID, s->in.INNER_ID, s->in.total_point, s->in.cur_point };
+
+        if (w->layout == LOG_LAYOUT_CIM) {
+            std::string& entry = w->cim[s->meta.zone];
+            entry.clear();
+            format_cim(&entry, s->meta, cell, s->out, s->queued_ms);
+        }
+        else if (w->layout == LOG_LAYOUT_EECP_HVI) {
+            const int parts = s->zones * s->sequences;
+            if ((int)w->group.size() < parts) w->group.resize(parts);
+            w->group[s->part] = s->out;
+            if (s->part != parts - 1) return;
+
+            // 마지막 슬롯에서 SEQUENCE별 행 생성 (헤더 Zone 수에 맞춤, 없는 Zone은 0)
+            std::vector<const struct output*> outs(w->zones, nullptr);
+            for (int seq = 0; seq < s->sequences; ++seq) {
+                for (int z = 0; z < w->zones && z < s->zones; ++z) outs[z] = &w->group[z * s->sequences + seq];
+                log_format_row(&w->out, w->layout, s->meta, cell, outs.data(), w->zones, seq);
+            }
+        }
+        else {
+            const struct output* outs[1] = { &s->out };
+            log_format_row(&w->out, w->layout, s->meta, cell, outs, 1, 0);
+        }
+
+        if (w->out.size() >= WRITE_BYTES) write_out(w, false);
+    }
+
+    void writer_loop(process_log_writer* w)
+    {
+        uint64_t head = 0;
+        for (;;) {
+            log_slot* s = &w->slots[head & w->mask];
+            if (s->seq.load(std::memory_order_acquire) == head + 1) {
+                handle(w, s, head);
+                s->seq.store(head + w->mask + 1, std::memory_order_release);
+                w->head.store(++head, std::memory_order_release);
+                continue;
+            }
+
+            // 큐가 비면 모은 행 기록 후 대기
+            write_out(w, false);
+            if (w->write_error) {
+                std::lock_guard<std::mutex> guard(w->lock);
+                w->failed = true;
+            }
+            if (w->stop.load() && head == w->tail.load()) break;
+
+            std::unique_lock<std::mutex> guard(w->lock);
+            w->idle.store(true);
+            w->wake.wait_for(guard, std::chrono::milliseconds(IDLE_WAIT_MS), [w, s, head] {
+                return w->stop.load() || s->seq.load() == head + 1;
+            });
+            w->idle.store(false);
+        }
+
+        write_out(w, true);
+        std::lock_guard<std::mutex> guard(w->lock);
+        if (w->write_error) w->failed = true;
+    }
+
+    // 연속 슬롯 n개 예약 - 비워질 때까지 대기 후 첫 위치 반환
+    uint64_t claim(process_log_writer* w, int n)
+    {
+        const uint64_t pos = w->tail.fetch_add((uint64_t)n);
+        for (int i = 0; i < n; ++i) {
+            log_slot* s = &w->slots[(pos + i) & w->mask];
+            while (s->seq.load(std::memory_order_acquire) != pos + i) {
+                std::this_thread::yield();
+            }
+        }
+        return pos;
+    }
+
+    void publish(process_log_writer* w, uint64_t pos, int n)
+    {
+        for (int i = 0; i < n; ++i) {
+            w->slots[(pos + i) & w->mask].seq.store(pos + i + 1);
+        }
+        if (w->idle.load()) {
+            std::lock_guard<std::mutex> guard(w->lock);
+            w->wake.notify_one();
+        }
+    }
+
+    void fill(log_slot* s, const struct input* in, const struct log_meta* meta, int64_t queued_ms)
+    {
+        s->kind = SLOT_RECORD;
+        s->queued_ms = queued_ms;
+        if (in != nullptr) {
+            s->in = *in;
+        }
+        else {
+            std::memset(&s->in, 0, sizeof(s->in));
+        }
+        s->meta = *meta;
+    }
+}
+
+const std::string& log_schema(int layout, int zones)
+{
+    static std::mutex cache_lock;
+    static std::map<std::pair<int, int>, std::string> cache;
+
+    if (layout != LOG_LAYOUT_EECP_HVI) zones = 1;
+    std::lock_guard<std::mutex> guard(cache_lock);
+    auto it = cache.find(std::make_pair(layout, zones));
+    if (it == cache.end()) {
+        it = cache.emplace(std::make_pair(layout, zones),
+                           layout == LOG_LAYOUT_CIM ? std::string() : build_schema(layout, zones)).first;
+    }
+    return it->second;
+}
+
+void log_format_row(std::string* buf, int layout, const struct log_meta& meta, const log_cell& cell,
+                    const struct output* const* outs, int zones, int sequence)
+{
+    const bool ipvs = layout == LOG_LAYOUT_IPVS_EECP;
+    const size_t values = ipvs ? 10 * 7 * 5 : (size_t)zones * 17 * 7 * 7;
+
+    const size_t old = buf->size();
+    buf->resize(old + FIXED_BYTES + values * (VALUE_BYTES + 1));
+    char* const begin = &(*buf)[old];
+    char* p = begin;
+
+    p = put_time(p, meta.start_ms);
+    *p++ = ',';
+    p = put_time(p, meta.end_ms);
+    *p++ = ',';
+    p = put_seconds(p, meta.end_ms - meta.start_ms);
+    *p++ = ',';
+    p = put_field(p, cell.cell_id, 256);
+    *p++ = ',';
+    p = put_field(p, cell.inner_id, 256);
+    *p++ = ',';
+    if (layout == LOG_LAYOUT_EECP_HVI) {
+        p = put_text(p, "SEQ");
+        p = put_int(p, sequence + 1);
+    }
+    else {
+        p = put_int(p, meta.zone);
+    }
+
+    if (ipvs) {
+        p = put_text(p, ",ALL");
+        const struct output* out = outs[0];
+        for (int k = 0; k < 10; ++k) {
+            for (int w = 0; w < 7; ++w) {
+                if (out == nullptr) {
+                    p = put_text(p, ",0.000,0.000,0.000,0.000,0.000");
+                    continue;
+                }
+                const struct pattern& d = out->IPVS_data[w][k];
+                const float v[5] = { d.x, d.y, d.L, d.cur, d.eff };
+                for (int f = 0; f < 5; ++f) {
+                    *p++ = ',';
+                    p = put_fixed3(p, v[f]);
+                }
+            }
+        }
+    }
+    else {
+        for (int z = 0; z < zones; ++z) {
+            const struct output* out = outs[z];
+            for (int j = 0; j < 17; ++j) {
+                for (int w = 0; w < 7; ++w) {
+                    if (out == nullptr) {
+                        p = put_text(p, ",0.000,0.000,0.000,0.000,0.000,0.000,0.000");
+                        continue;
+                    }
+                    const struct pattern& d = out->data[w][j];
+                    const float v[7] = { d.x, d.y, d.u, d.v, d.L, d.cur, d.eff };
+                    for (int f = 0; f < 7; ++f) {
+                        *p++ = ',';
+                        p = put_fixed3(p, v[f]);
+                    }
+                }
+            }
+        }
+        *p++ = ',';
+        p = put_field(p, meta.error_name, sizeof(meta.error_name));
+        *p++ = ',';
+        p = put_field(p, meta.judgment, sizeof(meta.judgment));
+        *p++ = ',';
+        p = put_int(p, cell.total_point);
+        *p++ = ',';
+        p = put_int(p, cell.cur_point);
+    }
+    p = put_text(p, "\r\n");
+    buf->resize(old + (size_t)(p - begin));
+}
+
+extern "C" {
+
+    __declspec(dllexport) process_log_writer* process_log_open(const char* path, int layout, const char* recipe,
+                                                               int queue_slots)
+    {
+        if (path == nullptr || layout < LOG_LAYOUT_EECP || layout > LOG_LAYOUT_CIM) {
+            return nullptr;
+        }
+        if (queue_slots <= 0) queue_slots = DEFAULT_SLOTS;
+        if (queue_slots > MAX_SLOTS) queue_slots = MAX_SLOTS;
+
+        int zones = DEFAULT_HVI_ZONES;
+        if (recipe != nullptr) {
+            process_ini ini;
+            if (ini.load(recipe)) zones = ini.get_int("Settings", "MTP_ZONE", DEFAULT_HVI_ZONES);
+        }
+        if (zones <= 0 || zones > MAX_HVI_ZONES) zones = DEFAULT_HVI_ZONES;
+
+        process_log_writer* w = new (std::nothrow) process_log_writer();
+        if (w == nullptr) return nullptr;
+
+        uint64_t capacity = 1;
+        while (capacity < (uint64_t)queue_slots) capacity <<= 1;
+
+        w->path = path;
+        w->layout = layout;
+        w->zones = zones;
+        w->schema = &log_schema(layout, zones);
+        w->slots.reset(new (std::nothrow) log_slot[capacity]);
+        w->mask = capacity - 1;
+        w->tail = 0;
+        w->head = 0;
+        w->idle = false;
+        w->stop = false;
+        w->fence_done = 0;
+        w->failed = false;
+        w->fp = nullptr;
+        w->write_error = false;
+
+        if (!w->slots) {
+            delete w;
+            return nullptr;
+        }
+        for (uint64_t i = 0; i < capacity; ++i) w->slots[i].seq.store(i, std::memory_order_relaxed);
+
+        if (layout != LOG_LAYOUT_CIM) {
+            w->fp = std::fopen(path, "ab");
+            if (w->fp == nullptr) {
+                delete w;
+                return nullptr;
+            }
+            // 새 파일이면 BOM + 헤더 (C# File.WriteAllText(..., Encoding.UTF8)과 동일)
+            std::fseek(w->fp, 0, SEEK_END);
+            if (std::ftell(w->fp) == 0) {
+                std::fputs("\xEF\xBB\xBF", w->fp);
+                std::fputs(w->schema->c_str(), w->fp);
+                std::fputs("\r\n", w->fp);
+                std::fflush(w->fp);
+            }
+            w->out.reserve(WRITE_BYTES + FIXED_BYTES + (size_t)zones * 17 * 7 * 7 * (VALUE_BYTES + 1));
+        }
+
+        w->worker = std::thread(writer_loop, w);
+        return w;
+    }
+
+    __declspec(dllexport) void process_log_close(process_log_writer* writer)
+    {
+        if (writer == nullptr) return;
+
+        {
+            std::lock_guard<std::mutex> guard(writer->lock);
+            writer->stop.store(true);
+            writer->wake.notify_one();
+        }
+        if (writer->worker.joinable()) {
+            writer->worker.join();
+        }
+        if (writer->fp != nullptr) std::fclose(writer->fp);
+        delete writer;
+    }
+
+    __declspec(dllexport) bool process_log_write(process_log_writer* writer, const struct input* in,
+                                                 const struct output* out, const struct log_meta* meta)
+    {
+        if (writer == nullptr || out == nullptr || meta == nullptr || writer->layout == LOG_LAYOUT_EECP_HVI) {
+            return false;
+        }
+
+        const int64_t queued = writer->layout == LOG_LAYOUT_CIM ? now_ms() : 0;
+        const uint64_t pos = claim(writer, 1);
+        log_slot* s = &writer->slots[pos & writer->mask];
+        fill(s, in, meta, queued);
+        s->part = 0;
+        s->zones = s->sequences = 1;
+        s->out = *out;
+        publish(writer, pos, 1);
+        return true;
+    }
+
+    __declspec(dllexport) bool process_log_write_hvi(process_log_writer* writer, const struct input* in,
+                                                     const struct output* outs, int zones, int sequences,
+                                                     const struct log_meta* meta)
+    {
+        if (writer == nullptr || outs == nullptr || meta == nullptr || writer->layout != LOG_LAYOUT_EECP_HVI ||
+            zones <= 0 || sequences <= 0 || (uint64_t)zones * sequences > writer->mask + 1) {
+            return false;
+        }
+
+        const int n = zones * sequences;
+        const uint64_t pos = claim(writer, n);
+        for (int i = 0; i < n; ++i) {
+            log_slot* s = &writer->slots[(pos + i) & writer->mask];
+            fill(s, in, meta, 0);
+            s->part = i;
+            s->zones = zones;
+            s->sequences = sequences;
+            s->out = outs[i];
+        }
+        publish(writer, pos, n);
+        return true;
+    }
+
+    __declspec(dllexport) bool process_log_flush(process_log_writer* writer, int timeout_ms)
+    {
+        if (writer == nullptr) {
+            return false;
+        }
+
+        const uint64_t pos = claim(writer, 1);
+        writer->slots[pos & writer->mask].kind = SLOT_FENCE;
+        publish(writer, pos, 1);
+
+        std::unique_lock<std::mutex> guard(writer->lock);
+        auto done = [writer, pos] { return writer->fence_done > pos; };
+        if (timeout_ms < 0) {
+            writer->fenced.wait(guard, done);
+        }
+        else if (!writer->fenced.wait_for(guard, std::chrono::milliseconds(timeout_ms), done)) {
+            return false;
+        }
+        return !writer->failed;
+    }
+
+    __declspec(dllexport) int process_log_pending(process_log_writer* writer)
+    {
+        if (writer == nullptr) {
+            return -1;
+        }
+        return (int)(writer->tail.load() - writer->head.load());
+    }
+
+    __declspec(dllexport) int process_log_schema(process_log_writer* writer, char* header, int size)
+    {
+        if (writer == nullptr) {
+            return -1;
+        }
+
+        const std::string& h = *writer->schema;
+        if (header != nullptr && size > 0) {
+            const size_t n = h.size() < (size_t)size - 1 ? h.size() : (size_t)size - 1;
+            std::memcpy(header, h.data(), n);
+            header[n] = '\0';
+        }
+        return (int)h.size();
+    }
+
+} // extern "C"
@@ -0,0 +1,110 @@
+#pragma once
+// ProcessLogWriter.h : 결과 로그(EECP / CIM) 비동기 기록
+// 셀마다 UI 쪽 StringBuilder로 수백 열 CSV를 만들던 작업을 DLL의 기록 스레드로 옮겨 택트 흔들림을 줄이기 위함
+//
+// 호출 측: process_log_write가 output / input / 메타 정보를 큐 슬롯에 복사하고 바로 반환 (서식 / 파일 기록 없음)
+//   큐 = 고정 크기 링 버퍼 (슬롯별 순번으로 잠금 없이 추가) - 가득 차면 기록 스레드가 비울 때까지 대기
+// 기록 스레드: 재사용 버퍼에 행을 서식화(정수 변환, printf 미사용)해 모았다가 큐가 비거나 1MB가 차면 한 번에 추가 기록
+//   CIM(Zone별 덮어쓰기 파일)은 한 번에 꺼낸 묶음에서 Zone별 마지막 결과만 기록
+// 열 헤더(schema)는 배치 / Zone 수마다 한 번만 만들어 재사용 (HVI Zone 수는 Recipe [Settings] MTP_ZONE)
+// process_log_flush: 호출 전까지 넣은 결과의 디스크 기록(fsync) 확인 - 로트 종료 시 사용
+//
+// 값 서식은 C# 로거(.NET Framework float F3)와 같음: 유효 숫자 7자리로 반올림 후 소수 3자리, 줄바꿈 CRLF
+// 주의: 기록 스레드는 DLL 언로드 중 join하지 않도록 반드시 process_log_close로 종료
+
+#include "ProcessFunctions.h"
+#include <stdint.h>
+
+// 로그 배치 (layout)
+#define LOG_LAYOUT_EECP         0       // OpticEECPLogger Normal - path: CSV 파일
+#define LOG_LAYOUT_EECP_HVI     1       // OpticEECPLogger HVI (SEQUENCE별 1행, Zone별 접미사 열) - path: CSV 파일
+#define LOG_LAYOUT_IPVS_EECP    2       // IPVSEECPLogger - path: CSV 파일
+#define LOG_LAYOUT_CIM          3       // OpticCIMLogger - path: 폴더 (ZONE<n>.dat 덮어쓰기)
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 행 메타 정보 (C# ZoneTestResult)
+    struct log_meta {
+        int64_t start_ms;       // 측정 시작 / 종료 시각 (Unix ms) - TACT = 차이
+        int64_t end_ms;
+        int32_t zone;           // ZONE 열 / CIM 파일 번호 (C# zoneNumber)
+        int32_t reserved;
+        char error_name[64];    // ERROR_NAME
+        char judgment[16];      // JUDGMENT (OK, NG, R/J, PTN 등)
+    };
+
+    typedef struct process_log_writer process_log_writer;
+
+    // ===== 로그 기록 (26.10.16) =====
+
+    /// <summary>
+    /// 기록기 열기 - CSV 파일은 이어서 추가 (새 파일이면 BOM + 헤더 기록), 실패 시 nullptr
+    /// recipe: HVI Zone 수를 읽을 Recipe 파일 (nullptr: 3), queue_slots <= 0: 64 (2의 거듭제곱으로 올림)
+    /// </summary>
+    __declspec(dllexport) process_log_writer* process_log_open(const char* path, int layout, const char* recipe,
+                                                               int queue_slots);
+
+    /// <summary>
+    /// 남은 결과 기록 + fsync 후 기록 스레드 종료 및 해제 (다른 스레드의 write와 동시에 호출 금지)
+    /// </summary>
+    __declspec(dllexport) void process_log_close(process_log_writer* writer);
+
+    /// <summary>
+    /// 셀 결과 1건 추가 (EECP / IPVS_EECP / CIM) - 복사 후 바로 반환, 인자 / 배치 오류 시 false
+    /// </summary>
+    __declspec(dllexport) bool process_log_write(process_log_writer* writer, const struct input* in,
+                                                 const struct output* out, const struct log_meta* meta);
+
+    /// <summary>
+    /// HVI 결과 추가 (EECP_HVI) - outs[zone × sequences + seq], SEQUENCE마다 1행
+    /// zones × sequences가 큐 슬롯 수보다 크면 false
+    /// </summary>
+    __declspec(dllexport) bool process_log_write_hvi(process_log_writer* writer, const struct input* in,
+                                                     const struct output* outs, int zones, int sequences,
+                                                     const struct log_meta* meta);
+
+    /// <summary>
+    /// 호출 전까지 추가한 결과를 기록 + fsync할 때까지 대기 (timeout_ms < 0: 무한)
+    /// 완료되고 기록 오류가 없었으면 true
+    /// </summary>
+    __declspec(dllexport) bool process_log_flush(process_log_writer* writer, int timeout_ms);
+
+    /// <summary>
+    /// 큐에 남은 슬롯 수 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_log_pending(process_log_writer* writer);
+
+    /// <summary>
+    /// 열 헤더 줄 복사 (BOM / 줄바꿈 제외, CIM은 빈 문자열) - 헤더 길이 반환 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_log_schema(process_log_writer* writer, char* header, int size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+#include <string>
+
+// 행 서식 (DLL 내부 - ProcessArchive CSV 내보내기와 공용)
+struct log_cell {
+    const char* cell_id;
+    const char* inner_id;
+    int total_point;
+    int cur_point;
+};
+
+// CSV 열 헤더 (layout / zones별로 한 번 생성 후 캐시, CIM은 빈 문자열)
+const std::string& log_schema(int layout, int zones);
+
+// CSV 1행을 buf 끝에 추가 (EECP / IPVS_EECP: outs[0], EECP_HVI: outs[zone], nullptr은 0으로 채움)
+// sequence: HVI SEQUENCE 번호 (0부터, "SEQ<n+1>"로 기록)
+void log_format_row(std::string* buf, int layout, const struct log_meta& meta, const log_cell& cell,
+                    const struct output* const* outs, int zones, int sequence);
+#endif
@@ -0,0 +1,239 @@
+// ProcessLut.cpp : 채널별 LUT 감마 추정 누적기 및 계조 스윕
+
+#include "pch.h"
+#include "ProcessLut.h"
+#include "ProcessContext.h"
+#include "ProcessLutFit.h"
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+void lut_accumulator::reset()
+{
+    sx = sy = sxx = sxy = syy = 0.0;
+    n = 0;
+    anchor_index = 0;
+    anchor_lumi = 0.0;
+    anchor_fixed = false;
+}
+
+bool lut_accumulator::add(int index, double luminance)
+{
+    if (index <= 0 || !(luminance > 0.0)) {
+        return false;
+    }
+
+    const double x = std::log(static_cast<double>(index));
+    const double y = std::log(luminance);
+    sx += x;
+    sy += y;
+    sxx += x * x;
+    sxy += x * y;
+    syy += y * y;
+    ++n;
+
+    if (!anchor_fixed) {
+        anchor_index = index;
+        anchor_lumi = luminance;
+    }
+    return true;
+}
+
+bool lut_accumulator::set_anchor(int index, double luminance)
+{
+    if (anchor_fixed || !add(index, luminance)) {
+        return false;
+    }
+    anchor_index = index;
+    anchor_lumi = luminance;
+    anchor_fixed = true;
+    return true;
+}
+
+void lut_accumulator::centered_sums(double* sxx_c, double* sxy_c, double* syy_c) const
+{
+    const double xM = (n > 0) ? std::log(static_cast<double>(anchor_index)) : 0.0;
+    const double yM = (n > 0) ? std::log(anchor_lumi) : 0.0;
+    *sxx_c = sxx - 2.0 * xM * sx + n * xM * xM;
+    *sxy_c = sxy - xM * sy - yM * sx + n * xM * yM;
+    *syy_c = syy - 2.0 * yM * sy + n * yM * yM;
+}
+
+double lut_accumulator::gamma_stderr(double* resid_sd) const
+{
+    if (resid_sd != nullptr) *resid_sd = -1.0;
+    if (n < 3) return -1.0;
+
+    double sxx_c, sxy_c, syy_c;
+    centered_sums(&sxx_c, &sxy_c, &syy_c);
+    if (sxx_c <= 1e-12) return -1.0;
+
+    // 앵커 점은 잔차 0 - 나머지 n - 1개 점, 모수 1개
+    double rss = syy_c - sxy_c * sxy_c / sxx_c;
+    if (rss < 0.0) rss = 0.0;
+    const double s = std::sqrt(rss / (n - 2));
+    if (resid_sd != nullptr) *resid_sd = s;
+    return s / std::sqrt(sxx_c);
+}
+
+lut_parameter lut_accumulator::result() const
+{
+    lut_parameter param;
+    param.max_index = 0.0f;
+    param.max_lumi = 0.0f;
+    param.gamma = 1.0f;
+    param.black = 0.0f;
+
+    if (n == 0) {
+        return param;
+    }
+
+    param.max_index = static_cast<float>(anchor_index);
+    param.max_lumi = static_cast<float>(anchor_lumi);
+
+    // Σ(xi - xM)(yi - yM), Σ(xi - xM)² 를 누적합으로 전개
+    double den, num, syy_c;
+    centered_sums(&den, &num, &syy_c);
+
+    if (n >= 2 && std::fabs(den) > 1e-12) {
+        param.gamma = static_cast<float>(num / den);
+    }
+    return param;
+}
+
+bool lut_send_voltage(process_context* ctx, const int voltage[3])
+{
+    if (ctx == nullptr || voltage[0] < 0 || voltage[1] < 0 || voltage[2] < 0) {
+        return false;
+    }
+    //26.10.16 - LUTPage는 단색 스윕 시 나머지 채널을 0으로 넘김 (PGVoltagesnd_ctx의 0 거부 검사 미적용)
+    return ctx->pg->set_voltage(voltage[0], voltage[1], voltage[2]);
+}
+
+bool lut_measure_level(process_context* ctx, int rgb, int voltage[3], int level, LUT_Data* point)
+{
+    point->index = level;
+    point->voltage = (double)level;
+    point->luminance = 0.0;
+
+    voltage[rgb] = level;
+    struct pattern sample;
+    if (!lut_send_voltage(ctx, voltage) ||
+        !meas_integrate(ctx) || !meas_readout(ctx, &sample)) {
+        return false;
+    }
+    point->luminance = sample.L;
+    return true;
+}
+
+extern "C" {
+
+    __declspec(dllexport) lut_accumulator* process_lut_create()
+    {
+        return new (std::nothrow) lut_accumulator();
+    }
+
+    __declspec(dllexport) void process_lut_destroy(lut_accumulator* acc)
+    {
+        delete acc;
+    }
+
+    __declspec(dllexport) void process_lut_reset(lut_accumulator* acc)
+    {
+        if (acc != nullptr) {
+            acc->reset();
+        }
+    }
+
+    __declspec(dllexport) bool process_lut_add(lut_accumulator* acc, int index, double luminance)
+    {
+        if (acc == nullptr) {
+            return false;
+        }
+        return acc->add(index, luminance);
+    }
+
+    __declspec(dllexport) bool process_lut_get(const lut_accumulator* acc, struct lut_parameter* param)
+    {
+        if (acc == nullptr || param == nullptr) {
+            return false;
+        }
+        *param = acc->result();
+        return true;
+    }
+
+    __declspec(dllexport) int process_lut_count(const lut_accumulator* acc)
+    {
+        return (acc != nullptr) ? acc->n : 0;
+    }
+
+    __declspec(dllexport) bool getLUTdata_series_ctx(process_context* ctx, int rgb, float RV, float GV, float BV,
+                                                     int interval, int cnt, struct LUT_Data* series,
+                                                     int capacity, int* count, struct output* out)
+    {
+        if (count != nullptr) {
+            *count = 0;
+        }
+        if (ctx == nullptr || out == nullptr || rgb < 0 || rgb >= 3 || interval <= 0 || cnt <= 0) {
+            return false;
+        }
+
+        const int base[3] = { (int)std::lround(RV), (int)std::lround(GV), (int)std::lround(BV) };
+        if (base[rgb] <= 0 || base[0] < 0 || base[1] < 0 || base[2] < 0) {
+            return false;
+        }
+
+        std::vector<LUT_Data>& points = ctx->lut_points[rgb];
+        points.clear();
+
+        // 단색 패턴 (1:R 2:G 3:B)
+        bool ok = PGPattern_ctx(ctx, rgb + 1);
+
+        lut_accumulator acc;
+        int voltage[3] = { base[0], base[1], base[2] };
+        for (int k = cnt - 1; k >= 0; --k) {
+            const long long level = (long long)base[rgb] - (long long)k * interval;
+            if (level <= 0) continue;
+
+            LUT_Data point;
+            if (lut_measure_level(ctx, rgb, voltage, (int)level, &point)) {
+                acc.add(point.index, point.luminance);
+            }
+            else {
+                ok = false;
+            }
+            points.push_back(point);
+        }
+
+        // PG 전압 복귀
+        lut_send_voltage(ctx, base);
+
+        //26.10.16 - black 포함 전체 모델 적합 (유효점 부족 시 로그 회귀 결과)
+        if (!process_lut_fit(points.data(), (int)points.size(), &out->lut[rgb])) {
+            out->lut[rgb] = acc.result();
+        }
+        mark_dirty_lut(ctx, rgb);
+
+        if (count != nullptr) {
+            *count = (int)points.size();
+        }
+        if (series != nullptr && capacity > 0) {
+            std::copy_n(points.begin(), std::min((int)points.size(), capacity), series);
+        }
+        return ok && acc.n > 0;
+    }
+
+    __declspec(dllexport) int get_lut_points_ctx(process_context* ctx, int rgb, struct LUT_Data* dst, int capacity)
+    {
+        if (ctx == nullptr || rgb < 0 || rgb >= 3) {
+            return -1;
+        }
+
+        const std::vector<LUT_Data>& points = ctx->lut_points[rgb];
+        if (dst != nullptr && capacity > 0) {
+            std::copy_n(points.begin(), std::min((int)points.size(), capacity), dst);
+        }
+        return (int)points.size();
+    }
+
+} // extern "C"
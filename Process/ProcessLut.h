@@ -0,0 +1,107 @@
+#pragma once
+// ProcessLut.h : 채널별 LUT 감마 추정 누적기 및 계조 스윕
+// 계조 측정점 (index, luminance)을 한 점씩 받아 로그 공간 누적합만 유지 (점당 O(1))
+// 마지막 유효점(앵커) 기준 로그-앵커 회귀 (cal_lut 전체 모델 적합의 초기값)
+//   gamma = Σ(xi - xM)(yi - yM) / Σ(xi - xM)²,  xi = ln(index), yi = ln(luminance)
+//   앵커가 바뀌어도 Sx, Sy, Sxx, Sxy, n 으로 다시 전개하므로 이력 재전송 불필요
+
+#include "ProcessFunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    typedef struct lut_accumulator lut_accumulator;
+
+    // ===== LUT 누적기 (26.10.16) =====
+
+    /// <summary>
+    /// 채널 누적기 생성 (실패 시 nullptr)
+    /// </summary>
+    __declspec(dllexport) lut_accumulator* process_lut_create();
+
+    /// <summary>
+    /// 누적기 해제 (nullptr 허용)
+    /// </summary>
+    __declspec(dllexport) void process_lut_destroy(lut_accumulator* acc);
+
+    /// <summary>
+    /// 누적 내용 초기화 (새 계조 스윕 시작 시)
+    /// </summary>
+    __declspec(dllexport) void process_lut_reset(lut_accumulator* acc);
+
+    /// <summary>
+    /// 측정점 추가 - index &lt;= 0 또는 luminance &lt;= 0 인 점은 무시하고 false 반환
+    /// </summary>
+    __declspec(dllexport) bool process_lut_add(lut_accumulator* acc, int index, double luminance);
+
+    /// <summary>
+    /// 현재까지의 LUT 파라미터 (유효점이 없으면 max_index/max_lumi 0, gamma 1)
+    /// </summary>
+    __declspec(dllexport) bool process_lut_get(const lut_accumulator* acc, struct lut_parameter* param);
+
+    /// <summary>
+    /// 누적된 유효점 수
+    /// </summary>
+    __declspec(dllexport) int process_lut_count(const lut_accumulator* acc);
+
+    // ===== LUT 계조 스윕 (26.10.16) =====
+    // 채널 rgb의 전압 코드를 (시작 전압 - (cnt-1)×interval)부터 시작 전압까지 interval 간격으로 올리며
+    // 단색 패턴(R/G/B) + PGVoltagesnd → 측정 → 누적기 순서로 진행 (마지막 점 = 최대 계조 = 앵커)
+    // 0 이하가 되는 계조는 건너뜀, 스윕 후 PG 전압은 (RV, GV, BV)로 복귀
+
+    /// <summary>
+    /// 계조 스윕 + LUT 파라미터 계산 - out->lut[rgb] 기록, 원시 측정점은 series에 복사 (nullptr 허용)
+    /// count: 스윕한 점 수 (capacity보다 크면 앞쪽 capacity개만 복사)
+    /// 모든 점의 PG/측정이 성공하면 true (실패한 점은 luminance 0으로 기록되어 계산에서 제외)
+    /// </summary>
+    __declspec(dllexport) bool getLUTdata_series_ctx(process_context* ctx, int rgb, float RV, float GV, float BV,
+                                                     int interval, int cnt, struct LUT_Data* series,
+                                                     int capacity, int* count, struct output* out);
+
+    /// <summary>
+    /// 마지막 스윕의 원시 측정점 복사 - 전체 점 수 반환 (rgb 범위 밖이면 -1)
+    /// </summary>
+    __declspec(dllexport) int get_lut_points_ctx(process_context* ctx, int rgb, struct LUT_Data* dst, int capacity);
+
+#ifdef __cplusplus
+}
+
+// 누적기 본체 (cal_lut 등 DLL 내부에서 직접 사용)
+struct lut_accumulator {
+    double sx;              // Σ ln(index)
+    double sy;              // Σ ln(luminance)
+    double sxx;             // Σ ln(index)²
+    double sxy;             // Σ ln(index)·ln(luminance)
+    double syy;             // Σ ln(luminance)² (잔차 분산 계산용)
+    int n;                  // 유효점 수
+
+    int anchor_index;       // 앵커 (기본: 마지막 유효점)
+    double anchor_lumi;
+    bool anchor_fixed;      // true: set_anchor로 고정 (이후 add가 앵커를 바꾸지 않음)
+
+    lut_accumulator() { reset(); }
+
+    void reset();
+    bool add(int index, double luminance);
+    lut_parameter result() const;
+
+    // 앵커 고정 + 점 추가 (최대 계조를 먼저 측정하는 적응형 계획용)
+    bool set_anchor(int index, double luminance);
+
+    // 앵커 기준 Σ(xi - xM)², Σ(xi - xM)(yi - yM), Σ(yi - yM)²
+    void centered_sums(double* sxx_c, double* sxy_c, double* syy_c) const;
+
+    // gamma 표준오차 (앵커를 지나는 회귀, 자유도 n - 2) - 계산 불가 시 -1
+    // resid_sd: 로그 잔차 표준편차 (= 점당 상대 측정 오차 추정, nullptr 허용)
+    double gamma_stderr(double* resid_sd) const;
+};
+
+// 채널 rgb를 level로 설정 후 측정 (voltage: 현재 RGB 전압, rgb 항목이 level로 바뀜)
+// 실패 시 luminance 0으로 기록하고 false 반환 (단색 패턴은 호출 측에서 설정)
+bool lut_measure_level(process_context* ctx, int rgb, int voltage[3], int level, LUT_Data* point);
+
+// 스윕용 RGB 전압 전송 - PGVoltagesnd와 달리 스윕하지 않는 채널의 0(소등)을 허용 (음수는 false)
+bool lut_send_voltage(process_context* ctx, const int voltage[3]);
+
+#endif
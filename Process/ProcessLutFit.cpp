@@ -0,0 +1,385 @@
+// ProcessLutFit.cpp : LUT 전체 모델 비선형 적합 (Levenberg-Marquardt)
+
+#include "pch.h"
+#include "ProcessLutFit.h"
+#include "ProcessLut.h"
+#include "ProcessFastMath.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    const double WEIGHT_FLOOR = 1e-3;       // 가중치 하한 = 0.001 × 최대 휘도
+    const double GAMMA_MIN = 0.05;
+    const double GAMMA_MAX = 20.0;
+
+    struct fit_point {
+        double log_t;       // ln(index / max_index)
+        double L;
+        double w;           // 1 / (L + 0.001 × L_max)
+    };
+
+    struct fit_params {
+        double black;
+        double max_lumi;
+        double gamma;
+    };
+
+    void clamp_params(fit_params* p)
+    {
+        if (!(p->black > 0.0)) p->black = 0.0;
+        if (!(p->gamma > GAMMA_MIN)) p->gamma = GAMMA_MIN;
+        if (p->gamma > GAMMA_MAX) p->gamma = GAMMA_MAX;
+        if (!(p->max_lumi > p->black)) p->max_lumi = p->black + 1e-6;
+    }
+
+    double eval_cost(const std::vector<fit_point>& pts, const fit_params& p)
+    {
+        double cost = 0.0;
+        for (const fit_point& pt : pts) {
+            const double tg = std::exp(p.gamma * pt.log_t);
+            const double r = pt.w * (p.black + (p.max_lumi - p.black) * tg - pt.L);
+            cost += r * r;
+        }
+        return cost;
+    }
+
+    // (A + λ·diag(A)) δ = -g 풀이 (A 대칭, 여인수 전개)
+    bool solve3(const double a[6], const double g[3], double lambda, double delta[3])
+    {
+        const double a00 = a[0] * (1.0 + lambda), a01 = a[1], a02 = a[2];
+        const double a11 = a[3] * (1.0 + lambda), a12 = a[4];
+        const double a22 = a[5] * (1.0 + lambda);
+
+        const double c00 = a11 * a22 - a12 * a12;
+        const double c01 = a02 * a12 - a01 * a22;
+        const double c02 = a01 * a12 - a02 * a11;
+        const double c11 = a00 * a22 - a02 * a02;
+        const double c12 = a01 * a02 - a00 * a12;
+        const double c22 = a00 * a11 - a01 * a01;
+
+        const double det = a00 * c00 + a01 * c01 + a02 * c02;
+        if (!(std::fabs(det) > 1e-300)) return false;
+
+        const double inv = -1.0 / det;
+        delta[0] = inv * (c00 * g[0] + c01 * g[1] + c02 * g[2]);
+        delta[1] = inv * (c01 * g[0] + c11 * g[1] + c12 * g[2]);
+        delta[2] = inv * (c02 * g[0] + c12 * g[1] + c22 * g[2]);
+        return true;
+    }
+
+    void lm_fit(const std::vector<fit_point>& pts, fit_params* p)
+    {
+        double lambda = 1e-3;
+        double cost = eval_cost(pts, *p);
+
+        for (int iter = 0; iter < LUT_FIT_ITERATIONS; ++iter) {
+            double a[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+            double g[3] = { 0.0, 0.0, 0.0 };
+            const double span = p->max_lumi - p->black;
+
+            for (const fit_point& pt : pts) {
+                const double tg = std::exp(p->gamma * pt.log_t);
+                const double r = pt.w * (p->black + span * tg - pt.L);
+                const double j0 = pt.w * (1.0 - tg);
+                const double j1 = pt.w * tg;
+                const double j2 = pt.w * span * tg * pt.log_t;
+
+                a[0] += j0 * j0; a[1] += j0 * j1; a[2] += j0 * j2;
+                a[3] += j1 * j1; a[4] += j1 * j2; a[5] += j2 * j2;
+                g[0] += j0 * r; g[1] += j1 * r; g[2] += j2 * r;
+            }
+
+            double delta[3];
+            if (!solve3(a, g, lambda, delta)) {
+                lambda *= 10.0;
+                continue;
+            }
+
+            fit_params cand = { p->black + delta[0], p->max_lumi + delta[1], p->gamma + delta[2] };
+            clamp_params(&cand);
+            const double cand_cost = eval_cost(pts, cand);
+            if (cand_cost < cost) {
+                *p = cand;
+                cost = cand_cost;
+                lambda = std::max(lambda * 0.3, 1e-9);
+            }
+            else {
+                lambda = std::min(lambda * 10.0, 1e9);
+            }
+        }
+    }
+
+    // max_index를 지정한 단일 채널 적합 (유효점 4개 미만이면 로그 회귀만)
+    bool fit_channel(const LUT_Data* points, int n, double max_index, struct lut_parameter* param)
+    {
+        lut_accumulator acc;
+        double l_max = 0.0;
+        for (int i = 0; i < n; ++i) {
+            // LUT_Data는 pack(1) - 정렬되지 않은 double을 참조로 넘기지 않도록 값으로 복사
+            const double L = points[i].luminance;
+            if (acc.add(points[i].index, L) && L > l_max) {
+                l_max = L;
+            }
+        }
+
+        *param = acc.result();
+        if (acc.n < 4 || !(max_index > 0.0)) {
+            return false;
+        }
+
+        // 초기값: 로그-앵커 회귀를 max_index로 환산
+        fit_params p;
+        p.gamma = param->gamma;
+        p.max_lumi = acc.anchor_lumi * std::pow(max_index / acc.anchor_index, p.gamma);
+        p.black = 0.0;
+        clamp_params(&p);
+
+        std::vector<fit_point> pts;
+        pts.reserve(acc.n);
+        const double floor = WEIGHT_FLOOR * l_max;
+        for (int i = 0; i < n; ++i) {
+            if (points[i].index <= 0 || !(points[i].luminance > 0.0)) continue;
+            fit_point pt;
+            pt.log_t = std::log(points[i].index / max_index);
+            pt.L = points[i].luminance;
+            pt.w = 1.0 / (pt.L + floor);
+            pts.push_back(pt);
+        }
+
+        lm_fit(pts, &p);
+
+        param->max_index = (float)max_index;
+        param->max_lumi = (float)p.max_lumi;
+        param->gamma = (float)p.gamma;
+        param->black = (float)p.black;
+        return true;
+    }
+
+#ifdef PROCESS_FASTMATH_SSE2
+
+    inline __m128 select_ps(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    // 4개 lane 동시 적합 (단정밀도) - L, W는 [k × 4 + lane] 배치
+    void lm_fit_x4(const float* log_t, const float* L, const float* W, int m,
+                   __m128* black, __m128* max_lumi, __m128* gamma)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        __m128 b = *black, M = *max_lumi, g = *gamma;
+        __m128 lambda = _mm_set1_ps(1e-3f);
+
+        auto cost_of = [&](__m128 cb, __m128 cM, __m128 cg) {
+            __m128 cost = zero;
+            const __m128 span = _mm_sub_ps(cM, cb);
+            for (int k = 0; k < m; ++k) {
+                const __m128 w = _mm_loadu_ps(W + 4 * k);
+                __m128 tg = fastmath::fast_exp_ps(_mm_mul_ps(cg, _mm_set1_ps(log_t[k])));
+                __m128 r = _mm_mul_ps(w, _mm_sub_ps(_mm_add_ps(cb, _mm_mul_ps(span, tg)), _mm_loadu_ps(L + 4 * k)));
+                cost = _mm_add_ps(cost, _mm_mul_ps(r, r));
+            }
+            return cost;
+        };
+
+        __m128 cost = cost_of(b, M, g);
+
+        for (int iter = 0; iter < LUT_FIT_ITERATIONS; ++iter) {
+            __m128 a00 = zero, a01 = zero, a02 = zero, a11 = zero, a12 = zero, a22 = zero;
+            __m128 g0 = zero, g1 = zero, g2 = zero;
+            const __m128 span = _mm_sub_ps(M, b);
+
+            for (int k = 0; k < m; ++k) {
+                const __m128 lt = _mm_set1_ps(log_t[k]);
+                const __m128 w = _mm_loadu_ps(W + 4 * k);
+                __m128 tg = fastmath::fast_exp_ps(_mm_mul_ps(g, lt));
+                __m128 r = _mm_mul_ps(w, _mm_sub_ps(_mm_add_ps(b, _mm_mul_ps(span, tg)), _mm_loadu_ps(L + 4 * k)));
+                __m128 j0 = _mm_mul_ps(w, _mm_sub_ps(one, tg));
+                __m128 j1 = _mm_mul_ps(w, tg);
+                __m128 j2 = _mm_mul_ps(_mm_mul_ps(j1, span), lt);
+
+                a00 = _mm_add_ps(a00, _mm_mul_ps(j0, j0));
+                a01 = _mm_add_ps(a01, _mm_mul_ps(j0, j1));
+                a02 = _mm_add_ps(a02, _mm_mul_ps(j0, j2));
+                a11 = _mm_add_ps(a11, _mm_mul_ps(j1, j1));
+                a12 = _mm_add_ps(a12, _mm_mul_ps(j1, j2));
+                a22 = _mm_add_ps(a22, _mm_mul_ps(j2, j2));
+                g0 = _mm_add_ps(g0, _mm_mul_ps(j0, r));
+                g1 = _mm_add_ps(g1, _mm_mul_ps(j1, r));
+                g2 = _mm_add_ps(g2, _mm_mul_ps(j2, r));
+            }
+
+            const __m128 damp = _mm_add_ps(one, lambda);
+            a00 = _mm_mul_ps(a00, damp);
+            a11 = _mm_mul_ps(a11, damp);
+            a22 = _mm_mul_ps(a22, damp);
+
+            const __m128 c00 = _mm_sub_ps(_mm_mul_ps(a11, a22), _mm_mul_ps(a12, a12));
+            const __m128 c01 = _mm_sub_ps(_mm_mul_ps(a02, a12), _mm_mul_ps(a01, a22));
+            const __m128 c02 = _mm_sub_ps(_mm_mul_ps(a01, a12), _mm_mul_ps(a02, a11));
+            const __m128 c11 = _mm_sub_ps(_mm_mul_ps(a00, a22), _mm_mul_ps(a02, a02));
+            const __m128 c12 = _mm_sub_ps(_mm_mul_ps(a01, a02), _mm_mul_ps(a00, a12));
+            const __m128 c22 = _mm_sub_ps(_mm_mul_ps(a00, a11), _mm_mul_ps(a01, a01));
+            const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a00, c00), _mm_mul_ps(a01, c01)),
+                                          _mm_mul_ps(a02, c02));
+
+            // |det|가 0에 가까운 lane은 갱신하지 않음
+            const __m128 abs_det = _mm_andnot_ps(_mm_set1_ps(-0.0f), det);
+            const __m128 solvable = _mm_cmpgt_ps(abs_det, _mm_set1_ps(1e-30f));
+            const __m128 inv = _mm_and_ps(solvable, _mm_div_ps(_mm_set1_ps(-1.0f), select_ps(solvable, det, one)));
+
+            const __m128 d0 = _mm_mul_ps(inv, _mm_add_ps(_mm_add_ps(_mm_mul_ps(c00, g0), _mm_mul_ps(c01, g1)),
+                                                         _mm_mul_ps(c02, g2)));
+            const __m128 d1 = _mm_mul_ps(inv, _mm_add_ps(_mm_add_ps(_mm_mul_ps(c01, g0), _mm_mul_ps(c11, g1)),
+                                                         _mm_mul_ps(c12, g2)));
+            const __m128 d2 = _mm_mul_ps(inv, _mm_add_ps(_mm_add_ps(_mm_mul_ps(c02, g0), _mm_mul_ps(c12, g1)),
+                                                         _mm_mul_ps(c22, g2)));
+
+            // 후보 + 범위 제한 (black ≥ 0, gamma ∈ [0.05, 20], max_lumi > black)
+            __m128 cb = _mm_max_ps(_mm_add_ps(b, d0), zero);
+            __m128 cg = _mm_min_ps(_mm_max_ps(_mm_add_ps(g, d2), _mm_set1_ps((float)GAMMA_MIN)),
+                                   _mm_set1_ps((float)GAMMA_MAX));
+            __m128 cM = _mm_max_ps(_mm_add_ps(M, d1), _mm_add_ps(cb, _mm_set1_ps(1e-6f)));
+
+            const __m128 cand_cost = cost_of(cb, cM, cg);
+            const __m128 accept = _mm_and_ps(solvable, _mm_cmplt_ps(cand_cost, cost));
+
+            b = select_ps(accept, cb, b);
+            M = select_ps(accept, cM, M);
+            g = select_ps(accept, cg, g);
+            cost = select_ps(accept, cand_cost, cost);
+            lambda = select_ps(accept,
+                               _mm_max_ps(_mm_mul_ps(lambda, _mm_set1_ps(0.3f)), _mm_set1_ps(1e-9f)),
+                               _mm_min_ps(_mm_mul_ps(lambda, _mm_set1_ps(10.0f)), _mm_set1_ps(1e9f)));
+        }
+
+        *black = b;
+        *max_lumi = M;
+        *gamma = g;
+    }
+
+#endif
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_lut_fit(const struct LUT_Data* points, int n, struct lut_parameter* param)
+    {
+        if (points == nullptr || param == nullptr || n <= 0) {
+            return false;
+        }
+
+        // max_index = 마지막 유효점 (cal_lut 앵커와 동일)
+        int anchor = 0;
+        for (int i = n - 1; i >= 0; --i) {
+            if (points[i].index > 0 && points[i].luminance > 0.0) {
+                anchor = points[i].index;
+                break;
+            }
+        }
+        return fit_channel(points, n, (double)anchor, param);
+    }
+
+    __declspec(dllexport) int process_lut_fit_batch(const int* levels, int m, const float* luminance, int lanes,
+                                                    struct lut_parameter* params)
+    {
+        if (levels == nullptr || luminance == nullptr || params == nullptr || m <= 0 || lanes < 0) {
+            return -1;
+        }
+
+        const double max_index = (double)levels[m - 1];
+        if (!(max_index > 0.0)) {
+            return -1;
+        }
+
+        int fitted = 0;
+        std::vector<LUT_Data> lane_points((size_t)m);
+        auto load_lane = [&](int lane) {
+            for (int k = 0; k < m; ++k) {
+                lane_points[k].index = levels[k];
+                lane_points[k].voltage = (double)levels[k];
+                lane_points[k].luminance = luminance[(size_t)lane * m + k];
+            }
+        };
+
+        int lane = 0;
+#ifdef PROCESS_FASTMATH_SSE2
+        std::vector<float> log_t((size_t)m);
+        for (int k = 0; k < m; ++k) {
+            log_t[k] = (levels[k] > 0) ? (float)std::log(levels[k] / max_index) : 0.0f;
+        }
+        std::vector<float> L((size_t)m * 4), W((size_t)m * 4);
+
+        for (; lane + 4 <= lanes; lane += 4) {
+            float b0[4], M0[4], g0[4];
+            bool valid[4];
+
+            // lane별 초기값 (로그 회귀) 및 가중치 - 무효점은 가중치 0
+            for (int q = 0; q < 4; ++q) {
+                load_lane(lane + q);
+
+                lut_accumulator acc;
+                double l_max = 0.0;
+                for (int k = 0; k < m; ++k) {
+                    const double L = lane_points[k].luminance;
+                    if (acc.add(levels[k], L) && L > l_max) {
+                        l_max = L;
+                    }
+                }
+                valid[q] = acc.n >= 4;
+
+                const lut_parameter reg = acc.result();
+                g0[q] = std::min(std::max(reg.gamma, (float)GAMMA_MIN), (float)GAMMA_MAX);
+                M0[q] = valid[q] ? (float)(acc.anchor_lumi * std::pow(max_index / acc.anchor_index, (double)reg.gamma))
+                                 : 1.0f;
+                b0[q] = 0.0f;
+
+                const double floor = WEIGHT_FLOOR * l_max;
+                for (int k = 0; k < m; ++k) {
+                    const double lum = lane_points[k].luminance;
+                    const bool ok = valid[q] && levels[k] > 0 && lum > 0.0;
+                    L[(size_t)k * 4 + q] = ok ? (float)lum : 0.0f;
+                    W[(size_t)k * 4 + q] = ok ? (float)(1.0 / (lum + floor)) : 0.0f;
+                }
+            }
+
+            __m128 black = _mm_loadu_ps(b0);
+            __m128 max_lumi = _mm_loadu_ps(M0);
+            __m128 gamma = _mm_loadu_ps(g0);
+            lm_fit_x4(log_t.data(), L.data(), W.data(), m, &black, &max_lumi, &gamma);
+
+            float b[4], M[4], g[4];
+            _mm_storeu_ps(b, black);
+            _mm_storeu_ps(M, max_lumi);
+            _mm_storeu_ps(g, gamma);
+            for (int q = 0; q < 4; ++q) {
+                if (!valid[q]) {
+                    // 유효점 부족 - 로그 회귀 결과
+                    load_lane(lane + q);
+                    fit_channel(lane_points.data(), m, max_index, &params[lane + q]);
+                    continue;
+                }
+                params[lane + q].max_index = (float)max_index;
+                params[lane + q].max_lumi = M[q];
+                params[lane + q].gamma = g[q];
+                params[lane + q].black = b[q];
+                ++fitted;
+            }
+        }
+#endif
+
+        // 나머지 lane (SSE2 미지원 시 전체) - 배정밀도 단일 적합
+        for (; lane < lanes; ++lane) {
+            load_lane(lane);
+            if (fit_channel(lane_points.data(), m, max_index, &params[lane])) {
+                ++fitted;
+            }
+        }
+        return fitted;
+    }
+
+} // extern "C"
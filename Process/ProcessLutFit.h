@@ -0,0 +1,36 @@
+#pragma once
+// ProcessLutFit.h : LUT 전체 모델 비선형 적합 (Levenberg-Marquardt)
+//   L(i) = black + (max_lumi - black) × (i / max_index)^gamma
+// max_index는 고정 (단일 적합: 마지막 유효점 index, 일괄 적합: 계조 격자의 최대값)
+// black, max_lumi, gamma 3개 모수를 해석적 야코비안으로 적합
+//   dL/dblack = 1 - t^g,  dL/dmax_lumi = t^g,  dL/dgamma = (max_lumi - black) × t^g × ln t
+// 잔차는 상대 가중 (L_fit - L) / (L + 0.001 × L_max) - 저계조 점이 black 추정에 반영되도록 함
+// 초기값: lut_accumulator 로그-앵커 회귀 (gamma, max_lumi), black = 0
+// 반복 횟수 고정 (LUT_FIT_ITERATIONS) - 호출당 계산량이 일정함
+
+#include "ProcessFunctions.h"
+
+#define LUT_FIT_ITERATIONS 20
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // ===== LUT 전체 모델 적합 (26.10.16) =====
+
+    /// <summary>
+    /// 단일 채널 적합 - 유효점(index &gt; 0, luminance &gt; 0)이 4개 미만이면 로그 회귀 결과만 기록하고 false
+    /// </summary>
+    __declspec(dllexport) bool process_lut_fit(const struct LUT_Data* points, int n, struct lut_parameter* param);
+
+    /// <summary>
+    /// 여러 채널/셀 일괄 적합 (SSE2: 4개 채널을 한 번에 계산)
+    /// levels[m]: 공통 계조 격자 (오름차순), luminance[lane × m + k]: lane의 levels[k] 측정 휘도 (0 이하: 제외)
+    /// 적합에 성공한 lane 수 반환 (인자 오류 시 -1)
+    /// </summary>
+    __declspec(dllexport) int process_lut_fit_batch(const int* levels, int m, const float* luminance, int lanes,
+                                                    struct lut_parameter* params);
+
+#ifdef __cplusplus
+}
+#endif
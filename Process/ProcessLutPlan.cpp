@@ -0,0 +1,311 @@
+// ProcessLutPlan.cpp : 적응형 LUT 계조 측정 계획
+
+#include "pch.h"
+#include "ProcessLutPlan.h"
+#include "ProcessLut.h"
+#include "ProcessContext.h"
+#include "ProcessIni.h"
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <vector>
+
+struct lut_planner {
+    lut_plan_config config;
+    int max_level;
+    std::vector<int> candidates;        // 앵커 제외 후보 계조
+    std::vector<bool> used;
+    std::vector<double> measured_log;   // 측정 성공한 계조의 ln(level) (앵커 포함)
+    lut_accumulator acc;
+    int measured;
+    bool anchor_tried;
+    bool converged;
+    bool exhausted;                     // 측정 가능한 후보 없음
+};
+
+namespace {
+
+    const double DEFAULT_REL_NOISE = 0.01;      // 잔차 추정 전 상대 잡음 가정
+    const double PRIOR_GAMMA = 2.2;             // 기울기 추정 전 감마 가정
+
+    lut_plan_config default_config()
+    {
+        lut_plan_config cfg;
+        cfg.gamma_tol = 0.02f;
+        cfg.lumi_tol = 0.01f;
+        cfg.min_points = 4;
+        cfg.noise_floor = 0.05f;
+        return cfg;
+    }
+
+    // 양측 95% t 분위수 (df 1~30은 정확한 값, 그 이상은 표의 바로 아래 자유도 값 - 구간을 좁게 잡지 않음)
+    double t95(int df)
+    {
+        static const double table[] = {
+            0.0,
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        if (df <= 0) return 0.0;
+        if (df <= 30) return table[df];
+        if (df < 40) return 2.042;
+        if (df < 60) return 2.021;
+        if (df < 120) return 2.000;
+        return 1.980;
+    }
+
+    // 신뢰구간 반폭 계산 - 계산 불가 시 false
+    bool confidence(const lut_planner* planner, double* gamma_ci, double* lumi_ci)
+    {
+        double resid_sd;
+        double se = planner->acc.gamma_stderr(&resid_sd);
+        if (se < 0.0) {
+            *gamma_ci = *lumi_ci = -1.0;
+            return false;
+        }
+        const double t = t95(planner->acc.n - 2);
+        *gamma_ci = t * se;
+        *lumi_ci = t * resid_sd;
+        return true;
+    }
+
+    void update_converged(lut_planner* planner)
+    {
+        double gamma_ci, lumi_ci;
+        if (planner->acc.n < planner->config.min_points || !confidence(planner, &gamma_ci, &lumi_ci)) {
+            planner->converged = false;
+            return;
+        }
+        planner->converged = gamma_ci <= planner->config.gamma_tol && lumi_ci <= planner->config.lumi_tol;
+    }
+
+    // 후보 정보량 (클수록 gamma 추정 분산을 많이 줄임)
+    // 잡음 바닥에 의한 상대 오차가 lumi_tol을 넘는 저휘도 계조는 제외 (-1)
+    double score(const lut_planner* planner, int level, double gamma, double rel_noise)
+    {
+        const double xM = std::log((double)planner->max_level);
+        const double x = std::log((double)level);
+        const double dx = x - xM;
+
+        const double predicted = planner->acc.anchor_lumi * std::exp(gamma * dx);
+        const double floor_rel = (predicted > 0.0) ? planner->config.noise_floor / predicted : 1e9;
+        if (floor_rel > planner->config.lumi_tol) return -1.0;
+
+        const double variance = rel_noise * rel_noise + floor_rel * floor_rel;
+
+        double spacing = 1e9;
+        for (double m : planner->measured_log) {
+            spacing = std::min(spacing, std::fabs(x - m));
+        }
+        return dx * dx / variance * spacing;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool lut_plan_default_config(const char* recipe_path, struct lut_plan_config* cfg)
+    {
+        if (cfg == nullptr) {
+            return false;
+        }
+
+        *cfg = default_config();
+
+        process_ini ini;
+        if (recipe_path == nullptr || !ini.load(recipe_path)) {
+            return true;
+        }
+
+        cfg->gamma_tol = (float)ini.get_double("LUT_PLAN", "GAMMA_TOL", cfg->gamma_tol);
+        cfg->lumi_tol = (float)ini.get_double("LUT_PLAN", "LUMI_TOL", cfg->lumi_tol);
+        cfg->min_points = ini.get_int("LUT_PLAN", "MIN_POINTS", cfg->min_points);
+        cfg->noise_floor = (float)ini.get_double("LUT_PLAN", "NOISE_FLOOR", cfg->noise_floor);
+        return true;
+    }
+
+    __declspec(dllexport) lut_planner* process_lut_planner_create(int max_level, int interval, int cnt,
+                                                                  const struct lut_plan_config* cfg)
+    {
+        if (max_level <= 0 || interval <= 0 || cnt <= 0) {
+            return nullptr;
+        }
+
+        lut_planner* planner = new (std::nothrow) lut_planner();
+        if (planner == nullptr) {
+            return nullptr;
+        }
+
+        planner->config = (cfg != nullptr) ? *cfg : default_config();
+        if (planner->config.min_points < 3) planner->config.min_points = 3;
+        if (planner->config.noise_floor < 0.0f) planner->config.noise_floor = 0.0f;
+
+        planner->max_level = max_level;
+        for (int k = 1; k < cnt; ++k) {
+            const long long level = (long long)max_level - (long long)k * interval;
+            if (level <= 0) break;
+            planner->candidates.push_back((int)level);
+        }
+        planner->used.assign(planner->candidates.size(), false);
+        planner->measured = 0;
+        planner->anchor_tried = false;
+        planner->converged = false;
+        planner->exhausted = false;
+        return planner;
+    }
+
+    __declspec(dllexport) void process_lut_planner_destroy(lut_planner* planner)
+    {
+        delete planner;
+    }
+
+    __declspec(dllexport) int process_lut_planner_next(lut_planner* planner)
+    {
+        if (planner == nullptr) {
+            return -1;
+        }
+        if (!planner->anchor_tried) {
+            return planner->max_level;
+        }
+        if (!planner->acc.anchor_fixed || planner->converged) {
+            return -1;
+        }
+
+        // 현재 기울기/잔차로 후보 평가 (추정 전에는 가정값 사용)
+        double gamma = PRIOR_GAMMA;
+        if (planner->acc.n >= 2) {
+            gamma = planner->acc.result().gamma;
+        }
+        double resid_sd = -1.0;
+        planner->acc.gamma_stderr(&resid_sd);
+        const double rel_noise = (resid_sd > 0.0) ? resid_sd : DEFAULT_REL_NOISE;
+
+        int best = -1;
+        double best_score = -1.0;
+        for (size_t i = 0; i < planner->candidates.size(); ++i) {
+            if (planner->used[i]) continue;
+            double s = score(planner, planner->candidates[i], gamma, rel_noise);
+            if (s >= 0.0 && s > best_score) {
+                best_score = s;
+                best = (int)i;
+            }
+        }
+        if (best < 0) {
+            planner->exhausted = true;
+            return -1;
+        }
+        return planner->candidates[best];
+    }
+
+    __declspec(dllexport) bool process_lut_planner_add(lut_planner* planner, int level, double luminance)
+    {
+        if (planner == nullptr || level <= 0) {
+            return false;
+        }
+
+        ++planner->measured;
+        if (level == planner->max_level && !planner->anchor_tried) {
+            planner->anchor_tried = true;
+            if (!planner->acc.set_anchor(level, luminance)) {
+                return false;
+            }
+        }
+        else {
+            auto it = std::find(planner->candidates.begin(), planner->candidates.end(), level);
+            if (it != planner->candidates.end()) {
+                planner->used[it - planner->candidates.begin()] = true;
+            }
+            if (!planner->acc.add(level, luminance)) {
+                return false;
+            }
+        }
+
+        planner->measured_log.push_back(std::log((double)level));
+        update_converged(planner);
+        return true;
+    }
+
+    __declspec(dllexport) bool process_lut_planner_get(const lut_planner* planner, struct lut_parameter* param,
+                                                       struct lut_plan_stats* stats)
+    {
+        if (planner == nullptr) {
+            return false;
+        }
+
+        if (param != nullptr) {
+            *param = planner->acc.result();
+        }
+        if (stats != nullptr) {
+            double gamma_ci, lumi_ci;
+            confidence(planner, &gamma_ci, &lumi_ci);
+            stats->measured = planner->measured;
+            stats->candidates = (int)planner->candidates.size() + 1;
+            stats->converged = planner->converged ? 1 : 0;
+            stats->gamma_ci = (float)gamma_ci;
+            stats->lumi_ci = (float)lumi_ci;
+        }
+        return true;
+    }
+
+    __declspec(dllexport) bool getLUTdata_adaptive_ctx(process_context* ctx, int rgb, float RV, float GV, float BV,
+                                                       int interval, int cnt, const struct lut_plan_config* cfg,
+                                                       struct LUT_Data* series, int capacity, int* count,
+                                                       struct lut_plan_stats* stats, struct output* out)
+    {
+        if (count != nullptr) {
+            *count = 0;
+        }
+        if (ctx == nullptr || out == nullptr || rgb < 0 || rgb >= 3) {
+            return false;
+        }
+
+        const int base[3] = { (int)std::lround(RV), (int)std::lround(GV), (int)std::lround(BV) };
+        if (base[0] < 0 || base[1] < 0 || base[2] < 0) {
+            return false;
+        }
+        lut_planner* planner = process_lut_planner_create(base[rgb], interval, cnt, cfg);
+        if (planner == nullptr) {
+            return false;
+        }
+
+        std::vector<LUT_Data>& points = ctx->lut_points[rgb];
+        points.clear();
+
+        // 단색 패턴 (1:R 2:G 3:B)
+        PGPattern_ctx(ctx, rgb + 1);
+
+        int voltage[3] = { base[0], base[1], base[2] };
+        for (int level = process_lut_planner_next(planner); level > 0; level = process_lut_planner_next(planner)) {
+            LUT_Data point;
+            lut_measure_level(ctx, rgb, voltage, level, &point);
+            process_lut_planner_add(planner, level, point.luminance);
+            points.push_back(point);
+        }
+
+        // PG 전압 복귀
+        lut_send_voltage(ctx, base);
+
+        std::sort(points.begin(), points.end(),
+                  [](const LUT_Data& a, const LUT_Data& b) { return a.index < b.index; });
+
+        struct lut_plan_stats st;
+        process_lut_planner_get(planner, &out->lut[rgb], &st);
+        mark_dirty_lut(ctx, rgb);
+
+        const bool anchored = planner->acc.anchor_fixed;
+        const bool finished = planner->converged || planner->exhausted;
+        process_lut_planner_destroy(planner);
+
+        if (stats != nullptr) {
+            *stats = st;
+        }
+        if (count != nullptr) {
+            *count = (int)points.size();
+        }
+        if (series != nullptr && capacity > 0) {
+            std::copy_n(points.begin(), std::min((int)points.size(), capacity), series);
+        }
+        return anchored && finished;
+    }
+
+} // extern "C"
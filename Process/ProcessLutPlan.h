@@ -0,0 +1,83 @@
+#pragma once
+// ProcessLutPlan.h : 적응형 LUT 계조 측정 계획
+// 고정 간격 스윕(getLUTdata) 대신 측정할 때마다 다음 계조를 골라 수렴하면 중단
+//   1) 최대 계조(시작 전압)를 먼저 측정하여 앵커로 고정 → max_index, max_lumi
+//   2) 후보(시작 전압 - k × interval, k = 1 ~ cnt-1) 중 정보량이 가장 큰 계조 선택
+//      정보량 = (ln i - ln max_index)² / 예상 상대 분산 × 기존 측정점과의 로그 거리
+//      예상 상대 분산 = 잔차 표준편차² + (noise_floor / 예상 휘도)²  (저휘도 측정 잡음 반영)
+//      noise_floor / 예상 휘도 > lumi_tol 인 저휘도 계조는 측정하지 않음 (블랙/잡음이 회귀를 왜곡)
+//   3) 95% 신뢰구간 반폭이 gamma ≤ gamma_tol, max_lumi(상대) ≤ lumi_tol 이면 중단
+//      gamma: t × SE(앵커를 지나는 로그 회귀),  max_lumi: t × 로그 잔차 표준편차 (앵커 1회 측정의 상대 오차)
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 계획 설정 (Recipe [LUT_PLAN])
+    struct lut_plan_config {
+        float gamma_tol;            // gamma 신뢰구간 반폭 허용값 (GAMMA_TOL, 기본 0.02)
+        float lumi_tol;             // max_lumi 상대 신뢰구간 반폭 허용값 (LUMI_TOL, 기본 0.01)
+        int min_points;             // 최소 측정 점 수 - 앵커 포함, 3 이상 (MIN_POINTS, 기본 4)
+        float noise_floor;          // 측정기 절대 잡음 (cd/m², NOISE_FLOOR, 기본 0.05)
+    };
+
+    // 계획 진행 상태
+    struct lut_plan_stats {
+        int measured;               // 측정한 점 수 (실패 포함)
+        int candidates;             // 전체 후보 점 수 (앵커 포함 = 고정 스윕의 측정 수)
+        int converged;              // 1: 허용값 이내로 수렴하여 중단
+        float gamma_ci;             // gamma 95% 신뢰구간 반폭 (계산 불가 시 -1)
+        float lumi_ci;              // max_lumi 상대 95% 신뢰구간 반폭 (계산 불가 시 -1)
+    };
+
+    typedef struct lut_planner lut_planner;
+
+    // ===== 적응형 LUT 측정 (26.10.16) =====
+
+    /// <summary>
+    /// Recipe [LUT_PLAN] 읽기 (recipe_path가 nullptr이거나 키가 없으면 기본값)
+    /// </summary>
+    __declspec(dllexport) bool lut_plan_default_config(const char* recipe_path, struct lut_plan_config* cfg);
+
+    /// <summary>
+    /// 계획 생성 - 후보: max_level - k × interval (k = 0 ~ cnt-1, 0 이하 제외), cfg nullptr: 기본값
+    /// </summary>
+    __declspec(dllexport) lut_planner* process_lut_planner_create(int max_level, int interval, int cnt,
+                                                                  const struct lut_plan_config* cfg);
+
+    __declspec(dllexport) void process_lut_planner_destroy(lut_planner* planner);
+
+    /// <summary>
+    /// 다음 측정 계조 (첫 호출은 max_level) - 수렴했거나 측정 가능한 후보가 없으면 -1
+    /// </summary>
+    __declspec(dllexport) int process_lut_planner_next(lut_planner* planner);
+
+    /// <summary>
+    /// 측정 결과 반영 (luminance &lt;= 0 이면 실패로 기록되어 계산에서 제외, false 반환)
+    /// </summary>
+    __declspec(dllexport) bool process_lut_planner_add(lut_planner* planner, int level, double luminance);
+
+    /// <summary>
+    /// 현재 LUT 파라미터 및 진행 상태 (각각 nullptr 허용)
+    /// </summary>
+    __declspec(dllexport) bool process_lut_planner_get(const lut_planner* planner, struct lut_parameter* param,
+                                                       struct lut_plan_stats* stats);
+
+    /// <summary>
+    /// 적응형 계조 측정 - getLUTdata_series_ctx와 같은 인자, 측정점은 계조 오름차순으로 기록
+    /// 앵커 측정이 성공하고 수렴했거나 측정 가능한 후보를 모두 측정했으면 true
+    /// </summary>
+    __declspec(dllexport) bool getLUTdata_adaptive_ctx(process_context* ctx, int rgb, float RV, float GV, float BV,
+                                                       int interval, int cnt, const struct lut_plan_config* cfg,
+                                                       struct LUT_Data* series, int capacity, int* count,
+                                                       struct lut_plan_stats* stats, struct output* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
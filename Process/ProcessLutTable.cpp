@@ -0,0 +1,320 @@
+// ProcessLutTable.cpp : LUT 정방향/역방향 테이블 생성 및 일괄 조회
+
+#include "pch.h"
+#include "ProcessLutTable.h"
+#include "ProcessFastMath.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+
+struct lut_table {
+    std::atomic<int> refs;
+    lut_table_info info;
+    lut_parameter param[3];
+    float range[3];                     // max_lumi - black
+    float inv_range[3];                 // 1 / range
+    float inv_gamma[3];                 // 1 / gamma
+    std::unique_ptr<unsigned char[]> storage;
+};
+
+namespace {
+
+    const int DEFAULT_INVERSE_SIZE = 4096;
+    const int MAX_FORWARD_COUNT = 1 << 20;      // 비정상 max_index로 인한 과다 할당 방지
+    const size_t CACHE_LIMIT = 32;
+
+    size_t align_floats(size_t count)
+    {
+        return (count + 15) & ~(size_t)15;      // 64바이트 = float 16개
+    }
+
+    uint64_t hash_params(const lut_parameter* param, int inverse_size)
+    {
+        // FNV-1a
+        uint64_t h = 1469598103934665603ull;
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(param);
+        for (size_t i = 0; i < sizeof(lut_parameter) * 3; ++i) {
+            h = (h ^ p[i]) * 1099511628211ull;
+        }
+        for (int i = 0; i < 4; ++i) {
+            h = (h ^ (unsigned char)(inverse_size >> (i * 8))) * 1099511628211ull;
+        }
+        return h;
+    }
+
+    bool channel_valid(const lut_parameter& p)
+    {
+        return p.max_index >= 1.0f && p.max_lumi > p.black && p.gamma > 0.0f &&
+               std::isfinite(p.max_index) && std::isfinite(p.max_lumi) && std::isfinite(p.gamma);
+    }
+
+    int forward_count(const lut_parameter& p)
+    {
+        if (!channel_valid(p)) return 0;
+        double count = std::floor((double)p.max_index) + 1.0;
+        return count > MAX_FORWARD_COUNT ? MAX_FORWARD_COUNT : (int)count;
+    }
+
+    lut_table* create_table(const lut_parameter* param, int inverse_size, uint64_t hash)
+    {
+        std::unique_ptr<lut_table> table(new (std::nothrow) lut_table());
+        if (!table) return nullptr;
+
+        table->refs = 1;
+        std::memset(&table->info, 0, sizeof(table->info));
+        table->info.hash = hash;
+        table->info.inverse_size = inverse_size;
+
+        size_t total = 16;      // 정렬 여유분
+        for (int ch = 0; ch < 3; ++ch) {
+            table->param[ch] = param[ch];
+            table->info.forward_count[ch] = forward_count(param[ch]);
+            if (table->info.forward_count[ch] > 0) {
+                total += align_floats((size_t)table->info.forward_count[ch]) + align_floats((size_t)inverse_size);
+            }
+        }
+
+        table->storage.reset(new (std::nothrow) unsigned char[total * sizeof(float)]);
+        if (!table->storage) return nullptr;
+
+        uintptr_t base = reinterpret_cast<uintptr_t>(table->storage.get());
+        float* cursor = reinterpret_cast<float*>((base + 63) & ~(uintptr_t)63);
+
+        for (int ch = 0; ch < 3; ++ch) {
+            const lut_parameter& p = param[ch];
+            const int count = table->info.forward_count[ch];
+            if (count == 0) continue;
+
+            table->range[ch] = p.max_lumi - p.black;
+            table->inv_range[ch] = 1.0f / table->range[ch];
+            table->inv_gamma[ch] = 1.0f / p.gamma;
+
+            // 정방향: (i / max_index)^gamma 를 한 번에 계산 후 휘도로 변환
+            float* forward = cursor;
+            cursor += align_floats((size_t)count);
+            const float inv_max = 1.0f / p.max_index;
+            for (int i = 0; i < count; ++i) forward[i] = (float)i * inv_max;
+            fastmath::fast_pow_array(forward, p.gamma, forward, count);
+            for (int i = 0; i < count; ++i) forward[i] = p.black + table->range[ch] * forward[i];
+
+            // 역방향: 휘도 등분점의 index = max_index × t^(1/gamma)
+            float* inverse = cursor;
+            cursor += align_floats((size_t)inverse_size);
+            const float inv_steps = 1.0f / (float)(inverse_size - 1);
+            for (int k = 0; k < inverse_size; ++k) inverse[k] = (float)k * inv_steps;
+            fastmath::fast_pow_array(inverse, table->inv_gamma[ch], inverse, inverse_size);
+            for (int k = 0; k < inverse_size; ++k) inverse[k] *= p.max_index;
+
+            table->info.forward[ch] = forward;
+            table->info.inverse[ch] = inverse;
+            table->info.lumi_min[ch] = p.black;
+            table->info.lumi_step[ch] = table->range[ch] * inv_steps;
+        }
+
+        return table.release();
+    }
+
+    void release_table(lut_table* table)
+    {
+        if (table != nullptr && --table->refs == 0) {
+            delete table;
+        }
+    }
+
+    // 파라미터 해시 캐시 (캐시가 참조 1개 보유, 오래된 항목부터 제거)
+    struct table_cache {
+        std::mutex lock;
+        std::map<uint64_t, lut_table*> tables;
+        std::deque<uint64_t> order;
+    };
+
+    table_cache& cache()
+    {
+        static table_cache s_cache;
+        return s_cache;
+    }
+
+    // luminance → 소수 index (max_index × ((L - black) / range)^(1/gamma), [0, max_index] 제한)
+    void lookup_index(const lut_table* table, int rgb, const float* luminance, int n, float* index)
+    {
+        const lut_parameter& p = table->param[rgb];
+        const float black = p.black;
+        const float inv_range = table->inv_range[rgb];
+        const float inv_gamma = table->inv_gamma[rgb];
+        const float limit = std::min((float)(table->info.forward_count[rgb] - 1), p.max_index);
+
+        int i = 0;
+#ifdef PROCESS_FASTMATH_SSE2
+        const __m128 vblack = _mm_set1_ps(black);
+        const __m128 vinv_range = _mm_set1_ps(inv_range);
+        const __m128 vinv_gamma = _mm_set1_ps(inv_gamma);
+        const __m128 vmax = _mm_set1_ps(p.max_index);
+        const __m128 vlimit = _mm_set1_ps(limit);
+        const __m128 one = _mm_set1_ps(1.0f);
+        for (; i + 4 <= n; i += 4) {
+            __m128 t = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(luminance + i), vblack), vinv_range);
+            t = _mm_min_ps(t, one);
+            __m128 r = _mm_mul_ps(vmax, fastmath::fast_pow_ps(t, vinv_gamma));
+            _mm_storeu_ps(index + i, _mm_min_ps(r, vlimit));
+        }
+#endif
+        for (; i < n; ++i) {
+            float t = (luminance[i] - black) * inv_range;
+            if (t > 1.0f) t = 1.0f;
+            float r = p.max_index * fastmath::fast_pow(t, inv_gamma);
+            index[i] = r < limit ? r : limit;
+        }
+    }
+
+    bool channel_ready(const lut_table* table, int rgb)
+    {
+        return table != nullptr && rgb >= 0 && rgb < 3 && table->info.forward_count[rgb] > 0;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) lut_table* process_lut_table_build(const struct lut_parameter* param, int inverse_size)
+    {
+        if (param == nullptr) {
+            return nullptr;
+        }
+        if (inverse_size <= 0) inverse_size = DEFAULT_INVERSE_SIZE;
+        if (inverse_size < 2) inverse_size = 2;
+
+        const uint64_t hash = hash_params(param, inverse_size);
+        table_cache& c = cache();
+        {
+            std::lock_guard<std::mutex> lock(c.lock);
+            auto it = c.tables.find(hash);
+            if (it != c.tables.end() && std::memcmp(it->second->param, param, sizeof(lut_parameter) * 3) == 0 &&
+                it->second->info.inverse_size == inverse_size) {
+                ++it->second->refs;
+                return it->second;
+            }
+        }
+
+        // 잠금 밖에서 생성 (동시에 같은 요청이 오면 먼저 등록된 테이블 사용)
+        lut_table* table = create_table(param, inverse_size, hash);
+        if (table == nullptr) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(c.lock);
+        auto it = c.tables.find(hash);
+        if (it != c.tables.end()) {
+            if (std::memcmp(it->second->param, param, sizeof(lut_parameter) * 3) == 0 &&
+                it->second->info.inverse_size == inverse_size) {
+                release_table(table);
+                ++it->second->refs;
+                return it->second;
+            }
+            return table;       // 해시 충돌 - 캐시하지 않음
+        }
+
+        while (c.order.size() >= CACHE_LIMIT) {
+            auto old = c.tables.find(c.order.front());
+            c.order.pop_front();
+            if (old != c.tables.end()) {
+                release_table(old->second);
+                c.tables.erase(old);
+            }
+        }
+        ++table->refs;
+        c.tables[hash] = table;
+        c.order.push_back(hash);
+        return table;
+    }
+
+    __declspec(dllexport) void process_lut_table_release(lut_table* table)
+    {
+        release_table(table);
+    }
+
+    __declspec(dllexport) bool process_lut_table_info(const lut_table* table, struct lut_table_info* info)
+    {
+        if (table == nullptr || info == nullptr) {
+            return false;
+        }
+        *info = table->info;
+        return true;
+    }
+
+    __declspec(dllexport) int process_lut_table_lookup(const lut_table* table, int rgb,
+                                                       const float* luminance, int n, float* index)
+    {
+        if (!channel_ready(table, rgb) || luminance == nullptr || index == nullptr || n < 0) {
+            return -1;
+        }
+
+        lookup_index(table, rgb, luminance, n, index);
+        return n;
+    }
+
+    __declspec(dllexport) int process_lut_table_lookup_code(const lut_table* table, int rgb,
+                                                            const float* luminance, int n, int* code)
+    {
+        if (!channel_ready(table, rgb) || luminance == nullptr || code == nullptr || n < 0) {
+            return -1;
+        }
+
+        const float* forward = table->info.forward[rgb];
+        const int last = table->info.forward_count[rgb] - 1;
+
+        float index[256];
+        for (int start = 0; start < n; start += 256) {
+            const int chunk = (n - start) < 256 ? (n - start) : 256;
+            lookup_index(table, rgb, luminance + start, chunk, index);
+
+            for (int i = 0; i < chunk; ++i) {
+                int c0 = (int)index[i];
+                if (c0 > last) c0 = last;
+                const int c1 = (c0 < last) ? c0 + 1 : c0;
+                const float target = luminance[start + i];
+                code[start + i] = (std::fabs(forward[c1] - target) < std::fabs(forward[c0] - target)) ? c1 : c0;
+            }
+        }
+        return n;
+    }
+
+    __declspec(dllexport) int process_lut_table_forward(const lut_table* table, int rgb,
+                                                        const float* index, int n, float* luminance)
+    {
+        if (!channel_ready(table, rgb) || index == nullptr || luminance == nullptr || n < 0) {
+            return -1;
+        }
+
+        const float* forward = table->info.forward[rgb];
+        const int last = table->info.forward_count[rgb] - 1;
+
+        for (int i = 0; i < n; ++i) {
+            float x = index[i];
+            if (!(x > 0.0f)) x = 0.0f;
+            if (x > (float)last) x = (float)last;
+
+            const int i0 = (int)x;
+            const int i1 = (i0 < last) ? i0 + 1 : i0;
+            const float frac = x - (float)i0;
+            luminance[i] = forward[i0] + (forward[i1] - forward[i0]) * frac;
+        }
+        return n;
+    }
+
+    __declspec(dllexport) void process_lut_table_clear_cache()
+    {
+        table_cache& c = cache();
+        std::lock_guard<std::mutex> lock(c.lock);
+        for (auto& entry : c.tables) {
+            release_table(entry.second);
+        }
+        c.tables.clear();
+        c.order.clear();
+    }
+
+} // extern "C"
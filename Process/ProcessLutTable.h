@@ -0,0 +1,78 @@
+#pragma once
+// ProcessLutTable.h : LUT 정방향/역방향 테이블 생성 및 일괄 조회
+// cal_lut 결과(lut_parameter[3])로 채널별 전체 테이블을 한 번에 생성
+//   정방향: L(i) = black + (max_lumi - black) × (i / max_index)^gamma,  i = 0 ~ max_index
+//   역방향: 휘도 구간 [black, max_lumi]를 inverse_size 등분한 점의 계조 index (소수)
+// pow는 ProcessFastMath.h의 근사식 사용 (SSE2 4개 동시) - 상대 오차 1.2e-5 미만
+// 모든 테이블은 64바이트 정렬된 한 버퍼에 배치되며, 파라미터 해시로 캐시됨 (같은 요청은 재계산 없음)
+// 이 트리의 계조 index는 PG 전압 코드와 같음 (getLUTdata 스윕 참고)
+
+#include "ProcessFunctions.h"
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    typedef struct lut_table lut_table;
+
+    // 테이블 배치 정보 (C#에서 포인터로 직접 참조 가능)
+    struct lut_table_info {
+        uint64_t hash;                  // 파라미터 해시 (캐시 키)
+        int forward_count[3];           // 채널별 정방향 항목 수 (max_index + 1, 무효 채널은 0)
+        int inverse_size;               // 채널별 역방향 항목 수
+        const float* forward[3];        // 정방향 테이블 [index] → 휘도
+        const float* inverse[3];        // 역방향 테이블 [k] → index (휘도 = lumi_min + k × lumi_step)
+        float lumi_min[3];              // 역방향 첫 항목 휘도 (black)
+        float lumi_step[3];             // 역방향 휘도 간격
+    };
+
+    // ===== LUT 테이블 (26.10.16) =====
+
+    /// <summary>
+    /// 테이블 생성 또는 캐시에서 가져오기 (inverse_size &lt;= 0: 4096) - 실패 시 nullptr
+    /// 반환된 테이블은 process_lut_table_release로 반드시 해제
+    /// </summary>
+    __declspec(dllexport) lut_table* process_lut_table_build(const struct lut_parameter* param, int inverse_size);
+
+    /// <summary>
+    /// 테이블 참조 해제 (nullptr 허용) - 캐시에 남아 있으면 다음 요청 시 재사용됨
+    /// </summary>
+    __declspec(dllexport) void process_lut_table_release(lut_table* table);
+
+    /// <summary>
+    /// 테이블 배치 정보 조회
+    /// </summary>
+    __declspec(dllexport) bool process_lut_table_info(const lut_table* table, struct lut_table_info* info);
+
+    /// <summary>
+    /// 목표 휘도 → 계조 index (소수, [0, max_index]로 제한) 일괄 변환 - 변환한 개수 반환 (실패 시 -1)
+    /// </summary>
+    __declspec(dllexport) int process_lut_table_lookup(const lut_table* table, int rgb,
+                                                       const float* luminance, int n, float* index);
+
+    /// <summary>
+    /// 목표 휘도 → 가장 가까운 정수 계조 코드 (= PG 전압 코드) 일괄 변환
+    /// 근사 index 주변 두 코드 중 정방향 테이블 휘도가 목표에 더 가까운 코드 선택
+    /// </summary>
+    __declspec(dllexport) int process_lut_table_lookup_code(const lut_table* table, int rgb,
+                                                            const float* luminance, int n, int* code);
+
+    /// <summary>
+    /// 계조 index (소수) → 휘도 일괄 변환 (정방향 테이블 선형 보간)
+    /// </summary>
+    __declspec(dllexport) int process_lut_table_forward(const lut_table* table, int rgb,
+                                                        const float* index, int n, float* luminance);
+
+    /// <summary>
+    /// 캐시 비우기 (참조 중인 테이블은 release 시 해제됨)
+    /// </summary>
+    __declspec(dllexport) void process_lut_table_clear_cache();
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
@@ -0,0 +1,154 @@
+// ProcessMappedFile.cpp : 파일 메모리 매핑 구현
+
+#include "pch.h"
+#include "ProcessMappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+mapped_file::mapped_file()
+    : m_writable(false)
+#ifdef _WIN32
+    , m_handle(INVALID_HANDLE_VALUE)
+#else
+    , m_fd(-1)
+#endif
+{
+}
+
+mapped_file::~mapped_file()
+{
+    close();
+}
+
+bool mapped_file::open(const char* path, bool writable, bool create)
+{
+    close();
+    if (path == nullptr || path[0] == '\0') {
+        return false;
+    }
+
+#ifdef _WIN32
+    HANDLE h = CreateFileA(path, writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                           create ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (h == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    m_handle = h;
+#else
+    int flags = writable ? O_RDWR : O_RDONLY;
+    if (create) flags |= O_CREAT;
+    m_fd = ::open(path, flags, 0644);
+    if (m_fd < 0) {
+        return false;
+    }
+#endif
+    m_writable = writable;
+    return true;
+}
+
+void mapped_file::close()
+{
+#ifdef _WIN32
+    if (m_handle != INVALID_HANDLE_VALUE) {
+        CloseHandle((HANDLE)m_handle);
+        m_handle = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+#endif
+}
+
+bool mapped_file::is_open() const
+{
+#ifdef _WIN32
+    return m_handle != INVALID_HANDLE_VALUE;
+#else
+    return m_fd >= 0;
+#endif
+}
+
+int64_t mapped_file::size() const
+{
+#ifdef _WIN32
+    LARGE_INTEGER li;
+    if (m_handle == INVALID_HANDLE_VALUE || !GetFileSizeEx((HANDLE)m_handle, &li)) return -1;
+    return (int64_t)li.QuadPart;
+#else
+    struct stat st;
+    if (m_fd < 0 || fstat(m_fd, &st) != 0) return -1;
+    return (int64_t)st.st_size;
+#endif
+}
+
+bool mapped_file::resize(int64_t size)
+{
+    if (!m_writable || size < 0) {
+        return false;
+    }
+
+#ifdef _WIN32
+    LARGE_INTEGER li;
+    li.QuadPart = size;
+    return SetFilePointerEx((HANDLE)m_handle, li, NULL, FILE_BEGIN) && SetEndOfFile((HANDLE)m_handle);
+#else
+    return ftruncate(m_fd, (off_t)size) == 0;
+#endif
+}
+
+void* mapped_file::map(int64_t offset, size_t length)
+{
+    if (!is_open() || length == 0 || offset < 0 || (offset % (int64_t)MAPPED_FILE_ALIGN) != 0) {
+        return nullptr;
+    }
+
+#ifdef _WIN32
+    // 매핑 객체는 뷰가 참조를 유지하므로 바로 닫아도 됨
+    const uint64_t end = (uint64_t)offset + length;
+    HANDLE mapping = CreateFileMappingA((HANDLE)m_handle, NULL, m_writable ? PAGE_READWRITE : PAGE_READONLY,
+                                        (DWORD)(end >> 32), (DWORD)(end & 0xFFFFFFFF), NULL);
+    if (mapping == NULL) {
+        return nullptr;
+    }
+    void* p = MapViewOfFile(mapping, m_writable ? FILE_MAP_WRITE : FILE_MAP_READ,
+                            (DWORD)((uint64_t)offset >> 32), (DWORD)((uint64_t)offset & 0xFFFFFFFF), length);
+    CloseHandle(mapping);
+    return p;
+#else
+    void* p = mmap(nullptr, length, m_writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED,
+                   m_fd, (off_t)offset);
+    return (p == MAP_FAILED) ? nullptr : p;
+#endif
+}
+
+void mapped_file::unmap(void* base, size_t length)
+{
+    if (base == nullptr) return;
+#ifdef _WIN32
+    (void)length;
+    UnmapViewOfFile(base);
+#else
+    munmap(base, length);
+#endif
+}
+
+bool mapped_file::sync(void* base, size_t length)
+{
+#ifdef _WIN32
+    if (base != nullptr && !FlushViewOfFile(base, length)) return false;
+    return m_handle == INVALID_HANDLE_VALUE || FlushFileBuffers((HANDLE)m_handle) != 0;
+#else
+    if (base != nullptr && msync(base, length, MS_SYNC) != 0) return false;
+    return m_fd < 0 || fsync(m_fd) == 0;
+#endif
+}
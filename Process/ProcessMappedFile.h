@@ -0,0 +1,49 @@
+#pragma once
+// ProcessMappedFile.h : 파일 메모리 매핑 (DLL 내부 전용)
+// Windows: CreateFile + CreateFileMapping / Linux: open + mmap
+// 매핑 오프셋은 MAPPED_FILE_ALIGN(64KB, Windows 할당 단위) 배수여야 함
+
+#include <stddef.h>
+#include <stdint.h>
+
+const size_t MAPPED_FILE_ALIGN = 65536;
+
+inline uint64_t mapped_align_up(uint64_t value)
+{
+    return (value + MAPPED_FILE_ALIGN - 1) & ~(uint64_t)(MAPPED_FILE_ALIGN - 1);
+}
+
+class mapped_file {
+public:
+    mapped_file();
+    ~mapped_file();
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    // 파일 열기 (writable: 읽기/쓰기, create: 없으면 생성) - 실패 시 false
+    bool open(const char* path, bool writable, bool create);
+    void close();
+    bool is_open() const;
+
+    // 현재 파일 크기 (실패 시 -1)
+    int64_t size() const;
+
+    // 파일 크기 변경 (늘린 영역은 0) - 쓰기 모드 전용
+    bool resize(int64_t size);
+
+    // [offset, offset + length) 매핑 (offset은 MAPPED_FILE_ALIGN 배수) - 실패 시 nullptr
+    void* map(int64_t offset, size_t length);
+    void unmap(void* base, size_t length);
+
+    // 매핑 영역 / 파일을 디스크에 기록
+    bool sync(void* base, size_t length);
+
+private:
+    bool m_writable;
+#ifdef _WIN32
+    void* m_handle;         // HANDLE
+#else
+    int m_fd;
+#endif
+};
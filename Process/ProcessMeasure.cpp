@@ -0,0 +1,157 @@
+// ProcessMeasure.cpp : 다중 WAD 동시 측정
+
+#include "pch.h"
+#include "ProcessMeasure.h"
+#include "ProcessContext.h"
+#include "ProcessIni.h"
+#include "ProcessThreadPool.h"
+#include <future>
+#include <memory>
+#include <string>
+
+namespace {
+
+    // Recipe 키에 쓰이는 각도 이름 (A/B는 포트 키 없음)
+    const char* const WAD_KEY_NAMES[7] = { "", "30", "45", "60", "15", nullptr, nullptr };
+
+    bool wad_connected(const process_context* ctx, int wad)
+    {
+        return (wad == 0) ? (ctx->ports.meas_connected != 0) : (ctx->wad_ports[wad] >= 0);
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool Meas_Turn_wad_ctx(process_context* ctx, int wad, int port)
+    {
+        if (ctx == nullptr || wad < 0 || wad >= 7 || port < 0) {
+            return false;
+        }
+        if (wad == 0) {
+            return Meas_Turn_ctx(ctx, port);
+        }
+
+        meter_device* meter = wad_meter(ctx, wad);
+        if (ctx->wad_ports[wad] >= 0) {
+            meter->close();
+        }
+        if (!meter->open(port)) {
+            ctx->wad_ports[wad] = -1;
+            return false;
+        }
+
+        ctx->wad_ports[wad] = port;
+        meter_cal_resolve(ctx, wad);
+        return true;
+    }
+
+    __declspec(dllexport) int Meas_Turn_recipe_ctx(process_context* ctx, const char* recipe_path, int zone_no)
+    {
+        if (ctx == nullptr || recipe_path == nullptr) {
+            return 0;
+        }
+
+        process_ini ini;
+        if (!ini.load(recipe_path)) {
+            return 0;
+        }
+
+        int mask = 0;
+        const std::string suffix = std::to_string(zone_no);
+        for (int w = 0; w < 7; ++w) {
+            if (WAD_KEY_NAMES[w] == nullptr) continue;
+
+            std::string key = (w == 0) ? "MEAS_PORT_" + suffix
+                                       : "MEAS_PORT_" + std::string(WAD_KEY_NAMES[w]) + "_" + suffix;
+            int port = ini.get_int("MTP", key, -1);
+            if (port < 0) continue;
+
+            if (Meas_Turn_wad_ctx(ctx, w, port)) {
+                mask |= 1 << w;
+            }
+        }
+        return mask;
+    }
+
+    __declspec(dllexport) int get_wad_mask_ctx(process_context* ctx)
+    {
+        if (ctx == nullptr) {
+            return 0;
+        }
+
+        int mask = 0;
+        for (int w = 0; w < 7; ++w) {
+            if (wad_connected(ctx, w)) mask |= 1 << w;
+        }
+        return mask;
+    }
+
+    __declspec(dllexport) int Getdata_multi_ctx(process_context* ctx, struct output* out, int wad_mask)
+    {
+        if (ctx == nullptr || out == nullptr) {
+            return 0;
+        }
+        wad_mask &= 0x7F;
+        meter_cal_refresh(ctx);
+
+        // 1) 모든 측정기 트리거 (즉시 반환) → 적분이 동시에 진행됨
+        int triggered = 0;
+        for (int w = 0; w < 7; ++w) {
+            if ((wad_mask & (1 << w)) && wad_meter(ctx, w)->trigger()) {
+                triggered |= 1 << w;
+            }
+        }
+
+        // 2) 적분 완료 대기 - 가장 늦게 끝나는 측정기 기준
+        int integrated = 0;
+        for (int w = 0; w < 7; ++w) {
+            if ((triggered & (1 << w)) && wad_meter(ctx, w)->wait_integrated()) {
+                integrated |= 1 << w;
+            }
+        }
+
+        // 3) 결과 전송은 측정기마다 독립적이므로 병행 수신 (첫 WAD는 호출 스레드에서 처리)
+        //26.10.16 - 나머지 WAD는 공용 스레드 풀에서 수신 (호출마다 스레드를 만들지 않음)
+        std::shared_ptr<process_thread_pool> pool;     // 수신이 끝날 때까지 풀 유지
+        std::future<bool> pending[7];
+        int first = -1;
+        for (int w = 0; w < 7; ++w) {
+            if (!(integrated & (1 << w))) continue;
+            if (first < 0) {
+                first = w;
+                continue;
+            }
+            meter_device* meter = wad_meter(ctx, w);
+            struct pattern* dst = &out->measure[w];
+            const meter_cal* cal = &ctx->cal.wad[w];
+            auto task = std::make_shared<std::packaged_task<bool()>>([meter, dst, cal] {
+                return meas_readout_from(meter, dst, cal);
+            });
+            pending[w] = task->get_future();
+            if (!pool) pool = process_shared_pool();
+            pool->submit([task] { (*task)(); });
+        }
+
+        int done = 0;
+        if (first >= 0 && meas_readout_from(wad_meter(ctx, first), &out->measure[first], &ctx->cal.wad[first])) {
+            done |= 1 << first;
+        }
+        for (int w = 0; w < 7; ++w) {
+            if (pending[w].valid() && pending[w].get()) {
+                done |= 1 << w;
+            }
+        }
+
+        for (int w = 0; w < 7; ++w) {
+            if (done & (1 << w)) mark_dirty_measure(ctx, w);
+        }
+        return done;
+    }
+
+    __declspec(dllexport) int Getdata_multi(struct output* out, int wad_mask)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return Getdata_multi_ctx(process_default_context(), out, wad_mask);
+    }
+
+} // extern "C"
@@ -0,0 +1,44 @@
+#pragma once
+// ProcessMeasure.h : 다중 WAD 동시 측정
+// WAD별 측정기(0/30/45/60/15도 …)를 한 번에 트리거하고 결과를 measure[wad]에 모아 기록
+// 순차 측정: Σ(적분 + 전송),  동시 측정: max(적분) + max(전송) - 가장 느린 측정기 시간
+//
+// WAD 인덱스는 C# WadAngle과 동일: 0:0도 1:30도 2:45도 3:60도 4:15도 5:A 6:B
+// WAD 0은 기존 Meas_Turn/Getdata 측정기를 그대로 사용
+
+#include "ProcessFunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // ===== 다중 WAD 측정 (26.10.16) =====
+
+    /// <summary>
+    /// WAD별 측정기 포트 연결 (wad 0은 Meas_Turn_ctx와 동일)
+    /// </summary>
+    __declspec(dllexport) bool Meas_Turn_wad_ctx(process_context* ctx, int wad, int port);
+
+    /// <summary>
+    /// Recipe [MTP] MEAS_PORT_&lt;zone_no&gt;, MEAS_PORT_&lt;각도&gt;_&lt;zone_no&gt; 키로 측정기 연결
+    /// 값이 비어 있는 각도는 건너뜀 - 연결된 WAD 마스크 반환 (bit w = WAD w)
+    /// </summary>
+    __declspec(dllexport) int Meas_Turn_recipe_ctx(process_context* ctx, const char* recipe_path, int zone_no);
+
+    /// <summary>
+    /// 연결된 WAD 마스크 조회
+    /// </summary>
+    __declspec(dllexport) int get_wad_mask_ctx(process_context* ctx);
+
+    /// <summary>
+    /// wad_mask의 측정기를 모두 동시에 트리거하여 measure[wad] 기록
+    /// 성공한 WAD 마스크 반환 (실패한 WAD의 measure는 변경되지 않음)
+    /// </summary>
+    __declspec(dllexport) int Getdata_multi_ctx(process_context* ctx, struct output* out, int wad_mask);
+
+    // 기본 컨텍스트 래퍼
+    __declspec(dllexport) int Getdata_multi(struct output* out, int wad_mask);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,258 @@
+// ProcessMeterCal.cpp : 측정기별 XYZ 보정 구현
+
+#include "pch.h"
+#include "ProcessMeterCal.h"
+#include "ProcessContext.h"
+#include "ProcessCpu.h"
+#include "ProcessIni.h"
+#include <cstdlib>
+#include <sys/stat.h>
+
+namespace {
+
+    const int CHECK_INTERVAL_MS = 500;      // 파일 변경 확인 최소 간격
+
+    // [7]:WAD => 0:0도, 1:30도, 2:45도, 3:60도, 4:15도, 5:A도, 6:B도
+    const char* const WAD_NAMES[7] = { "0", "30", "45", "60", "15", "A", "B" };
+
+    bool file_stamp(const std::string& path, long long* mtime, long long* size)
+    {
+#ifdef _WIN32
+        struct _stat64 st;
+        if (_stat64(path.c_str(), &st) != 0) return false;
+#else
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0) return false;
+#endif
+        *mtime = (long long)st.st_mtime;
+        *size = (long long)st.st_size;
+        return true;
+    }
+
+    bool is_absolute(const std::string& path)
+    {
+        return !path.empty() && (path[0] == '/' || path[0] == '\\' || (path.size() > 1 && path[1] == ':'));
+    }
+
+    std::string directory_of(const std::string& path)
+    {
+        std::string::size_type pos = path.find_last_of("/\\");
+        return (pos == std::string::npos) ? std::string() : path.substr(0, pos + 1);
+    }
+
+    // 쉼표 구분 float count개 (개수가 다르거나 숫자가 아니면 false)
+    bool parse_floats(const std::string& text, float* values, int count)
+    {
+        std::vector<std::string> parts = ini_split(text, ',');
+        if ((int)parts.size() != count) return false;
+
+        for (int i = 0; i < count; ++i) {
+            char* end = nullptr;
+            double v = std::strtod(parts[i].c_str(), &end);
+            if (parts[i].empty() || *end != '\0') return false;
+            values[i] = (float)v;
+        }
+        return true;
+    }
+
+    void set_identity(meter_cal* cal)
+    {
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) cal->col[c][r] = (c == r && c < 3) ? 1.0f : 0.0f;
+        }
+        cal->identity = true;
+    }
+
+    int wad_port(const process_context* ctx, int wad)
+    {
+        if (wad == 0) return ctx->ports.meas_connected ? ctx->ports.meas_port : -1;
+        return ctx->wad_ports[wad];
+    }
+
+    // 포트 + WAD 보정값 결정 (WAD 키 → 포트 기본 키 → 단위 행렬)
+    void resolve(const process_ini* file, int port, int wad, meter_cal* cal)
+    {
+        set_identity(cal);
+        if (file == nullptr || port < 0) return;
+
+        const std::string section = "PORT_" + std::to_string(port);
+        const std::string suffix = std::string("_") + WAD_NAMES[wad];
+
+        float m[9], o[3];
+        if (parse_floats(file->get(section, "MATRIX" + suffix), m, 9) ||
+            parse_floats(file->get(section, "MATRIX"), m, 9)) {
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) cal->col[c][r] = m[r * 3 + c];
+            }
+        }
+        if (parse_floats(file->get(section, "OFFSET" + suffix), o, 3) ||
+            parse_floats(file->get(section, "OFFSET"), o, 3)) {
+            for (int r = 0; r < 3; ++r) cal->col[3][r] = o[r];
+        }
+
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 3; ++r) {
+                if (cal->col[c][r] != ((c == r) ? 1.0f : 0.0f)) cal->identity = false;
+            }
+        }
+    }
+
+    // 보정 파일 읽기 (state->path 기준)
+    bool load_file(meter_cal_state* state)
+    {
+        std::shared_ptr<process_ini> ini = std::make_shared<process_ini>();
+        long long mtime = 0, size = 0;
+        if (!file_stamp(state->path, &mtime, &size) || !ini->load(state->path.c_str())) {
+            return false;
+        }
+
+        state->file = ini;
+        state->mtime = mtime;
+        state->size = size;
+        for (int w = 0; w < 7; ++w) state->wad_port[w] = -2;
+        return true;
+    }
+
+    bool reload_if_changed(process_context* ctx)
+    {
+        meter_cal_state& st = ctx->cal;
+        st.checked = std::chrono::steady_clock::now();
+
+        long long mtime = 0, size = 0;
+        if (st.path.empty() || !file_stamp(st.path, &mtime, &size) || (mtime == st.mtime && size == st.size)) {
+            return false;
+        }
+        return load_file(&st);
+    }
+}
+
+void meter_cal_init(meter_cal_state* state)
+{
+    state->path.clear();
+    state->mtime = state->size = 0;
+    state->checked = std::chrono::steady_clock::time_point();
+    state->file.reset();
+    for (int w = 0; w < 7; ++w) {
+        set_identity(&state->wad[w]);
+        state->wad_port[w] = -2;
+    }
+}
+
+void meter_cal_resolve(process_context* ctx, int wad)
+{
+    const int port = wad_port(ctx, wad);
+    resolve(ctx->cal.file.get(), port, wad, &ctx->cal.wad[wad]);
+    ctx->cal.wad_port[wad] = port;
+}
+
+void meter_cal_refresh(process_context* ctx)
+{
+    meter_cal_state& st = ctx->cal;
+    if (!st.path.empty() &&
+        std::chrono::steady_clock::now() - st.checked >= std::chrono::milliseconds(CHECK_INTERVAL_MS)) {
+        reload_if_changed(ctx);
+    }
+
+    for (int w = 0; w < 7; ++w) {
+        if (st.wad_port[w] != wad_port(ctx, w)) meter_cal_resolve(ctx, w);
+    }
+}
+
+void meter_cal_apply(const meter_cal& cal, struct pattern* dst)
+{
+    if (cal.identity) {
+        return;
+    }
+
+    const float x = dst->x, y = dst->y, L = dst->L;
+    const float X = x / y * L;
+    const float Z = (1.0f - x - y) / y * L;
+
+    float r[4];
+#if defined(PROCESS_CPU_SSE2)
+    __m128 v = _mm_mul_ps(_mm_loadu_ps(cal.col[0]), _mm_set1_ps(X));
+    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(cal.col[1]), _mm_set1_ps(L)));
+    v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(cal.col[2]), _mm_set1_ps(Z)));
+    v = _mm_add_ps(v, _mm_loadu_ps(cal.col[3]));
+    _mm_storeu_ps(r, v);
+#else
+    for (int i = 0; i < 3; ++i) {
+        r[i] = cal.col[0][i] * X + cal.col[1][i] * L + cal.col[2][i] * Z + cal.col[3][i];
+    }
+#endif
+
+    const float sum = r[0] + r[1] + r[2];
+    dst->x = r[0] / sum;
+    dst->y = r[1] / sum;
+    dst->L = r[1];
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_meter_cal_load_ctx(process_context* ctx, const char* path)
+    {
+        if (ctx == nullptr) {
+            return false;
+        }
+
+        if (path == nullptr) {
+            meter_cal_init(&ctx->cal);
+            meter_cal_refresh(ctx);
+            return true;
+        }
+
+        // Recipe라면 [METER_CAL] FILE= 경로 사용
+        process_ini recipe;
+        if (!recipe.load(path)) {
+            return false;
+        }
+        std::string file = recipe.get("METER_CAL", "FILE");
+        if (file.empty()) file = path;
+        else if (!is_absolute(file)) file = directory_of(path) + file;
+
+        meter_cal_state next;
+        meter_cal_init(&next);
+        next.path = file;
+        if (!load_file(&next)) {
+            return false;
+        }
+        next.checked = std::chrono::steady_clock::now();
+
+        ctx->cal = next;
+        meter_cal_refresh(ctx);
+        return true;
+    }
+
+    __declspec(dllexport) bool process_meter_cal_reload_ctx(process_context* ctx)
+    {
+        if (ctx == nullptr || !reload_if_changed(ctx)) {
+            return false;
+        }
+        meter_cal_refresh(ctx);
+        return true;
+    }
+
+    __declspec(dllexport) bool process_meter_cal_get_ctx(process_context* ctx, int wad, float* matrix, float* offset)
+    {
+        if (ctx == nullptr || wad < 0 || wad >= 7) {
+            return false;
+        }
+
+        meter_cal_refresh(ctx);
+        const meter_cal& cal = ctx->cal.wad[wad];
+        for (int r = 0; r < 3; ++r) {
+            if (matrix != nullptr) {
+                for (int c = 0; c < 3; ++c) matrix[r * 3 + c] = cal.col[c][r];
+            }
+            if (offset != nullptr) offset[r] = cal.col[3][r];
+        }
+        return !cal.identity;
+    }
+
+    __declspec(dllexport) bool process_meter_cal_load(const char* path)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_meter_cal_load_ctx(process_default_context(), path);
+    }
+
+} // extern "C"
@@ -0,0 +1,80 @@
+#pragma once
+// ProcessMeterCal.h : 측정기별 XYZ 보정 (3×3 행렬 + offset)
+// 측정기 결과(x, y, L)를 받는 즉시 보정하여 measure[wad]에 기록 (u'v'도 보정값으로 계산)
+//   XYZ = (x / y × L, L, (1 - x - y) / y × L)
+//   XYZ' = M × XYZ + offset  →  x = X' / (X' + Y' + Z'),  y = Y' / (X' + Y' + Z'),  L = Y'
+//
+// 보정 파일 (INI) - 측정기 포트별 섹션, WAD 키가 우선
+//   [PORT_<포트>]
+//   MATRIX=m00,m01,m02,m10,m11,m12,m20,m21,m22     MATRIX_<WAD>=...  (WAD: 0, 30, 45, 60, 15, A, B)
+//   OFFSET=oX,oY,oZ                                 OFFSET_<WAD>=...
+// 없으면 단위 행렬 / offset 0 (보정 없음)
+// Recipe를 지정하면 [METER_CAL] FILE= 경로의 파일을 사용 (상대 경로는 Recipe 폴더 기준, 비어 있으면 Recipe 자체)
+// 측정 함수(Getdata, Getdata_multi, MTP_sweep) 호출 시 파일 변경을 확인하여 자동으로 다시 읽음 (최대 500ms 간격)
+
+#include "ProcessFunctions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // ===== 측정기 보정 (26.10.16) =====
+
+    /// <summary>
+    /// 보정 파일(또는 [METER_CAL] FILE=이 있는 Recipe) 설정 - nullptr: 보정 해제
+    /// 파일 읽기 실패 시 false (기존 설정 유지)
+    /// </summary>
+    __declspec(dllexport) bool process_meter_cal_load_ctx(process_context* ctx, const char* path);
+
+    /// <summary>
+    /// 보정 파일 변경 즉시 확인 - 다시 읽었으면 true
+    /// </summary>
+    __declspec(dllexport) bool process_meter_cal_reload_ctx(process_context* ctx);
+
+    /// <summary>
+    /// WAD 측정기에 현재 적용 중인 보정값 조회 (matrix[9] 행 우선, offset[3]) - 보정이 있으면 true
+    /// </summary>
+    __declspec(dllexport) bool process_meter_cal_get_ctx(process_context* ctx, int wad, float* matrix, float* offset);
+
+    // 기본 컨텍스트 래퍼
+    __declspec(dllexport) bool process_meter_cal_load(const char* path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef __cplusplus
+#include <chrono>
+#include <memory>
+#include <string>
+
+class process_ini;
+
+// WAD 1개의 보정값 (열 단위 4×4: col[0..2] = M의 열, col[3] = offset, 4번째 성분 0)
+struct meter_cal {
+    alignas(16) float col[4][4];
+    bool identity;                          // 보정 없음 (계산 생략)
+};
+
+// 컨텍스트별 보정 상태
+struct meter_cal_state {
+    std::string path;                       // 보정 파일 경로 (비어 있으면 보정 없음)
+    long long mtime;                        // 마지막으로 읽은 파일 수정 시각 / 크기
+    long long size;
+    std::chrono::steady_clock::time_point checked;  // 마지막 변경 확인 시각
+    std::shared_ptr<const process_ini> file;        // 읽은 보정 파일
+    meter_cal wad[7];                       // WAD별 적용 보정 (포트 + WAD로 결정)
+    int wad_port[7];                        // wad[w]를 결정한 포트 (-2: 미결정)
+};
+
+void meter_cal_init(meter_cal_state* state);
+
+// 파일 변경 확인(최대 500ms 간격) 후 포트가 바뀐 WAD의 보정값 갱신 - 측정 함수 시작 시 호출
+void meter_cal_refresh(process_context* ctx);
+
+// WAD 1개 보정값 갱신 (측정기 포트 변경 시)
+void meter_cal_resolve(process_context* ctx, int wad);
+
+// 보정 적용 - dst의 x, y, L을 보정값으로 교체 (u'v'는 호출 측에서 계산)
+void meter_cal_apply(const meter_cal& cal, struct pattern* dst);
+#endif
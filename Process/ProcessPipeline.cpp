@@ -0,0 +1,192 @@
+// ProcessPipeline.cpp : MTP 패턴 스윕 파이프라인 측정 구현
+
+#include "pch.h"
+#include "ProcessPipeline.h"
+#include "ProcessContext.h"
+#include "ProcessIni.h"
+#include "ProcessJudge.h"
+#include "ProcessThreadPool.h"
+#include <chrono>
+#include <future>
+#include <memory>
+
+namespace {
+
+    // [17]:패턴 => 0:W, 1:R, 2:G, 3:B, 4:WG, 5:WG2, 6:WG3 ~ 16:WG13
+    const char* const PATTERN_NAMES[17] = {
+        "W", "R", "G", "B", "WG", "WG2", "WG3", "WG4", "WG5",
+        "WG6", "WG7", "WG8", "WG9", "WG10", "WG11", "WG12", "WG13"
+    };
+
+    typedef std::chrono::steady_clock clock_type;
+
+    double elapsed_ms(clock_type::time_point t0, clock_type::time_point t1)
+    {
+        return std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+
+    // PG 패턴 전환 + 안정화 대기
+    bool pg_step(process_context* ctx, const mtp_sweep_config& cfg, int j, mtp_sweep_stats& st)
+    {
+        auto t0 = clock_type::now();
+        bool ok = PGPattern_ctx(ctx, cfg.pg_pattern[j]);
+        auto t1 = clock_type::now();
+        if (ok) sim_delay_ms(cfg.settle_ms[j]);
+        auto t2 = clock_type::now();
+
+        st.pg_ms += elapsed_ms(t0, t1);
+        st.settle_ms += elapsed_ms(t1, t2);
+        return ok;
+    }
+
+    bool integrate_step(process_context* ctx, mtp_sweep_stats& st)
+    {
+        auto t0 = clock_type::now();
+        bool ok = meas_integrate(ctx);
+        st.integrate_ms += elapsed_ms(t0, clock_type::now());
+        return ok;
+    }
+
+    // 전송 + 후처리 결과
+    struct readout_result {
+        bool ok;
+        double ms;
+    };
+
+    // 전송 + 후처리 (판정은 스윕 완료 후 일괄 - result는 0으로 기록)
+    readout_result readout_step(const process_context* ctx, struct pattern* dst)
+    {
+        auto t0 = clock_type::now();
+        readout_result r;
+        r.ok = meas_readout(ctx, dst);
+        if (r.ok) dst->result = 0;
+        r.ms = elapsed_ms(t0, clock_type::now());
+        return r;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_set_sim_timing(process_context* ctx, const struct sim_timing* timing)
+    {
+        if (ctx == nullptr) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(ctx->panel->lock);
+        ctx->panel->timing = (timing != nullptr) ? *timing : sim_timing();
+        return true;
+    }
+
+    __declspec(dllexport) bool mtp_sweep_default_config(const char* recipe_path, int wad,
+                                                        struct mtp_sweep_config* cfg)
+    {
+        if (cfg == nullptr || wad < 0 || wad >= 7) {
+            return false;
+        }
+
+        process_ini ini;
+        bool loaded = (recipe_path != nullptr) && ini.load(recipe_path);
+
+        cfg->wad = wad;
+        cfg->pattern_count = 17;
+        cfg->pipelined = ini_upper(ini.get("MTP_SETTLE", "PIPELINE", "T")) != "F" ? 1 : 0;
+
+        double default_ms = ini.get_double("MTP_SETTLE", "DEFAULT_MS", 0.0);
+        for (int j = 0; j < 17; ++j) {
+            cfg->pg_pattern[j] = j;
+            cfg->settle_ms[j] = (float)ini.get_double("MTP_SETTLE", PATTERN_NAMES[j], default_ms);
+        }
+        return loaded || recipe_path == nullptr;
+    }
+
+    __declspec(dllexport) int MTP_sweep_ctx(process_context* ctx, const struct mtp_sweep_config* cfg,
+                                            struct output* out, struct mtp_sweep_stats* stats)
+    {
+        if (ctx == nullptr || cfg == nullptr || out == nullptr ||
+            cfg->wad < 0 || cfg->wad >= 7 || cfg->pattern_count <= 0 || cfg->pattern_count > 17) {
+            return 0;
+        }
+
+        const int wad = cfg->wad;
+        const int n = cfg->pattern_count;
+        meter_cal_refresh(ctx);
+        mtp_sweep_stats st = mtp_sweep_stats();
+        unsigned int ok_mask = 0;           // 측정 성공 슬롯
+        auto start = clock_type::now();
+
+        if (!cfg->pipelined) {
+            for (int j = 0; j < n; ++j) {
+                readout_result r = { false, 0.0 };
+                if (pg_step(ctx, *cfg, j, st) && integrate_step(ctx, st)) {
+                    r = readout_step(ctx, &out->data[wad][j]);
+                    st.readout_ms += r.ms;
+                }
+                if (r.ok) ok_mask |= 1u << j;
+                else st.failed++;
+            }
+        }
+        else {
+            //26.10.16 - 전송/후처리는 공용 스레드 풀에서 실행 (패턴마다 스레드를 만들지 않음)
+            std::shared_ptr<process_thread_pool> pool = process_shared_pool();  // 스윕이 끝날 때까지 풀 유지
+            std::future<readout_result> pending;   // 전송/후처리 중인 이전 패턴
+            int pending_slot = -1;
+
+            // 이전 패턴의 전송/후처리 완료 대기 및 결과 반영
+            auto finish_pending = [&]() {
+                if (!pending.valid()) return;
+                readout_result r = pending.get();
+                st.readout_ms += r.ms;
+                if (r.ok) ok_mask |= 1u << pending_slot;
+                else st.failed++;
+            };
+
+            bool pg_ok = pg_step(ctx, *cfg, 0, st);
+
+            for (int j = 0; j < n; ++j) {
+                // 측정기는 1대 - 이전 패턴 전송이 끝나야 다음 적분 가능
+                finish_pending();
+
+                if (pg_ok && integrate_step(ctx, st)) {
+                    // 적분이 끝났으므로 패턴 변경 가능 - 전송/후처리를 병행 실행
+                    struct pattern* dst = &out->data[wad][j];
+                    const process_context* cctx = ctx;
+                    auto task = std::make_shared<std::packaged_task<readout_result()>>([cctx, dst] {
+                        return readout_step(cctx, dst);
+                    });
+                    pending = task->get_future();
+                    pool->submit([task] { (*task)(); });
+                    pending_slot = j;
+                }
+                else {
+                    st.failed++;
+                }
+
+                if (j + 1 < n) {
+                    pg_ok = pg_step(ctx, *cfg, j + 1, st);
+                }
+            }
+            finish_pending();
+        }
+
+        //26.10.16 - 스펙이 설정되어 있으면 측정한 슬롯 일괄 판정 (측정 실패 슬롯은 PTN)
+        if (ctx->judge) {
+            judge_mtp_slots(ctx->judge.get(), out, wad, 0, n, nullptr);
+            for (int j = 0; j < n; ++j) {
+                if (!(ok_mask & (1u << j))) out->data[wad][j].result = 2;
+            }
+            ctx->dirty.data[wad] |= (1u << n) - 1u;
+        }
+        else {
+            ctx->dirty.data[wad] |= ok_mask;
+        }
+
+        st.total_ms = elapsed_ms(start, clock_type::now());
+        st.hidden_ms = st.pg_ms + st.settle_ms + st.integrate_ms + st.readout_ms - st.total_ms;
+        if (st.hidden_ms < 0.0) st.hidden_ms = 0.0;
+
+        if (stats != nullptr) *stats = st;
+        return st.failed == 0 ? 1 : 0;
+    }
+
+} // extern "C"
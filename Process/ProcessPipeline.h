@@ -0,0 +1,61 @@
+#pragma once
+// ProcessPipeline.h : MTP 패턴 스윕 파이프라인 측정
+// 순차: [PG(j) → 안정화(j) → 적분(j) → 전송/후처리(j)] × N
+// 파이프라인: 적분(j) 완료 후 전송/후처리(j)를 공용 스레드 풀(process_shared_pool)에서 진행하면서
+//             동시에 PG(j+1) 명령 + 안정화(j+1)를 진행 → 패턴당 max(PG+안정화, 전송+후처리) + 적분
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 스윕 설정
+    struct mtp_sweep_config {
+        int wad;                    // 결과를 기록할 WAD 인덱스 (0~6)
+        int pattern_count;          // 측정 패턴 수 (1~17)
+        int pg_pattern[17];         // 슬롯별 PG 패턴 번호 (data[wad][j] ← pg_pattern[j])
+        float settle_ms[17];        // 슬롯별 안정화 시간 (ms, Recipe [MTP_SETTLE])
+        int pipelined;              // 1: 파이프라인, 0: 순차
+    };
+
+    // 스윕 실행 통계 (ms)
+    struct mtp_sweep_stats {
+        double total_ms;            // 전체 소요 시간
+        double pg_ms;               // PG 명령 합계
+        double settle_ms;           // 안정화 대기 합계
+        double integrate_ms;        // 적분 합계
+        double readout_ms;          // 전송 + 후처리 합계
+        double hidden_ms;           // 병행 실행으로 가려진 시간 (단계 합계 - total_ms)
+        int failed;                 // 실패한 패턴 수
+    };
+
+    // ===== 파이프라인 측정 (26.10.16) =====
+
+    /// <summary>
+    /// 장비 지연 시뮬레이션 설정 (nullptr: 지연 없음)
+    /// </summary>
+    __declspec(dllexport) bool process_set_sim_timing(process_context* ctx, const struct sim_timing* timing);
+
+    /// <summary>
+    /// Recipe(OptiX.ini) [MTP_SETTLE] 섹션에서 패턴별 안정화 시간을 읽어 기본 설정 생성
+    /// 키: W, R, G, B, WG, WG2 ~ WG13 (없으면 DEFAULT_MS), PIPELINE=T/F
+    /// recipe_path가 nullptr이거나 읽기 실패 시 안정화 0ms, 파이프라인 사용
+    /// </summary>
+    __declspec(dllexport) bool mtp_sweep_default_config(const char* recipe_path, int wad,
+                                                        struct mtp_sweep_config* cfg);
+
+    /// <summary>
+    /// 패턴 스윕 실행 - out->data[wad][0..pattern_count) 기록
+    /// 반환값: 1 모든 패턴 성공, 0 실패 패턴 있음 또는 인자 오류
+    /// </summary>
+    __declspec(dllexport) int MTP_sweep_ctx(process_context* ctx, const struct mtp_sweep_config* cfg,
+                                            struct output* out, struct mtp_sweep_stats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
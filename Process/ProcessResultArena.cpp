@@ -0,0 +1,398 @@
+// ProcessResultArena.cpp : 공유 메모리 결과 영역 구현
+// Windows: 이름 있는 파일 매핑 / Linux: POSIX shm_open + mmap
+
+#include "pch.h"
+#include "ProcessResultArena.h"
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(arena_header) == 64, "arena_header는 64바이트여야 함");
+static_assert(sizeof(arena_slot_header) == 64, "arena_slot_header는 64바이트여야 함");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "seq 원자 접근 크기 불일치");
+
+namespace {
+    const uint32_t ARENA_MAGIC = 0x4152584F;   // 'OXRA'
+    const uint32_t ARENA_VERSION = 1;
+    const size_t ARENA_ALIGN = 64;
+    const int READ_RETRY_LIMIT = 1000;         // process_arena_read 재시도 한도
+
+    size_t align_up(size_t value)
+    {
+        return (value + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    }
+
+    std::string platform_name(const char* name)
+    {
+#ifdef _WIN32
+        return std::string("Local\\") + name;
+#else
+        return std::string("/") + name;
+#endif
+    }
+}
+
+// 결과 영역 핸들 (DLL 내부 전용)
+struct process_arena {
+    std::string name;       // 플랫폼 이름 (Local\\name 또는 /name)
+    bool owner;             // 생성한 쪽 여부 (해제 시 이름 제거)
+    size_t size;            // 매핑 크기
+    uint8_t* base;          // 매핑 시작 주소
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+
+    arena_header* header() { return reinterpret_cast<arena_header*>(base); }
+
+    arena_slot_header* slot(int zone, int sequence)
+    {
+        arena_header* h = header();
+        if (zone < 0 || zone >= h->zones || sequence < 0 || sequence >= h->sequences) {
+            return nullptr;
+        }
+        size_t index = (size_t)zone * h->sequences + sequence;
+        return reinterpret_cast<arena_slot_header*>(base + h->data_offset + index * h->slot_size);
+    }
+};
+
+namespace {
+
+    std::atomic<uint32_t>* slot_seq(arena_slot_header* slot)
+    {
+        return reinterpret_cast<std::atomic<uint32_t>*>(&slot->seq);
+    }
+
+    struct output* slot_output(arena_slot_header* slot)
+    {
+        return reinterpret_cast<struct output*>(reinterpret_cast<uint8_t*>(slot) + sizeof(arena_slot_header));
+    }
+
+    // 플랫폼별 매핑 생성/열기 (size == 0 이면 기존 영역 열기)
+    bool map_region(process_arena* arena, size_t size)
+    {
+#ifdef _WIN32
+        if (size > 0) {
+            arena->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                                (DWORD)((unsigned long long)size >> 32), (DWORD)(size & 0xFFFFFFFF),
+                                                arena->name.c_str());
+        }
+        else {
+            arena->mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, arena->name.c_str());
+        }
+        if (arena->mapping == NULL) {
+            return false;
+        }
+        if (size > 0 && GetLastError() == ERROR_ALREADY_EXISTS) {
+            // 다른 프로세스가 사용 중인 같은 이름의 영역 - 덮어쓰지 않고 실패
+            CloseHandle(arena->mapping);
+            arena->mapping = NULL;
+            return false;
+        }
+
+        arena->base = (uint8_t*)MapViewOfFile(arena->mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        if (arena->base == nullptr) {
+            CloseHandle(arena->mapping);
+            arena->mapping = NULL;
+            return false;
+        }
+
+        if (size == 0) {
+            MEMORY_BASIC_INFORMATION info;
+            VirtualQuery(arena->base, &info, sizeof(info));
+            size = info.RegionSize;
+        }
+        arena->size = size;
+        return true;
+#else
+        int fd = -1;
+        if (size > 0) {
+            // 26.10.16 - 같은 이름이 있으면 실패 (사용 중인 영역을 unlink하면 읽는 쪽이 모르게 분리됨)
+            //            이전 실행의 잔존 영역은 process_arena_remove로 명시적으로 제거
+            fd = shm_open(arena->name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd >= 0 && ftruncate(fd, (off_t)size) != 0) {
+                close(fd);
+                shm_unlink(arena->name.c_str());
+                return false;
+            }
+        }
+        else {
+            fd = shm_open(arena->name.c_str(), O_RDWR, 0600);
+            struct stat st;
+            if (fd >= 0 && fstat(fd, &st) == 0) {
+                size = (size_t)st.st_size;
+            }
+        }
+        if (fd < 0 || size == 0) {
+            if (fd >= 0) close(fd);
+            return false;
+        }
+
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED) {
+            if (arena->owner) shm_unlink(arena->name.c_str());
+            return false;
+        }
+
+        arena->base = (uint8_t*)p;
+        arena->size = size;
+        return true;
+#endif
+    }
+
+    void unmap_region(process_arena* arena)
+    {
+#ifdef _WIN32
+        if (arena->base != nullptr) UnmapViewOfFile(arena->base);
+        if (arena->mapping != NULL) CloseHandle(arena->mapping);
+#else
+        if (arena->base != nullptr) munmap(arena->base, arena->size);
+        if (arena->owner) shm_unlink(arena->name.c_str());
+#endif
+        arena->base = nullptr;
+    }
+
+    process_arena* new_arena(const char* name, bool owner)
+    {
+        process_arena* arena = new (std::nothrow) process_arena();
+        if (arena == nullptr) return nullptr;
+
+        arena->name = platform_name(name);
+        arena->owner = owner;
+        arena->size = 0;
+        arena->base = nullptr;
+#ifdef _WIN32
+        arena->mapping = NULL;
+#endif
+        return arena;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) process_arena* process_arena_create(const char* name, int zones, int sequences)
+    {
+        if (name == nullptr || name[0] == '\0' || zones <= 0 || sequences <= 0) {
+            return nullptr;
+        }
+
+        process_arena* arena = new_arena(name, true);
+        if (arena == nullptr) return nullptr;
+
+        const size_t slot_size = align_up(sizeof(arena_slot_header) + sizeof(struct output));
+        const size_t data_offset = align_up(sizeof(arena_header));
+        const size_t size = data_offset + slot_size * (size_t)zones * (size_t)sequences;
+
+        if (!map_region(arena, size)) {
+            delete arena;
+            return nullptr;
+        }
+
+        std::memset(arena->base, 0, size);
+
+        arena_header* h = arena->header();
+        h->zones = zones;
+        h->sequences = sequences;
+        h->slot_size = (uint32_t)slot_size;
+        h->data_offset = (uint32_t)data_offset;
+        h->output_size = (uint32_t)sizeof(struct output);
+        h->version = ARENA_VERSION;
+
+        for (int z = 0; z < zones; ++z) {
+            for (int s = 0; s < sequences; ++s) {
+                arena_slot_header* slot = arena->slot(z, s);
+                slot->zone = (uint32_t)z;
+                slot->sequence = (uint32_t)s;
+            }
+        }
+
+        // magic은 마지막에 기록 (열기 측이 초기화 완료 여부 판단)
+        std::atomic_thread_fence(std::memory_order_release);
+        h->magic = ARENA_MAGIC;
+
+        return arena;
+    }
+
+    __declspec(dllexport) process_arena* process_arena_open(const char* name)
+    {
+        if (name == nullptr || name[0] == '\0') {
+            return nullptr;
+        }
+
+        process_arena* arena = new_arena(name, false);
+        if (arena == nullptr) return nullptr;
+
+        if (!map_region(arena, 0)) {
+            delete arena;
+            return nullptr;
+        }
+
+        arena_header* h = arena->header();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (arena->size < sizeof(arena_header) || h->magic != ARENA_MAGIC || h->version != ARENA_VERSION ||
+            h->output_size != sizeof(struct output) ||
+            h->data_offset + (size_t)h->slot_size * h->zones * h->sequences > arena->size) {
+            unmap_region(arena);
+            delete arena;
+            return nullptr;
+        }
+
+        return arena;
+    }
+
+    __declspec(dllexport) void process_arena_destroy(process_arena* arena)
+    {
+        if (arena == nullptr) return;
+
+        unmap_region(arena);
+        delete arena;
+    }
+
+    __declspec(dllexport) bool process_arena_remove(const char* name)
+    {
+        if (name == nullptr || name[0] == '\0') {
+            return false;
+        }
+#ifdef _WIN32
+        return true;  // 이름 있는 매핑은 마지막 핸들이 닫힐 때 사라짐
+#else
+        return shm_unlink(platform_name(name).c_str()) == 0 || errno == ENOENT;
+#endif
+    }
+
+    __declspec(dllexport) void* process_arena_base(process_arena* arena)
+    {
+        return arena != nullptr ? arena->base : nullptr;
+    }
+
+    __declspec(dllexport) struct output* process_arena_begin_write(process_arena* arena, int zone, int sequence)
+    {
+        if (arena == nullptr) return nullptr;
+
+        arena_slot_header* slot = arena->slot(zone, sequence);
+        if (slot == nullptr) return nullptr;
+
+        // 홀수 = 기록 중 (슬롯당 기록자는 1개라고 가정 - Zone별 실행 구조)
+        slot_seq(slot)->fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        return slot_output(slot);
+    }
+
+    __declspec(dllexport) uint32_t process_arena_end_write(process_arena* arena, int zone, int sequence, int status)
+    {
+        if (arena == nullptr) return 0;
+
+        arena_slot_header* slot = arena->slot(zone, sequence);
+        if (slot == nullptr) return 0;
+
+        std::atomic<uint32_t>* seq = slot_seq(slot);
+        uint32_t current = seq->load(std::memory_order_relaxed);
+        if ((current & 1u) == 0) {
+            return 0;  // begin_write 없이 호출됨
+        }
+
+        slot->status = status;
+        seq->store(current + 1, std::memory_order_release);
+        return current + 1;
+    }
+
+    __declspec(dllexport) int MTP_test_arena(process_context* ctx, process_arena* arena,
+                                             int zone, int sequence, const struct input* in)
+    {
+        struct output* out = process_arena_begin_write(arena, zone, sequence);
+        if (out == nullptr) return 0;
+
+        int result = MTP_test_ctx(ctx, in, out);
+        process_arena_end_write(arena, zone, sequence, result);
+        return result;
+    }
+
+    __declspec(dllexport) int IPVS_test_arena(process_context* ctx, process_arena* arena,
+                                              int zone, int sequence, const struct input* in)
+    {
+        struct output* out = process_arena_begin_write(arena, zone, sequence);
+        if (out == nullptr) return 0;
+
+        int result = IPVS_test_ctx(ctx, in, out);
+        process_arena_end_write(arena, zone, sequence, result);
+        return result;
+    }
+
+    __declspec(dllexport) bool Getdata_arena(process_context* ctx, process_arena* arena,
+                                             int zone, int sequence)
+    {
+        struct output* out = process_arena_begin_write(arena, zone, sequence);
+        if (out == nullptr) return false;
+
+        bool result = Getdata_ctx(ctx, out);
+        process_arena_end_write(arena, zone, sequence, result ? 1 : 0);
+        return result;
+    }
+
+    __declspec(dllexport) const struct output* process_arena_view(process_arena* arena, int zone, int sequence,
+                                                                   uint32_t* seq)
+    {
+        if (arena == nullptr) return nullptr;
+
+        arena_slot_header* slot = arena->slot(zone, sequence);
+        if (slot == nullptr) return nullptr;
+
+        uint32_t current = slot_seq(slot)->load(std::memory_order_acquire);
+        if (current & 1u) {
+            return nullptr;  // 기록 중
+        }
+
+        if (seq != nullptr) *seq = current;
+        return slot_output(slot);
+    }
+
+    __declspec(dllexport) bool process_arena_validate(process_arena* arena, int zone, int sequence, uint32_t seq)
+    {
+        if (arena == nullptr) return false;
+
+        arena_slot_header* slot = arena->slot(zone, sequence);
+        if (slot == nullptr) return false;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot_seq(slot)->load(std::memory_order_relaxed) == seq;
+    }
+
+    __declspec(dllexport) uint32_t process_arena_read(process_arena* arena, int zone, int sequence,
+                                                      struct output* dst)
+    {
+        if (arena == nullptr || dst == nullptr) return 0;
+
+        arena_slot_header* slot = arena->slot(zone, sequence);
+        if (slot == nullptr) return 0;
+
+        std::atomic<uint32_t>* seq = slot_seq(slot);
+        for (int retry = 0; retry < READ_RETRY_LIMIT; ++retry) {
+            uint32_t before = seq->load(std::memory_order_acquire);
+            if (before & 1u) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::memcpy(dst, slot_output(slot), sizeof(struct output));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq->load(std::memory_order_relaxed) == before) {
+                return before;
+            }
+        }
+        return 0;
+    }
+
+} // extern "C"
@@ -0,0 +1,122 @@
+#pragma once
+// ProcessResultArena.h : 공유 메모리 결과 영역 (Zone × SEQUENCE 슬롯)
+// 결과를 매핑된 메모리에 직접 기록하여 PtrToStructure 복사 없이 읽을 수 있도록 함
+//
+// 메모리 배치 (모든 오프셋은 64바이트 정렬):
+//   [arena_header 64B][slot 0][slot 1]...   slot 인덱스 = zone * sequences + sequence
+//   slot = [arena_slot_header 64B][struct output][정렬 패딩]
+//
+// 발행 규약 (seqlock):
+//   쓰기: seq를 홀수로 증가 → output 기록 → seq를 짝수로 증가
+//   읽기: seq(짝수) 확인 → output 읽기 → seq 재확인, 값이 같으면 일관된 결과
+//   C#에서는 MemoryMappedFile.OpenExisting(name)으로 같은 영역을 열고
+//   Volatile.Read로 seq를 읽어 동일한 규약으로 직접 참조 가능
+
+#include "ProcessFunctions.h"
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 공유 메모리 헤더 (C# 매핑용으로 고정 배치)
+    struct arena_header {
+        uint32_t magic;         // 'OXRA' (0x4152584F)
+        uint32_t version;       // 배치 버전 (1)
+        int32_t zones;          // Zone 수
+        int32_t sequences;      // Zone당 SEQUENCE 수
+        uint32_t slot_size;     // 슬롯 크기 (바이트, 64 배수)
+        uint32_t data_offset;   // 첫 슬롯 오프셋 (바이트)
+        uint32_t output_size;   // sizeof(struct output)
+        uint8_t reserved[36];
+    };
+
+    // 슬롯 헤더 - 결과 발행 정보
+    struct arena_slot_header {
+        uint32_t seq;           // seqlock 카운터 (홀수: 기록 중, 짝수: 발행 완료)
+        uint32_t zone;          // Zone 인덱스
+        uint32_t sequence;      // SEQUENCE 인덱스
+        int32_t status;         // 마지막 기록 함수의 결과 코드
+        uint8_t reserved[48];
+    };
+
+    typedef struct process_arena process_arena;
+
+    // ===== 결과 영역 생성/해제 (26.10.16) =====
+
+    /// <summary>
+    /// 이름 있는 결과 영역 생성 (실패 시 nullptr)
+    /// 같은 이름의 영역이 이미 있으면 실패 - 다른 프로세스가 사용 중인 영역을 대체하지 않음
+    /// Windows: CreateFileMapping("Local\\name"), Linux: shm_open("/name")
+    /// </summary>
+    __declspec(dllexport) process_arena* process_arena_create(const char* name, int zones, int sequences);
+
+    /// <summary>
+    /// 다른 프로세스/모듈이 만든 결과 영역 열기 (읽기 전용 용도)
+    /// </summary>
+    __declspec(dllexport) process_arena* process_arena_open(const char* name);
+
+    /// <summary>
+    /// 결과 영역 해제 (생성한 쪽이면 이름도 제거됨)
+    /// </summary>
+    __declspec(dllexport) void process_arena_destroy(process_arena* arena);
+
+    /// <summary>
+    /// 이름 제거 (Linux: 비정상 종료로 남은 /dev/shm 영역 정리, 이미 없으면 true)
+    /// 열려 있는 매핑은 유지되며 이후 같은 이름으로 새로 생성 가능 - Windows는 no-op
+    /// </summary>
+    __declspec(dllexport) bool process_arena_remove(const char* name);
+
+    /// <summary>
+    /// 매핑 시작 주소 (arena_header 위치) - C# 측 직접 참조용
+    /// </summary>
+    __declspec(dllexport) void* process_arena_base(process_arena* arena);
+
+    // ===== 슬롯 기록 (쓰는 쪽) =====
+
+    /// <summary>
+    /// 슬롯 기록 시작 - 슬롯의 output 포인터 반환 (범위 밖이면 nullptr)
+    /// 반드시 process_arena_end_write와 짝으로 호출
+    /// </summary>
+    __declspec(dllexport) struct output* process_arena_begin_write(process_arena* arena, int zone, int sequence);
+
+    /// <summary>
+    /// 슬롯 기록 완료 및 발행 - 발행된 seq 번호 반환 (실패 시 0)
+    /// </summary>
+    __declspec(dllexport) uint32_t process_arena_end_write(process_arena* arena, int zone, int sequence, int status);
+
+    // 슬롯에 직접 기록하는 테스트 함수 (반환값은 단일 함수와 동일)
+    __declspec(dllexport) int MTP_test_arena(process_context* ctx, process_arena* arena,
+                                             int zone, int sequence, const struct input* in);
+    __declspec(dllexport) int IPVS_test_arena(process_context* ctx, process_arena* arena,
+                                              int zone, int sequence, const struct input* in);
+    __declspec(dllexport) bool Getdata_arena(process_context* ctx, process_arena* arena,
+                                             int zone, int sequence);
+
+    // ===== 슬롯 읽기 (읽는 쪽) =====
+
+    /// <summary>
+    /// 슬롯 직접 참조 - output 포인터와 현재 seq 반환 (기록 중이면 nullptr)
+    /// 사용 후 process_arena_validate로 읽는 동안 변경이 없었는지 확인
+    /// </summary>
+    __declspec(dllexport) const struct output* process_arena_view(process_arena* arena, int zone, int sequence,
+                                                                   uint32_t* seq);
+
+    /// <summary>
+    /// 직접 참조 중 슬롯 변경 여부 확인 (변경 없으면 true)
+    /// </summary>
+    __declspec(dllexport) bool process_arena_validate(process_arena* arena, int zone, int sequence, uint32_t seq);
+
+    /// <summary>
+    /// 일관된 스냅샷 복사 (기록과 겹치면 재시도) - 복사된 seq 반환 (발행 전 슬롯이거나 실패 시 0)
+    /// </summary>
+    __declspec(dllexport) uint32_t process_arena_read(process_arena* arena, int zone, int sequence,
+                                                      struct output* dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
@@ -0,0 +1,192 @@
+// ProcessSequence.cpp : Sequence_*.ini 네이티브 실행기 구현
+
+#include "pch.h"
+#include "ProcessSequence.h"
+#include "ProcessIni.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // 변환된 단계 (함수 + 정수 인자)
+    struct seq_step {
+        seq_op op;
+        int args[3];
+    };
+
+    int parse_int(const std::string& s, int def)
+    {
+        char* end = nullptr;
+        long v = std::strtol(s.c_str(), &end, 10);
+        return (!s.empty() && *end == '\0') ? (int)v : def;
+    }
+
+    // "PGTurn,1" 형식 한 줄을 단계로 변환
+    seq_step compile_step(const std::string& line)
+    {
+        std::vector<std::string> parts = ini_split(line, ',');
+        std::string name = ini_upper(parts[0]);
+
+        seq_step step = { SEQ_OP_UNKNOWN, { 0, 0, 0 } };
+        for (size_t i = 1; i < parts.size() && i <= 3; ++i) {
+            step.args[i - 1] = parse_int(parts[i], 0);
+        }
+
+        if (name == "PGTURN") step.op = SEQ_OP_PGTURN;
+        else if (name == "MEASTURN") step.op = SEQ_OP_MEASTURN;
+        else if (name == "PGPATTERN") step.op = SEQ_OP_PGPATTERN;
+        else if (name == "PGVOLTAGESND") step.op = SEQ_OP_PGVOLTAGE;
+        else if (name == "MEAS") step.op = SEQ_OP_MEAS;
+        else if (name == "MTP") step.op = SEQ_OP_MTP;          // 셀 정보는 input 사용 (C#과 동일)
+        else if (name == "IPVS") step.op = SEQ_OP_IPVS;
+        else if (name == "DELAY") step.op = SEQ_OP_DELAY;
+        else if (name == "MAKE_RESULT_LOG") step.op = SEQ_OP_NOP;
+
+        return step;
+    }
+
+    std::vector<seq_step> compile_section(const process_ini& ini, const std::string& section, int count)
+    {
+        std::vector<seq_step> steps;
+        steps.reserve(count > 0 ? count : 0);
+
+        char key[16];
+        for (int i = 0; i < count; ++i) {
+            std::snprintf(key, sizeof(key), "SEQ%02d", i);
+            std::string value = ini.get(section, key);
+            if (!value.empty()) {
+                steps.push_back(compile_step(value));  // 빈 항목은 건너뜀 (C#과 동일)
+            }
+        }
+        return steps;
+    }
+
+    int run_step(process_context* ctx, const seq_step& step, const struct input* in, struct output* out)
+    {
+        switch (step.op) {
+        case SEQ_OP_PGTURN:    return PGTurn_ctx(ctx, step.args[0]) ? 1 : 0;
+        case SEQ_OP_MEASTURN:  return Meas_Turn_ctx(ctx, step.args[0]) ? 1 : 0;
+        case SEQ_OP_PGPATTERN: return PGPattern_ctx(ctx, step.args[0]) ? 1 : 0;
+        case SEQ_OP_PGVOLTAGE: return PGVoltagesnd_ctx(ctx, step.args[0], step.args[1], step.args[2]) ? 1 : 0;
+        case SEQ_OP_MEAS:      return Getdata_ctx(ctx, out) ? 1 : 0;
+        case SEQ_OP_MTP:       return MTP_test_ctx(ctx, in, out);
+        case SEQ_OP_IPVS:      return IPVS_test_ctx(ctx, in, out);
+        case SEQ_OP_DELAY:
+            if (step.args[0] > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(step.args[0]));
+            }
+            return 1;
+        case SEQ_OP_NOP:       return 1;
+        default:               return 0;
+        }
+    }
+}
+
+// 시퀀스 프로그램 (DLL 내부 전용)
+struct process_sequence {
+    std::vector<std::vector<seq_step>> groups;
+};
+
+namespace {
+
+    process_sequence* compile_ini(const process_ini& ini)
+    {
+        process_sequence* seq = new (std::nothrow) process_sequence();
+        if (seq == nullptr) return nullptr;
+
+        int sequence_count = ini.get_int("SETTING", "SEQUENCE_COUNT", 0);
+        if (sequence_count > 0) {
+            // 신규 구조: [SEQUENCE1..N]
+            for (int g = 1; g <= sequence_count; ++g) {
+                std::string section = "SEQUENCE" + std::to_string(g);
+                seq->groups.push_back(compile_section(ini, section, ini.get_int(section, "SEQ_COUNT", 0)));
+            }
+        }
+        else {
+            // 기존 구조: [SEQ]
+            int count = ini.get_int("SETTING", "SEQ_COUNT", 0);
+            if (count <= 0) {
+                delete seq;
+                return nullptr;
+            }
+            seq->groups.push_back(compile_section(ini, "SEQ", count));
+        }
+        return seq;
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) process_sequence* process_sequence_load(const char* path)
+    {
+        process_ini ini;
+        if (!ini.load(path)) {
+            return nullptr;
+        }
+        return compile_ini(ini);
+    }
+
+    __declspec(dllexport) process_sequence* process_sequence_load_text(const char* text)
+    {
+        if (text == nullptr) {
+            return nullptr;
+        }
+
+        process_ini ini;
+        ini.load_text(text);
+        return compile_ini(ini);
+    }
+
+    __declspec(dllexport) void process_sequence_destroy(process_sequence* seq)
+    {
+        delete seq;
+    }
+
+    __declspec(dllexport) int process_sequence_count(process_sequence* seq)
+    {
+        return seq != nullptr ? (int)seq->groups.size() : 0;
+    }
+
+    __declspec(dllexport) int process_sequence_step_count(process_sequence* seq, int group)
+    {
+        if (seq == nullptr || group < 0 || group >= (int)seq->groups.size()) {
+            return -1;
+        }
+        return (int)seq->groups[group].size();
+    }
+
+    __declspec(dllexport) int process_sequence_run(process_context* ctx, process_sequence* seq, int group,
+                                                   const struct input* in, struct output* out,
+                                                   struct seq_step_result* results, int capacity)
+    {
+        if (ctx == nullptr || seq == nullptr || in == nullptr || out == nullptr ||
+            group < 0 || group >= (int)seq->groups.size()) {
+            return 0;
+        }
+
+        const std::vector<seq_step>& steps = seq->groups[group];
+        bool all_ok = true;
+
+        for (size_t i = 0; i < steps.size(); ++i) {
+            auto t0 = std::chrono::steady_clock::now();
+            int status = run_step(ctx, steps[i], in, out);
+            auto t1 = std::chrono::steady_clock::now();
+
+            if (status != 1) {
+                all_ok = false;  // 실패 정책: 일단 계속 진행
+            }
+
+            if (results != nullptr && (int)i < capacity) {
+                results[i].op = steps[i].op;
+                results[i].status = status;
+                results[i].elapsed_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+            }
+        }
+        return all_ok ? 1 : 0;
+    }
+
+} // extern "C"
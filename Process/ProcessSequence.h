@@ -0,0 +1,80 @@
+#pragma once
+// ProcessSequence.h : Sequence_*.ini 네이티브 실행기
+// 시퀀스 섹션을 한 번 읽어 단계 프로그램으로 변환한 뒤,
+// 단계마다 C#↔DLL을 오가지 않고 전체 시퀀스를 한 번의 호출로 실행함
+//
+// 지원 구조 (C# SequenceCacheManager와 동일):
+//   신규: [SETTING] SEQUENCE_COUNT=N + [SEQUENCE1..N] SEQ_COUNT, SEQ00..
+//   기존: [SETTING] SEQ_COUNT=N + [SEQ] SEQ00..
+// 지원 단계: PGTurn,port / MEASTurn,port / PGPattern,ptn / PGVoltagesnd,R,G,B /
+//            MEAS / MTP / IPVS / DELAY,ms / MAKE_RESULT_LOG(무시)
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 단계 종류
+    enum seq_op {
+        SEQ_OP_UNKNOWN = 0,     // 알 수 없는 함수 (실행 시 실패 처리)
+        SEQ_OP_PGTURN = 1,
+        SEQ_OP_MEASTURN = 2,
+        SEQ_OP_PGPATTERN = 3,
+        SEQ_OP_PGVOLTAGE = 4,
+        SEQ_OP_MEAS = 5,
+        SEQ_OP_MTP = 6,
+        SEQ_OP_IPVS = 7,
+        SEQ_OP_DELAY = 8,
+        SEQ_OP_NOP = 9          // MAKE_RESULT_LOG 등 UI 측 처리 단계
+    };
+
+    // 단계별 실행 결과
+    struct seq_step_result {
+        int op;                 // seq_op
+        int status;             // 함수 반환값 (bool: 0/1, MTP/IPVS: 결과 코드)
+        double elapsed_ms;      // 단계 실행 시간 (ms)
+    };
+
+    typedef struct process_sequence process_sequence;
+
+    // ===== 시퀀스 실행기 (26.10.16) =====
+
+    /// <summary>
+    /// Sequence_*.ini 파일을 읽어 단계 프로그램 생성 (실패 시 nullptr)
+    /// </summary>
+    __declspec(dllexport) process_sequence* process_sequence_load(const char* path);
+
+    /// <summary>
+    /// INI 형식 문자열에서 단계 프로그램 생성 (실패 시 nullptr)
+    /// </summary>
+    __declspec(dllexport) process_sequence* process_sequence_load_text(const char* text);
+
+    __declspec(dllexport) void process_sequence_destroy(process_sequence* seq);
+
+    /// <summary>
+    /// SEQUENCE 그룹 수 (기존 구조는 1)
+    /// </summary>
+    __declspec(dllexport) int process_sequence_count(process_sequence* seq);
+
+    /// <summary>
+    /// 그룹의 단계 수 (잘못된 그룹: -1)
+    /// </summary>
+    __declspec(dllexport) int process_sequence_step_count(process_sequence* seq, int group);
+
+    /// <summary>
+    /// 그룹 전체 실행 - out에 결과 누적, results[0..capacity)에 단계별 결과 기록 (nullptr 허용)
+    /// 단계 실패 시에도 나머지 단계는 계속 진행 (C# 실행기와 같은 정책)
+    /// 반환값: 1 모든 단계 성공, 0 실패 단계 있음 또는 인자 오류
+    /// </summary>
+    __declspec(dllexport) int process_sequence_run(process_context* ctx, process_sequence* seq, int group,
+                                                   const struct input* in, struct output* out,
+                                                   struct seq_step_result* results, int capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
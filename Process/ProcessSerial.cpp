@@ -0,0 +1,368 @@
+// ProcessSerial.cpp : 장비 계층 - 시리얼 포트 백엔드
+// Linux: termios + O_NONBLOCK + poll (pty 쌍으로 시험 가능)
+// Windows: COM 포트 + COMMTIMEOUTS (읽기 즉시 반환 설정 후 마감 시각까지 반복)
+
+#include "pch.h"
+#include "ProcessDevice.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+    typedef std::chrono::steady_clock clock_type;
+
+    // 줄 단위 비차단 시리얼 연결
+    class serial_line {
+    public:
+        serial_line()
+#ifdef _WIN32
+            : m_handle(INVALID_HANDLE_VALUE)
+#else
+            : m_fd(-1)
+#endif
+        {}
+
+        ~serial_line() { close(); }
+
+        bool is_open() const
+        {
+#ifdef _WIN32
+            return m_handle != INVALID_HANDLE_VALUE;
+#else
+            return m_fd >= 0;
+#endif
+        }
+
+        bool open(const char* path, int baud)
+        {
+            close();
+            m_buffer.clear();
+#ifdef _WIN32
+            m_handle = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
+            if (m_handle == INVALID_HANDLE_VALUE) return false;
+
+            DCB dcb;
+            std::memset(&dcb, 0, sizeof(dcb));
+            dcb.DCBlength = sizeof(dcb);
+            if (!GetCommState(m_handle, &dcb)) { close(); return false; }
+            dcb.BaudRate = (DWORD)baud;
+            dcb.ByteSize = 8;
+            dcb.Parity = NOPARITY;
+            dcb.StopBits = ONESTOPBIT;
+            dcb.fBinary = TRUE;
+            if (!SetCommState(m_handle, &dcb)) { close(); return false; }
+
+            // 읽기: 수신된 만큼 즉시 반환 (대기는 read_line의 마감 시각으로 처리)
+            COMMTIMEOUTS timeouts;
+            std::memset(&timeouts, 0, sizeof(timeouts));
+            timeouts.ReadIntervalTimeout = MAXDWORD;
+            timeouts.WriteTotalTimeoutConstant = 500;
+            SetCommTimeouts(m_handle, &timeouts);
+            PurgeComm(m_handle, PURGE_RXCLEAR | PURGE_TXCLEAR);
+            return true;
+#else
+            m_fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+            if (m_fd < 0) return false;
+
+            struct termios tio;
+            if (tcgetattr(m_fd, &tio) != 0) { close(); return false; }
+            cfmakeraw(&tio);
+            speed_t speed = to_speed(baud);
+            cfsetispeed(&tio, speed);
+            cfsetospeed(&tio, speed);
+            tio.c_cflag |= (CLOCAL | CREAD);
+            tio.c_cc[VMIN] = 0;
+            tio.c_cc[VTIME] = 0;
+            if (tcsetattr(m_fd, TCSANOW, &tio) != 0) { close(); return false; }
+            tcflush(m_fd, TCIOFLUSH);
+            return true;
+#endif
+        }
+
+        void close()
+        {
+#ifdef _WIN32
+            if (m_handle != INVALID_HANDLE_VALUE) CloseHandle(m_handle);
+            m_handle = INVALID_HANDLE_VALUE;
+#else
+            if (m_fd >= 0) ::close(m_fd);
+            m_fd = -1;
+#endif
+        }
+
+        // 한 줄 송신 ('\n' 추가)
+        bool write_line(const std::string& line, int timeout_ms)
+        {
+            if (!is_open()) return false;
+            std::string data = line + "\n";
+            const char* p = data.c_str();
+            size_t left = data.size();
+            auto deadline = clock_type::now() + std::chrono::milliseconds(timeout_ms);
+
+            while (left > 0) {
+#ifdef _WIN32
+                DWORD written = 0;
+                if (!WriteFile(m_handle, p, (DWORD)left, &written, NULL)) return false;
+#else
+                ssize_t written = ::write(m_fd, p, left);
+                if (written < 0) {
+                    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return false;
+                    written = 0;
+                    if (!wait_io(POLLOUT, deadline)) return false;
+                }
+#endif
+                p += written;
+                left -= (size_t)written;
+                if (left > 0 && clock_type::now() >= deadline) return false;
+            }
+            return true;
+        }
+
+        // 한 줄 수신 ('\r', '\n' 제거) - 시간 초과 시 false
+        bool read_line(std::string* line, int timeout_ms)
+        {
+            if (!is_open()) return false;
+            auto deadline = clock_type::now() + std::chrono::milliseconds(timeout_ms);
+
+            for (;;) {
+                size_t nl = m_buffer.find('\n');
+                if (nl != std::string::npos) {
+                    *line = m_buffer.substr(0, nl);
+                    m_buffer.erase(0, nl + 1);
+                    if (!line->empty() && line->back() == '\r') line->pop_back();
+                    return true;
+                }
+
+                char chunk[256];
+#ifdef _WIN32
+                DWORD got = 0;
+                if (!ReadFile(m_handle, chunk, sizeof(chunk), &got, NULL)) return false;
+                if (got == 0) {
+                    if (clock_type::now() >= deadline) return false;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+#else
+                ssize_t got = ::read(m_fd, chunk, sizeof(chunk));
+                if (got < 0) {
+                    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return false;
+                    if (!wait_io(POLLIN, deadline)) return false;
+                    continue;
+                }
+                if (got == 0) {
+                    if (!wait_io(POLLIN, deadline)) return false;
+                    continue;
+                }
+#endif
+                m_buffer.append(chunk, (size_t)got);
+            }
+        }
+
+    private:
+#ifdef _WIN32
+        HANDLE m_handle;
+#else
+        int m_fd;
+
+        bool wait_io(short events, clock_type::time_point deadline)
+        {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock_type::now()).count();
+            if (left <= 0) return false;
+
+            struct pollfd pfd;
+            pfd.fd = m_fd;
+            pfd.events = events;
+            pfd.revents = 0;
+            int r = ::poll(&pfd, 1, (int)left);
+            if (r > 0 && (pfd.revents & POLLHUP) && !(pfd.revents & POLLIN)) {
+                // pty 상대편이 아직 열리지 않은 경우 - 잠시 후 재시도
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                return clock_type::now() < deadline;
+            }
+            return r > 0 || (r < 0 && errno == EINTR);
+        }
+
+        static speed_t to_speed(int baud)
+        {
+            switch (baud) {
+            case 9600: return B9600;
+            case 19200: return B19200;
+            case 38400: return B38400;
+            case 57600: return B57600;
+            case 230400: return B230400;
+            default: return B115200;
+            }
+        }
+#endif
+
+        std::string m_buffer;
+    };
+
+    // 명령 송신 후 지정 응답 대기
+    bool transact(serial_line& line, const std::string& command, const char* expect, int timeout_ms)
+    {
+        if (!line.write_line(command, timeout_ms)) return false;
+
+        std::string reply;
+        if (!line.read_line(&reply, timeout_ms)) return false;
+        return reply == expect;
+    }
+
+    class serial_pg : public pg_device {
+    public:
+        explicit serial_pg(const serial_config& config) : m_config(config) {}
+
+        bool open(int port) override
+        {
+            std::string path;
+            return serial_format_path(m_config.pg_path, port, &path) && m_line.open(path.c_str(), m_config.baud);
+        }
+
+        bool close() override
+        {
+            if (!m_line.is_open()) return true;
+            bool ok = transact(m_line, "PWR OFF", "OK", m_config.timeout_ms);
+            m_line.close();
+            return ok;
+        }
+
+        bool set_pattern(int pattern) override
+        {
+            return transact(m_line, "PTN " + std::to_string(pattern), "OK", m_config.timeout_ms);
+        }
+
+        bool set_voltage(int RV, int GV, int BV) override
+        {
+            return transact(m_line, "VOL " + std::to_string(RV) + " " + std::to_string(GV) + " " +
+                                    std::to_string(BV), "OK", m_config.timeout_ms);
+        }
+
+    private:
+        serial_config m_config;
+        serial_line m_line;
+    };
+
+    class serial_meter : public meter_device {
+    public:
+        explicit serial_meter(const serial_config& config) : m_config(config), m_triggered(false), m_integrated(false) {}
+
+        bool open(int port) override
+        {
+            std::string path;
+            return serial_format_path(m_config.meas_path, port, &path) && m_line.open(path.c_str(), m_config.baud);
+        }
+
+        bool close() override
+        {
+            m_line.close();
+            m_triggered = m_integrated = false;
+            return true;
+        }
+
+        bool trigger() override
+        {
+            m_integrated = false;
+            m_triggered = m_line.write_line("MEAS", m_config.timeout_ms);
+            return m_triggered;
+        }
+
+        bool wait_integrated() override
+        {
+            if (m_integrated) return true;
+            if (!m_triggered) return false;
+
+            std::string reply;
+            m_integrated = m_line.read_line(&reply, m_config.timeout_ms) && reply == "ACK";
+            if (!m_integrated) m_triggered = false;
+            return m_integrated;
+        }
+
+        bool read_result(struct pattern* dst) override
+        {
+            if (!wait_integrated()) return false;
+            m_triggered = m_integrated = false;
+
+            std::string reply;
+            if (!m_line.read_line(&reply, m_config.timeout_ms) || reply.compare(0, 5, "DATA ") != 0) {
+                return false;
+            }
+
+            float v[5];
+            const char* p = reply.c_str() + 5;
+            for (int i = 0; i < 5; ++i) {
+                char* end = nullptr;
+                v[i] = std::strtof(p, &end);
+                if (end == p) return false;
+                p = (*end == ',') ? end + 1 : end;
+            }
+
+            dst->x = v[0];
+            dst->y = v[1];
+            dst->L = v[2];
+            dst->cur = v[3];
+            dst->eff = v[4];
+            return true;
+        }
+
+    private:
+        serial_config m_config;
+        serial_line m_line;
+        bool m_triggered;
+        bool m_integrated;
+    };
+}
+
+//26.10.16 - 경로 형식은 사용자 설정이므로 printf 형식 문자열로 넘기지 않고 직접 치환
+bool serial_format_path(const char* pattern, int port, std::string* path)
+{
+    if (pattern == nullptr || path == nullptr) return false;
+
+    std::string result;
+    int substituted = 0;
+    for (const char* p = pattern; *p != '\0'; ++p) {
+        if (*p != '%') {
+            result += *p;
+            continue;
+        }
+        if (p[1] == '%') {
+            result += '%';
+            ++p;
+        }
+        else if (p[1] == 'd' && substituted == 0) {
+            result += std::to_string(port);
+            substituted = 1;
+            ++p;
+        }
+        else {
+            return false;  // %d 이외의 변환 또는 %d 두 번 이상
+        }
+    }
+    if (result.empty()) return false;
+
+    *path = result;
+    return true;
+}
+
+std::unique_ptr<pg_device> create_serial_pg(const serial_config& serial)
+{
+    return std::unique_ptr<pg_device>(new serial_pg(serial));
+}
+
+std::unique_ptr<meter_device> create_serial_meter(const serial_config& serial)
+{
+    return std::unique_ptr<meter_device>(new serial_meter(serial));
+}
@@ -0,0 +1,149 @@
+// ProcessThreadPool.cpp : Process DLL 내부 작업 스레드 풀 구현
+
+#include "pch.h"
+#include "ProcessThreadPool.h"
+#include <exception>
+
+namespace {
+    std::mutex g_pool_mutex;
+    // 명시적 종료 전까지 유지 (정적 소멸자에서 join하지 않도록 힙에 두고 종료 시 reset)
+    std::shared_ptr<process_thread_pool>* g_pool = new std::shared_ptr<process_thread_pool>();
+}
+
+process_thread_pool::process_thread_pool(int threads)
+    : m_stop(false)
+{
+    if (threads < 1) threads = 1;
+
+    m_workers.reserve(threads);
+    for (int i = 0; i < threads; ++i) {
+        m_workers.emplace_back(&process_thread_pool::worker_loop, this);
+    }
+}
+
+process_thread_pool::~process_thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+
+    for (auto& t : m_workers) {
+        if (t.joinable()) t.join();
+    }
+}
+
+void process_thread_pool::worker_loop()
+{
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+            if (m_stop && m_tasks.empty()) return;
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+        task();
+    }
+}
+
+void process_thread_pool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push(std::move(task));
+    }
+    m_cv.notify_one();
+}
+
+void process_thread_pool::parallel_for(int n, int max_threads, const std::function<void(int, int, int)>& fn)
+{
+    if (n <= 0) return;
+
+    int chunks = max_threads;
+    if (chunks > size() + 1) chunks = size() + 1;  // 호출 스레드 포함
+    if (chunks > n) chunks = n;
+    if (chunks <= 1) {
+        fn(0, n, 0);
+        return;
+    }
+
+    // 26.10.16 - 조각에서 예외가 나도 모든 조각이 끝날 때까지 기다린 뒤 호출 스레드에서 다시 던짐
+    //            (작업 스레드가 아직 이 스택의 done_mutex / done_cv / fn을 쓰는 중에 되감기지 않도록)
+    int remaining = chunks - 1;  // done_mutex로 보호
+    std::exception_ptr error;    // 첫 번째 예외 (done_mutex로 보호)
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+
+    const int per = n / chunks;
+    const int extra = n % chunks;
+
+    int begin = per + (extra > 0 ? 1 : 0);  // 첫 조각은 호출 스레드가 처리
+    const int first_end = begin;
+
+    for (int slot = 1; slot < chunks; ++slot) {
+        int end = begin + per + (slot < extra ? 1 : 0);
+        try {
+            submit([&, begin, end, slot] {
+                try {
+                    fn(begin, end, slot);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(done_mutex);
+                    if (!error) error = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(done_mutex);
+                if (--remaining == 0) {
+                    done_cv.notify_one();
+                }
+            });
+        }
+        catch (...) {
+            // 작업 등록 실패 (메모리 부족) - 등록하지 못한 조각은 건너뛰고 이미 등록한 조각만 대기
+            std::lock_guard<std::mutex> lock(done_mutex);
+            if (!error) error = std::current_exception();
+            remaining -= chunks - slot;
+            break;
+        }
+        begin = end;
+    }
+
+    try {
+        fn(0, first_end, 0);
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(done_mutex);
+        if (!error) error = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cv.wait(lock, [&] { return remaining == 0; });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+std::shared_ptr<process_thread_pool> process_shared_pool()
+{
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+    if (!*g_pool) {
+        int threads = (int)std::thread::hardware_concurrency();
+        *g_pool = std::make_shared<process_thread_pool>(threads > 1 ? threads - 1 : 1);
+    }
+    return *g_pool;
+}
+
+void process_shutdown_thread_pool()
+{
+    std::shared_ptr<process_thread_pool> pool;
+    {
+        std::lock_guard<std::mutex> lock(g_pool_mutex);
+        pool.swap(*g_pool);
+    }
+    // 26.10.16 - 다른 스레드가 아직 풀을 사용 중이면 참조가 남아 있으므로 여기서 해제되지 않음
+    //            (마지막 사용자의 shared_ptr 반환 시 작업 스레드 join)
+    pool.reset();
+}
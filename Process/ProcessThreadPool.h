@@ -0,0 +1,53 @@
+#pragma once
+// ProcessThreadPool.h : Process DLL 내부 작업 스레드 풀
+// 배치 처리 등 여러 셀/채널을 병렬로 처리할 때 사용
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// 26.10.16 - 고정 크기 작업 스레드 풀
+// 주의: DLL 언로드(DLL_PROCESS_DETACH) 중 스레드 join은 로더 Lock 교착을 일으키므로
+//       정적 소멸자에 의존하지 않고 process_shutdown_thread_pool()로 명시적으로 종료함
+//       (프로세스_종료_문제_분석_및_해결가이드.md 참고)
+class process_thread_pool {
+public:
+    explicit process_thread_pool(int threads);
+    ~process_thread_pool();
+
+    process_thread_pool(const process_thread_pool&) = delete;
+    process_thread_pool& operator=(const process_thread_pool&) = delete;
+
+    int size() const { return (int)m_workers.size(); }
+
+    // [0, n) 구간을 최대 max_threads 개 조각으로 나누어 병렬 실행 (완료까지 대기)
+    // fn(begin, end, slot) : slot은 0 ~ (조각 수 - 1), 조각별 작업 버퍼 선택용
+    // 호출 스레드도 첫 번째 조각을 직접 처리함
+    // fn이 예외를 던지면 나머지 조각이 모두 끝난 뒤 첫 번째 예외를 호출 스레드에서 다시 던짐
+    // (풀 작업 스레드 안에서 다시 parallel_for를 호출하지 말 것 - 교착 가능)
+    void parallel_for(int n, int max_threads, const std::function<void(int, int, int)>& fn);
+
+    // 단일 작업 비동기 실행 (완료 대기 없음)
+    void submit(std::function<void()> task);
+
+private:
+    void worker_loop();
+
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop;
+};
+
+// 공용 스레드 풀 (첫 사용 시 하드웨어 스레드 수만큼 생성)
+// 작업이 끝날 때까지 반환된 shared_ptr을 들고 있어야 함 - 종료 중에도 풀이 해제되지 않도록 참조 수로 보호
+std::shared_ptr<process_thread_pool> process_shared_pool();
+
+// 공용 스레드 풀 종료 (cleanup_all_devices에서 호출, 이후 사용 시 재생성됨)
+// 사용 중인 호출이 없으면 여기서 작업 스레드를 join, 있으면 마지막 사용자가 반환할 때 해제됨
+void process_shutdown_thread_pool();
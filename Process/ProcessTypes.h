@@ -55,6 +55,22 @@ extern "C" {
         struct lut_parameter lut[3];       // LUT 파라미터 [RGB]
     };
 
+    // 출력 변경 영역 구조체 (26.10.16 - 변경된 슬롯만 복사하기 위함)
+    // 각 비트가 struct output의 한 항목을 나타냄 (1: 변경됨)
+    struct output_dirty {
+        unsigned int data[7];              // MTP [WAD] - bit j = data[WAD][j] (17비트 사용)
+        unsigned short IPVS_data[7];       // IPVS [WAD] - bit p = IPVS_data[WAD][p] (10비트 사용)
+        unsigned char measure;             // bit w = measure[w] (7비트 사용)
+        unsigned char lut;                 // bit c = lut[c] (3비트 사용)
+    };
+
+    // 장비 지연 시뮬레이션 설정 (26.10.16 - 하드웨어 없이 TACT 측정용, 0이면 지연 없음)
+    struct sim_timing {
+        float pg_command_ms;        // PG 명령(패턴/전압) 처리 시간
+        float meas_integration_ms;  // 측정기 적분 시간 (이 동안 패턴 유지 필요)
+        float meas_readout_ms;      // 측정값 전송 시간 (패턴 변경과 병행 가능)
+    };
+
     // 포트 연결 상태 관리 구조체 (25.02.08 - 종료 처리 강화)
     struct port_state {
         int pg_port;           // PG 포트 번호 (-1: 연결 안 됨)
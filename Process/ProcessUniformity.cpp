@@ -0,0 +1,452 @@
+// ProcessUniformity.cpp : IPVS 측정 포인트 균일도 구현
+
+#include "pch.h"
+#include "ProcessUniformity.h"
+#include "ProcessContext.h"
+#include "ProcessIni.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+    const int MAX_POINTS = 10;
+    const int MAX_CELLS = 8;                // 컨텍스트당 보관하는 셀(CELL_ID) 수
+    const float SNAP_DISTANCE = 1e-4f;      // 이 거리 이내의 셀은 포인트 값 그대로 사용
+
+    // 기본 배치: 중심 + 네 모서리
+    const float DEFAULT_POS[5][2] = { { 0.5f, 0.5f }, { 0.1f, 0.1f }, { 0.9f, 0.1f },
+                                      { 0.1f, 0.9f }, { 0.9f, 0.9f } };
+
+    struct layout {
+        int max_point;
+        int center;
+        int grid_w, grid_h;
+        float power;
+        bool placed[MAX_POINTS];
+        float pos[MAX_POINTS][2];
+    };
+
+    void default_layout(layout* lay)
+    {
+        lay->max_point = MAX_POINTS;
+        lay->center = 0;
+        lay->grid_w = lay->grid_h = 9;
+        lay->power = 2.0f;
+        for (int k = 0; k < MAX_POINTS; ++k) {
+            lay->placed[k] = k < 5;
+            lay->pos[k][0] = k < 5 ? DEFAULT_POS[k][0] : 0.0f;
+            lay->pos[k][1] = k < 5 ? DEFAULT_POS[k][1] : 0.0f;
+        }
+    }
+
+    // "a,b" → 숫자 2개 (형식이 다르면 false)
+    bool parse_pair(const std::string& text, double* a, double* b)
+    {
+        std::vector<std::string> parts = ini_split(text, ',');
+        if (parts.size() != 2) return false;
+
+        double v[2];
+        for (int i = 0; i < 2; ++i) {
+            char* end = nullptr;
+            v[i] = std::strtod(parts[i].c_str(), &end);
+            if (parts[i].empty() || *end != '\0') return false;
+        }
+        *a = v[0];
+        *b = v[1];
+        return true;
+    }
+
+    void read_layout(const process_ini& recipe, layout* lay)
+    {
+        default_layout(lay);
+
+        int max_point = recipe.get_int("IPVS", "MAX_POINT", MAX_POINTS);
+        lay->max_point = max_point < 1 ? 1 : (max_point > MAX_POINTS ? MAX_POINTS : max_point);
+
+        // P<n>가 하나라도 있으면 지정된 포인트만 지도에 반영
+        bool any = false;
+        for (int k = 0; k < MAX_POINTS; ++k) {
+            double px, py;
+            if (parse_pair(recipe.get("IPVS_POINTS", "P" + std::to_string(k + 1)), &px, &py)) {
+                if (!any) {
+                    for (int j = 0; j < MAX_POINTS; ++j) lay->placed[j] = false;
+                    any = true;
+                }
+                lay->placed[k] = true;
+                lay->pos[k][0] = (float)px;
+                lay->pos[k][1] = (float)py;
+            }
+        }
+
+        lay->center = recipe.get_int("IPVS_POINTS", "CENTER", 1) - 1;
+        if (lay->center < 0 || lay->center >= lay->max_point) lay->center = -1;
+
+        double gw, gh;
+        if (parse_pair(recipe.get("IPVS_POINTS", "GRID"), &gw, &gh)) {
+            lay->grid_w = gw < 2 ? 2 : (gw > 256 ? 256 : (int)gw);
+            lay->grid_h = gh < 2 ? 2 : (gh > 256 ? 256 : (int)gh);
+        }
+
+        double power = recipe.get_double("IPVS_POINTS", "POWER", 2.0);
+        lay->power = (power > 0.0) ? (float)power : 2.0f;
+    }
+
+    // 배치 적용 - 셀 가중치 계산 후 측정값 초기화
+    void apply_layout(uniformity_state* st, const layout& lay)
+    {
+        st->configured = true;
+        st->max_point = lay.max_point;
+        st->center = lay.center;
+        st->grid_w = lay.grid_w;
+        st->grid_h = lay.grid_h;
+
+        const int cells = lay.grid_w * lay.grid_h;
+        st->snap.assign(cells, -1);
+        for (int k = 0; k < MAX_POINTS; ++k) {
+            st->placed[k] = lay.placed[k] && k < lay.max_point;
+            st->pos[k][0] = lay.pos[k][0];
+            st->pos[k][1] = lay.pos[k][1];
+            st->weight[k].assign(st->placed[k] ? cells : 0, 0.0f);
+        }
+
+        for (int gy = 0; gy < lay.grid_h; ++gy) {
+            const float cy = (float)gy / (float)(lay.grid_h - 1);
+            for (int gx = 0; gx < lay.grid_w; ++gx) {
+                const float cx = (float)gx / (float)(lay.grid_w - 1);
+                const int c = gy * lay.grid_w + gx;
+                for (int k = 0; k < MAX_POINTS; ++k) {
+                    if (!st->placed[k]) continue;
+
+                    const float dx = cx - st->pos[k][0], dy = cy - st->pos[k][1];
+                    const float d = std::sqrt(dx * dx + dy * dy);
+                    if (d < SNAP_DISTANCE) {
+                        if (st->snap[c] < 0) st->snap[c] = (signed char)k;
+                    }
+                    else {
+                        st->weight[k][c] = 1.0f / std::pow(d, lay.power);
+                    }
+                }
+            }
+        }
+    }
+
+    void clear_cell(const uniformity_state* st, uniformity_cell* cell)
+    {
+        const size_t cells = st->snap.size();
+        for (int w = 0; w < 7; ++w) {
+            uniformity_wad& u = cell->wad[w];
+            u.mask = 0;
+            for (int k = 0; k < MAX_POINTS; ++k) u.L[k] = u.x[k] = u.y[k] = 0.0f;
+            u.num_L.assign(cells, 0.0);
+            u.num_x.assign(cells, 0.0);
+            u.num_y.assign(cells, 0.0);
+            u.den.assign(cells, 0.0);
+            u.stats = uniformity_stats();
+        }
+    }
+
+    // 모든 셀 제거 (배치 변경 시 격자 크기가 달라지므로 보관 중인 셀도 버림)
+    void clear_points(uniformity_state* st)
+    {
+        st->cells.clear();
+        st->current = -1;
+    }
+
+    int find_cell(const uniformity_state* st, const std::string& id)
+    {
+        for (int k = 0; k < (int)st->cells.size(); ++k) {
+            if (st->cells[k].cell_id == id) return k;
+        }
+        return -1;
+    }
+
+    // CELL_ID의 셀 선택 - 처음 보는 셀이면 빈 자리 또는 가장 오래 갱신되지 않은 셀을 비워 사용
+    int acquire_cell(uniformity_state* st, const std::string& id)
+    {
+        int k = find_cell(st, id);
+        if (k >= 0) {
+            return k;
+        }
+
+        if ((int)st->cells.size() < MAX_CELLS) {
+            st->cells.push_back(uniformity_cell());
+            k = (int)st->cells.size() - 1;
+        }
+        else {
+            k = 0;
+            for (int i = 1; i < (int)st->cells.size(); ++i) {
+                if (st->cells[i].last < st->cells[k].last) k = i;
+            }
+        }
+        st->cells[k].cell_id = id;
+        clear_cell(st, &st->cells[k]);
+        return k;
+    }
+
+    void ensure_configured(uniformity_state* st)
+    {
+        if (!st->configured) {
+            layout lay;
+            default_layout(&lay);
+            apply_layout(st, lay);
+            clear_points(st);
+        }
+    }
+
+    float point_u(float x, float y) { return (4 * x) / (-2 * x + 12 * y + 3); }
+    float point_v(float x, float y) { return (9 * y) / (-2 * x + 12 * y + 3); }
+
+    // 통계 갱신 - 측정 포인트(최대 10개)만 순회하므로 격자 갱신에 비해 무시할 수준
+    void update_stats(const uniformity_state* st, uniformity_wad* u)
+    {
+        uniformity_stats s = uniformity_stats();
+        const bool has_center = st->center >= 0 && (u->mask & (1u << st->center));
+        float sum = 0.0f, edge_sum = 0.0f, edge_min = 0.0f;
+        int edges = 0;
+
+        for (int k = 0; k < st->max_point; ++k) {
+            if (!(u->mask & (1u << k))) continue;
+
+            const float L = u->L[k];
+            if (s.count == 0 || L < s.L_min) s.L_min = L;
+            if (s.count == 0 || L > s.L_max) s.L_max = L;
+            sum += L;
+            s.count++;
+
+            if (k == st->center) continue;
+            if (edges == 0 || L < edge_min) edge_min = L;
+            edge_sum += L;
+            edges++;
+
+            if (has_center) {
+                const int c = st->center;
+                const float du = point_u(u->x[k], u->y[k]) - point_u(u->x[c], u->y[c]);
+                const float dv = point_v(u->x[k], u->y[k]) - point_v(u->x[c], u->y[c]);
+                const float duv = std::sqrt(du * du + dv * dv);
+                if (duv > s.duv_max) s.duv_max = duv;
+            }
+        }
+
+        if (s.count > 0) {
+            s.L_mean = sum / s.count;
+            s.min_max = (s.L_max > 0.0f) ? s.L_min / s.L_max : 0.0f;
+            s.min_mean = (s.L_mean > 0.0f) ? s.L_min / s.L_mean : 0.0f;
+        }
+        if (has_center) {
+            s.center_L = u->L[st->center];
+            if (edges > 0 && s.center_L > 0.0f) {
+                s.edge_min_ratio = edge_min / s.center_L;
+                s.edge_mean_ratio = edge_sum / edges / s.center_L;
+            }
+        }
+        u->stats = s;
+    }
+}
+
+void uniformity_init(uniformity_state* state)
+{
+    state->configured = false;
+    state->max_point = MAX_POINTS;
+    state->center = -1;
+    state->grid_w = state->grid_h = 0;
+    for (int k = 0; k < MAX_POINTS; ++k) {
+        state->placed[k] = false;
+        state->pos[k][0] = state->pos[k][1] = 0.0f;
+        state->weight[k].clear();
+    }
+    state->snap.clear();
+    state->clock = 0;
+    clear_points(state);
+}
+
+void uniformity_update(process_context* ctx, const struct input* in, const struct output* out)
+{
+    uniformity_state& st = ctx->uni;
+    ensure_configured(&st);
+    const int point = in->cur_point;
+    if (point < 0 || point >= st.max_point) {
+        return;
+    }
+
+    // 셀 단위 누적 - 같은 셀의 포인트 0은 재검사 시작이므로 이전 누적을 버림
+    const char* id_end = static_cast<const char*>(std::memchr(in->CELL_ID, '\0', sizeof(in->CELL_ID)));
+    const std::string id(in->CELL_ID, id_end != nullptr ? id_end : in->CELL_ID + sizeof(in->CELL_ID));
+    const bool known = find_cell(&st, id) >= 0;
+    const int k = acquire_cell(&st, id);
+    uniformity_cell& cell = st.cells[k];
+    if (known && point == 0) {
+        clear_cell(&st, &cell);
+    }
+    cell.last = ++st.clock;
+    st.current = k;
+
+    const unsigned short bit = (unsigned short)(1u << point);
+    const int cells = (int)st.snap.size();
+    const float* wt = st.placed[point] ? st.weight[point].data() : nullptr;
+
+    for (int w = 0; w < 7; ++w) {
+        uniformity_wad& u = cell.wad[w];
+        const struct pattern& p = out->IPVS_data[w][point];
+
+        // 셀별 가중 합에 이 포인트의 변화분만 반영 (재측정이면 이전 값과의 차이)
+        if (wt != nullptr) {
+            const bool again = (u.mask & bit) != 0;
+            const double dL = again ? (double)p.L - u.L[point] : p.L;
+            const double dx = again ? (double)p.x - u.x[point] : p.x;
+            const double dy = again ? (double)p.y - u.y[point] : p.y;
+            for (int c = 0; c < cells; ++c) {
+                u.num_L[c] += wt[c] * dL;
+                u.num_x[c] += wt[c] * dx;
+                u.num_y[c] += wt[c] * dy;
+                if (!again) u.den[c] += wt[c];
+            }
+        }
+
+        u.L[point] = p.L;
+        u.x[point] = p.x;
+        u.y[point] = p.y;
+        u.mask |= bit;
+        update_stats(&st, &u);
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_uniformity_setup_ctx(process_context* ctx, const char* recipe)
+    {
+        if (ctx == nullptr) {
+            return false;
+        }
+
+        layout lay;
+        if (recipe == nullptr) {
+            default_layout(&lay);
+        }
+        else {
+            process_ini ini;
+            if (!ini.load(recipe)) {
+                return false;
+            }
+            read_layout(ini, &lay);
+        }
+
+        apply_layout(&ctx->uni, lay);
+        clear_points(&ctx->uni);
+        return true;
+    }
+
+    __declspec(dllexport) void process_uniformity_reset_ctx(process_context* ctx)
+    {
+        if (ctx == nullptr) {
+            return;
+        }
+        ensure_configured(&ctx->uni);
+        clear_points(&ctx->uni);
+    }
+
+    __declspec(dllexport) int process_uniformity_get_ctx(process_context* ctx, int wad, struct uniformity_stats* stats)
+    {
+        if (ctx == nullptr || wad < 0 || wad >= 7 || stats == nullptr) {
+            return -1;
+        }
+
+        const uniformity_state& st = ctx->uni;
+        *stats = st.current >= 0 ? st.cells[st.current].wad[wad].stats : uniformity_stats();
+        return stats->count;
+    }
+
+    __declspec(dllexport) int process_uniformity_get_cell_ctx(process_context* ctx, const char* cell_id, int wad,
+                                                              struct uniformity_stats* stats)
+    {
+        if (ctx == nullptr || cell_id == nullptr || wad < 0 || wad >= 7 || stats == nullptr) {
+            return -1;
+        }
+
+        const int k = find_cell(&ctx->uni, cell_id);
+        *stats = k >= 0 ? ctx->uni.cells[k].wad[wad].stats : uniformity_stats();
+        return stats->count;
+    }
+
+    __declspec(dllexport) int process_uniformity_grid_ctx(process_context* ctx, int* width, int* height)
+    {
+        if (ctx == nullptr) {
+            return -1;
+        }
+
+        ensure_configured(&ctx->uni);
+        if (width != nullptr) *width = ctx->uni.grid_w;
+        if (height != nullptr) *height = ctx->uni.grid_h;
+        return ctx->uni.grid_w * ctx->uni.grid_h;
+    }
+
+    __declspec(dllexport) int process_uniformity_map_ctx(process_context* ctx, int wad,
+                                                         float* L, float* x, float* y, int capacity)
+    {
+        if (ctx == nullptr || wad < 0 || wad >= 7) {
+            return -1;
+        }
+
+        uniformity_state& st = ctx->uni;
+        ensure_configured(&st);
+        const int cells = (int)st.snap.size();
+        if (capacity < cells) {
+            return -1;
+        }
+
+        // 갱신된 셀이 없으면 모두 0
+        if (st.current < 0) {
+            for (int c = 0; c < cells; ++c) {
+                if (L != nullptr) L[c] = 0.0f;
+                if (x != nullptr) x[c] = 0.0f;
+                if (y != nullptr) y[c] = 0.0f;
+            }
+            return cells;
+        }
+
+        const uniformity_wad& u = st.cells[st.current].wad[wad];
+        for (int c = 0; c < cells; ++c) {
+            const int k = st.snap[c];
+            float vL = 0.0f, vx = 0.0f, vy = 0.0f;
+            if (k >= 0 && (u.mask & (1u << k))) {
+                vL = u.L[k];
+                vx = u.x[k];
+                vy = u.y[k];
+            }
+            else if (u.den[c] > 0.0) {
+                vL = (float)(u.num_L[c] / u.den[c]);
+                vx = (float)(u.num_x[c] / u.den[c]);
+                vy = (float)(u.num_y[c] / u.den[c]);
+            }
+            if (L != nullptr) L[c] = vL;
+            if (x != nullptr) x[c] = vx;
+            if (y != nullptr) y[c] = vy;
+        }
+        return cells;
+    }
+
+    __declspec(dllexport) bool process_uniformity_setup(const char* recipe)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_uniformity_setup_ctx(process_default_context(), recipe);
+    }
+
+    __declspec(dllexport) void process_uniformity_reset()
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        process_uniformity_reset_ctx(process_default_context());
+    }
+
+    __declspec(dllexport) int process_uniformity_get(int wad, struct uniformity_stats* stats)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_uniformity_get_ctx(process_default_context(), wad, stats);
+    }
+
+    __declspec(dllexport) int process_uniformity_get_cell(const char* cell_id, int wad, struct uniformity_stats* stats)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_uniformity_get_cell_ctx(process_default_context(), cell_id, wad, stats);
+    }
+
+} // extern "C"
@@ -0,0 +1,127 @@
+#pragma once
+// ProcessUniformity.h : IPVS 측정 포인트 균일도 (WAD별 통계 + 보간 분포 지도)
+// IPVS_test가 포인트를 기록할 때마다 해당 포인트만 반영하여 갱신 (전체 재계산 없음)
+//   통계: L 최소/최대/평균, 최소/최대 · 최소/평균 균일도, 중심 대비 가장자리 비, 중심 대비 최대 Δu'v'
+//   지도: 격자 셀마다 역거리 가중(IDW) 보간한 L, x, y - 셀별 가중 합을 누적하여 포인트 1개당 O(셀 수)
+//
+// 포인트 배치 (Recipe) - 좌표는 패널 기준 0~1, P1 = cur_point 0
+//   [IPVS]         MAX_POINT=<n>          (이 수 이상의 포인트는 무시)
+//   [IPVS_POINTS]  P<n>=x,y               (없으면 중심 + 네 모서리 10%/90%)
+//                  CENTER=<n>             (중심 포인트 번호, 기본 1)
+//                  GRID=<가로>,<세로>      (지도 격자, 기본 9,9 - 최소 2)
+//                  POWER=<p>              (IDW 거리 지수, 기본 2)
+//
+// 26.10.16 - 누적 단위는 셀(input.CELL_ID): 컨텍스트마다 최근 셀 8개의 상태를 따로 보관
+//   처음 보는 CELL_ID는 새 상태에서 시작 (8개를 넘으면 가장 오래 갱신되지 않은 셀을 교체)
+//   같은 CELL_ID라도 cur_point 0이 들어오면 재검사로 보고 그 셀의 누적을 초기화
+//   기본 컨텍스트(IPVS_test)를 여러 Zone이 함께 써도 셀이 다르면 섞이지 않음
+//   IPVS_test_batch 등 배치 함수도 셀마다 입력 순서대로 갱신
+// 조회: *_get_cell은 지정한 CELL_ID, *_get / *_map은 마지막으로 갱신된 CELL_ID
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // WAD 1개의 균일도 통계 (측정된 포인트 기준, 값이 없으면 0)
+    struct uniformity_stats {
+        int count;                  // 측정된 포인트 수
+        float L_min, L_max, L_mean;
+        float min_max;              // L_min / L_max
+        float min_mean;             // L_min / L_mean
+        float center_L;             // 중심 포인트 L (미측정: 0)
+        float edge_min_ratio;       // 가장자리(중심 제외) 최소 L / 중심 L
+        float edge_mean_ratio;      // 가장자리 평균 L / 중심 L
+        float duv_max;              // 중심 대비 최대 Δu'v'
+    };
+
+    // ===== IPVS 균일도 (26.10.16) =====
+
+    /// <summary>
+    /// Recipe에서 포인트 배치 / 격자 설정 후 초기화 - nullptr: 기본 배치
+    /// Recipe 읽기 실패 시 false (기존 설정 유지)
+    /// </summary>
+    __declspec(dllexport) bool process_uniformity_setup_ctx(process_context* ctx, const char* recipe);
+
+    /// <summary>
+    /// 모든 셀의 측정 포인트 초기화
+    /// </summary>
+    __declspec(dllexport) void process_uniformity_reset_ctx(process_context* ctx);
+
+    /// <summary>
+    /// 마지막으로 갱신된 CELL_ID의 WAD 통계 조회 - 측정된 포인트 수 반환 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_uniformity_get_ctx(process_context* ctx, int wad, struct uniformity_stats* stats);
+
+    /// <summary>
+    /// 지정한 셀(CELL_ID)의 WAD 통계 조회 - 측정된 포인트 수 반환 (보관 중인 셀이 아니면 0, 인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_uniformity_get_cell_ctx(process_context* ctx, const char* cell_id, int wad,
+                                                              struct uniformity_stats* stats);
+
+    /// <summary>
+    /// 지도 격자 크기 조회 - 셀 수 반환 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_uniformity_grid_ctx(process_context* ctx, int* width, int* height);
+
+    /// <summary>
+    /// 마지막으로 갱신된 CELL_ID의 WAD 보간 지도 복사 (행 우선, 각 capacity개 이상 - nullptr인 배열은 생략)
+    /// 셀 수 반환 (인자 오류 / capacity 부족: -1), 측정 포인트가 없는 셀은 0
+    /// </summary>
+    __declspec(dllexport) int process_uniformity_map_ctx(process_context* ctx, int wad,
+                                                         float* L, float* x, float* y, int capacity);
+
+    // 기본 컨텍스트 래퍼
+    __declspec(dllexport) bool process_uniformity_setup(const char* recipe);
+    __declspec(dllexport) void process_uniformity_reset();
+    __declspec(dllexport) int process_uniformity_get(int wad, struct uniformity_stats* stats);
+    __declspec(dllexport) int process_uniformity_get_cell(const char* cell_id, int wad, struct uniformity_stats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+#include <string>
+#include <vector>
+
+// WAD 1개의 누적 상태
+struct uniformity_wad {
+    unsigned short mask;                    // 측정된 포인트 (bit n = cur_point n)
+    float L[10], x[10], y[10];              // 포인트별 마지막 측정값
+    std::vector<double> num_L, num_x, num_y, den;  // 셀별 IDW 가중 합 (Σw·값, Σw)
+    uniformity_stats stats;                 // 마지막 갱신 결과
+};
+
+// 셀 1개의 누적 상태
+struct uniformity_cell {
+    std::string cell_id;                    // input.CELL_ID
+    unsigned long long last;                // 마지막 갱신 순번 (교체 대상 선택)
+    uniformity_wad wad[7];
+};
+
+// 컨텍스트별 균일도 상태
+struct uniformity_state {
+    bool configured;                        // 배치 설정 여부 (false: 첫 갱신 시 기본 배치)
+    int max_point;                          // 사용 포인트 수 (1~10)
+    int center;                             // 중심 포인트 (-1: 없음)
+    int grid_w, grid_h;
+    bool placed[10];                        // 좌표가 지정된 포인트 (지도에 반영)
+    float pos[10][2];                       // 포인트 좌표 (0~1)
+    std::vector<float> weight[10];          // 포인트별 셀 가중치 1 / d^p
+    std::vector<signed char> snap;          // 포인트와 겹치는 셀 (-1: 없음, 해당 포인트 값 그대로 사용)
+    std::vector<uniformity_cell> cells;     // 최근 셀 (최대 8개)
+    int current;                            // 마지막으로 갱신된 셀 (-1: 없음)
+    unsigned long long clock;               // 갱신 순번
+};
+
+void uniformity_init(uniformity_state* state);
+
+// in->CELL_ID 셀에 in->cur_point 포인트 1개 반영 (IPVS_test_ctx가 IPVS_data 기록 후 호출)
+void uniformity_update(process_context* ctx, const struct input* in, const struct output* out);
+#endif
@@ -0,0 +1,285 @@
+// ProcessVoltageTarget.cpp : RGB 전압 목표 탐색 (PGVoltagesnd + Getdata 폐루프)
+
+#include "pch.h"
+#include "ProcessVoltageTarget.h"
+#include "ProcessContext.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+    const float DEFAULT_XY_TOL = 0.002f;
+    const float DEFAULT_L_TOL = 0.01f;
+    const int DEFAULT_MAX_MEASURE = 12;
+    const int DEFAULT_V_MAX = 4095;
+    const double FD_STEP = 0.05;            // 차분 추정 전압 변화 (5%)
+    const double MAX_STEP = 0.5;            // 채널당 최대 |Δ ln V|
+
+    struct probe {
+        int v[3];
+        double r[3];                        // (XYZ - 목표) / Y_목표
+        struct pattern meas;
+    };
+
+    struct target_state {
+        process_context* ctx;
+        double T[3];                        // 목표 XYZ
+        double Yt;
+        voltage_result* result;
+    };
+
+    // 전압 설정 + 측정 → 잔차 (측정 횟수 증가)
+    bool measure(target_state* st, const int v[3], probe* p)
+    {
+        std::memcpy(p->v, v, sizeof(p->v));
+        ++st->result->measurements;
+
+        if (!PGVoltagesnd_ctx(st->ctx, v[0], v[1], v[2]) ||
+            !meas_integrate(st->ctx) || !meas_readout(st->ctx, &p->meas) || !(p->meas.y > 0.0f)) {
+            return false;
+        }
+
+        const double x = p->meas.x, y = p->meas.y, L = p->meas.L;
+        const double XYZ[3] = { x / y * L, L, (1.0 - x - y) / y * L };
+        for (int i = 0; i < 3; ++i) {
+            p->r[i] = (XYZ[i] - st->T[i]) / st->Yt;
+        }
+        return true;
+    }
+
+    double norm2(const double r[3])
+    {
+        return r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+    }
+
+    // J du = b 풀이 (일반 3x3, Cramer)
+    bool solve3(const double J[9], const double b[3], double du[3])
+    {
+        const double det = J[0] * (J[4] * J[8] - J[5] * J[7]) - J[1] * (J[3] * J[8] - J[5] * J[6]) +
+                           J[2] * (J[3] * J[7] - J[4] * J[6]);
+        if (!(std::fabs(det) > 1e-12)) return false;
+
+        for (int c = 0; c < 3; ++c) {
+            double M[9];
+            std::memcpy(M, J, sizeof(M));
+            M[c] = b[0];
+            M[3 + c] = b[1];
+            M[6 + c] = b[2];
+            du[c] = (M[0] * (M[4] * M[8] - M[5] * M[7]) - M[1] * (M[3] * M[8] - M[5] * M[6]) +
+                     M[2] * (M[3] * M[7] - M[4] * M[6])) / det;
+        }
+        return true;
+    }
+
+    int clamp_voltage(double v, int v_max)
+    {
+        long long r = std::llround(v);
+        if (r < 1) r = 1;
+        if (r > v_max) r = v_max;
+        return (int)r;
+    }
+
+    // 채널별 차분으로 Jacobian 추정 (측정 3회)
+    bool estimate_jacobian(target_state* st, const probe& base, int v_max, double J[9])
+    {
+        for (int c = 0; c < 3; ++c) {
+            int v[3] = { base.v[0], base.v[1], base.v[2] };
+            v[c] = clamp_voltage(base.v[c] * (1.0 + FD_STEP), v_max);
+            if (v[c] == base.v[c]) v[c] = clamp_voltage(base.v[c] * (1.0 - FD_STEP), v_max);
+            if (v[c] == base.v[c]) return false;
+
+            probe p;
+            ++st->result->fd_measurements;
+            if (!measure(st, v, &p)) return false;
+
+            const double du = std::log((double)v[c] / base.v[c]);
+            for (int i = 0; i < 3; ++i) {
+                J[i * 3 + c] = (p.r[i] - base.r[i]) / du;
+            }
+        }
+        return true;
+    }
+
+    void record(voltage_result* result, const probe& p, const voltage_target& t)
+    {
+        result->RV = p.v[0];
+        result->GV = p.v[1];
+        result->BV = p.v[2];
+        result->x = p.meas.x;
+        result->y = p.meas.y;
+        result->L = p.meas.L;
+        result->dxy = std::max(std::fabs(p.meas.x - t.x), std::fabs(p.meas.y - t.y));
+        result->dL = std::fabs(p.meas.L / t.L - 1.0f);
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) bool process_voltage_target_ctx(process_context* ctx, const struct voltage_target* target,
+                                                          struct voltage_result* result)
+    {
+        if (ctx == nullptr || target == nullptr || result == nullptr) {
+            return false;
+        }
+        std::memset(result, 0, sizeof(*result));
+        if (!(target->L > 0.0f) || !(target->y > 0.0f) || !(target->x > 0.0f) || target->x + target->y >= 1.0f) {
+            return false;
+        }
+
+        voltage_target t = *target;
+        if (!(t.xy_tol > 0.0f)) t.xy_tol = DEFAULT_XY_TOL;
+        if (!(t.L_tol > 0.0f)) t.L_tol = DEFAULT_L_TOL;
+        if (t.max_measure <= 0) t.max_measure = DEFAULT_MAX_MEASURE;
+        if (t.v_max <= 0) t.v_max = DEFAULT_V_MAX;
+
+        target_state st;
+        st.ctx = ctx;
+        st.Yt = t.L;
+        st.T[0] = t.x / t.y * t.L;
+        st.T[1] = t.L;
+        st.T[2] = (1.0 - t.x - t.y) / t.y * t.L;
+        st.result = result;
+
+        // 시작 전압: 지정값 → 직전 수렴 전압 → 상한의 3/4
+        int v[3] = { t.RV, t.GV, t.BV };
+        for (int c = 0; c < 3; ++c) {
+            if (v[c] <= 0) v[c] = (ctx->vt_last[c] > 0) ? ctx->vt_last[c] : t.v_max * 3 / 4;
+            v[c] = clamp_voltage(v[c], t.v_max);
+        }
+
+        probe cur;
+        if (!measure(&st, v, &cur)) {
+            return false;
+        }
+
+        auto converged = [&t](const probe& p) {
+            return std::fabs(p.meas.x - t.x) <= t.xy_tol && std::fabs(p.meas.y - t.y) <= t.xy_tol &&
+                   std::fabs(p.meas.L / t.L - 1.0f) <= t.L_tol;
+        };
+
+        double J[9];
+        if (ctx->vt_jacobian_valid) {
+            std::memcpy(J, ctx->vt_jacobian, sizeof(J));
+            result->jacobian_reused = 1;
+        }
+        else if (!converged(cur)) {
+            if (!estimate_jacobian(&st, cur, t.v_max, J)) {
+                record(result, cur, t);
+                return false;
+            }
+            std::memcpy(ctx->vt_jacobian, J, sizeof(J));
+            ctx->vt_jacobian_valid = true;
+        }
+
+        // 차분 추정 후에는 PG가 마지막 차분 전압에 있음
+        bool pg_at_cur = result->fd_measurements == 0;
+
+        while (!converged(cur) && result->measurements < t.max_measure) {
+            double neg_r[3] = { -cur.r[0], -cur.r[1], -cur.r[2] };
+            double du[3];
+            if (!solve3(J, neg_r, du)) {
+                break;
+            }
+
+            int next[3];
+            bool moved = false;
+            for (int c = 0; c < 3; ++c) {
+                if (du[c] > MAX_STEP) du[c] = MAX_STEP;
+                if (du[c] < -MAX_STEP) du[c] = -MAX_STEP;
+                next[c] = clamp_voltage(cur.v[c] * std::exp(du[c]), t.v_max);
+                moved = moved || next[c] != cur.v[c];
+            }
+            if (!moved) {
+                break;      // 전압 분해능 한계
+            }
+
+            probe p;
+            ++result->iterations;
+            if (!measure(&st, next, &p)) {
+                break;
+            }
+            pg_at_cur = false;
+
+            // Broyden 갱신 (정수 반올림 후 실제 Δu 사용)
+            double step[3], dr[3], dd = 0.0;
+            for (int c = 0; c < 3; ++c) {
+                step[c] = std::log((double)next[c] / cur.v[c]);
+                dd += step[c] * step[c];
+            }
+            for (int i = 0; i < 3; ++i) {
+                dr[i] = p.r[i] - cur.r[i];
+                for (int c = 0; c < 3; ++c) dr[i] -= J[i * 3 + c] * step[c];
+            }
+            if (dd > 0.0) {
+                for (int i = 0; i < 3; ++i) {
+                    for (int c = 0; c < 3; ++c) J[i * 3 + c] += dr[i] * step[c] / dd;
+                }
+            }
+
+            // 잔차가 줄어든 경우에만 이동 (늘어나면 갱신된 Jacobian으로 같은 점에서 다시 계산)
+            if (norm2(p.r) < norm2(cur.r)) {
+                cur = p;
+                pg_at_cur = true;
+            }
+        }
+
+        if (result->iterations > 0 || result->fd_measurements > 0) {
+            std::memcpy(ctx->vt_jacobian, J, sizeof(J));
+            ctx->vt_jacobian_valid = true;
+        }
+
+        // PG를 최종 전압으로 복귀 (마지막 측정점이 거부된 경우)
+        if (!pg_at_cur) {
+            PGVoltagesnd_ctx(ctx, cur.v[0], cur.v[1], cur.v[2]);
+        }
+
+        record(result, cur, t);
+        result->converged = converged(cur) ? 1 : 0;
+        if (result->converged) {
+            std::memcpy(ctx->vt_last, cur.v, sizeof(ctx->vt_last));
+        }
+        return result->converged != 0;
+    }
+
+    __declspec(dllexport) int process_voltage_target_series_ctx(process_context* ctx,
+                                                                const struct voltage_target* targets, int n,
+                                                                struct voltage_result* results)
+    {
+        if (ctx == nullptr || targets == nullptr || results == nullptr || n <= 0) {
+            return 0;
+        }
+
+        int converged = 0;
+        for (int i = 0; i < n; ++i) {
+            voltage_target t = targets[i];
+            if (i > 0 && results[i - 1].converged) {
+                // 시작 전압을 지정하지 않은 목표는 직전 목표의 수렴 전압에서 시작
+                if (t.RV <= 0) t.RV = results[i - 1].RV;
+                if (t.GV <= 0) t.GV = results[i - 1].GV;
+                if (t.BV <= 0) t.BV = results[i - 1].BV;
+            }
+            if (process_voltage_target_ctx(ctx, &t, &results[i])) {
+                ++converged;
+            }
+        }
+        return converged;
+    }
+
+    __declspec(dllexport) void process_voltage_target_reset_ctx(process_context* ctx)
+    {
+        if (ctx == nullptr) {
+            return;
+        }
+        ctx->vt_jacobian_valid = false;
+        ctx->vt_last[0] = ctx->vt_last[1] = ctx->vt_last[2] = 0;
+    }
+
+    __declspec(dllexport) bool process_voltage_target(const struct voltage_target* target,
+                                                      struct voltage_result* result)
+    {
+        std::lock_guard<std::mutex> guard(process_default_lock());
+        return process_voltage_target_ctx(process_default_context(), target, result);
+    }
+
+} // extern "C"
@@ -0,0 +1,72 @@
+#pragma once
+// ProcessVoltageTarget.h : RGB 전압 목표 탐색 (PGVoltagesnd + Getdata 폐루프)
+// 목표 (x, y, L)을 만족하는 (RV, GV, BV)를 최소 측정 횟수로 탐색
+//   변수: u = ln(전압),  잔차: r = (XYZ_측정 - XYZ_목표) / Y_목표
+//   감마 특성(L ∝ V^γ)에서 dr/du는 계조와 거의 무관하므로 인접 계조 목표에서 Jacobian을 그대로 재사용
+//   Jacobian이 없으면 채널별 5% 전압 변화로 1회 차분 추정 (측정 3회 추가)
+//   갱신: Newton 단계 Δu = -J⁻¹ r (채널당 |Δu| ≤ 0.5), 측정 후 Broyden 1차 갱신
+//   J ← J + (Δr - J Δu) Δuᵀ / (Δuᵀ Δu)
+// 패턴은 호출 전에 설정되어 있어야 함 (보통 W)
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 전압 목표
+    struct voltage_target {
+        float x;                    // 목표 색좌표 x
+        float y;                    // 목표 색좌표 y
+        float L;                    // 목표 휘도 (cd/m²)
+        float xy_tol;               // 색좌표 허용 오차 (|Δx|, |Δy| 각각, 0 이하: 0.002)
+        float L_tol;                // 휘도 상대 허용 오차 (0 이하: 0.01)
+        int max_measure;            // 최대 측정 횟수 (0 이하: 12)
+        int RV, GV, BV;             // 시작 전압 (0: 직전 수렴 전압 사용)
+        int v_max;                  // 전압 코드 상한 (0 이하: 4095)
+    };
+
+    // 탐색 결과 / 통계
+    struct voltage_result {
+        int RV, GV, BV;             // 최종 전압 (수렴 시 목표 만족 전압)
+        int converged;              // 1: 허용 오차 이내
+        int measurements;           // PG 설정 + 측정 왕복 횟수 (차분 추정 포함)
+        int iterations;             // Newton 단계 수
+        int jacobian_reused;        // 1: 이전 목표의 Jacobian 재사용
+        int fd_measurements;        // Jacobian 차분 추정에 사용한 측정 수
+        float x, y, L;              // 최종 측정값
+        float dxy;                  // max(|Δx|, |Δy|)
+        float dL;                   // |L / L_목표 - 1|
+    };
+
+    // ===== 전압 목표 탐색 (26.10.16) =====
+
+    /// <summary>
+    /// 목표 (x, y, L) 전압 탐색 - 수렴하면 true (결과는 수렴 여부와 관계없이 기록)
+    /// </summary>
+    __declspec(dllexport) bool process_voltage_target_ctx(process_context* ctx, const struct voltage_target* target,
+                                                          struct voltage_result* result);
+
+    /// <summary>
+    /// 인접 계조 목표 연속 탐색 (이전 목표의 전압/Jacobian에서 시작) - 수렴한 목표 수 반환
+    /// </summary>
+    __declspec(dllexport) int process_voltage_target_series_ctx(process_context* ctx,
+                                                                const struct voltage_target* targets, int n,
+                                                                struct voltage_result* results);
+
+    /// <summary>
+    /// 저장된 Jacobian / 직전 전압 초기화 (패널 교체 시)
+    /// </summary>
+    __declspec(dllexport) void process_voltage_target_reset_ctx(process_context* ctx);
+
+    // 기본 컨텍스트 래퍼
+    __declspec(dllexport) bool process_voltage_target(const struct voltage_target* target,
+                                                      struct voltage_result* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
@@ -0,0 +1,166 @@
+// ProcessWadShift.cpp : 시야각(WAD) 변화량 구현
+// 세 경로(스칼라 / SSE2 / AVX2)의 식은 반드시 같은 연산 순서로 유지할 것
+
+#include "pch.h"
+#include "ProcessWadShift.h"
+#include "ProcessCpu.h"
+#include <cmath>
+
+namespace {
+
+    const int PATTERNS = 17;
+
+    // ===== 스칼라 =====
+
+    void shift_scalar(const struct pattern& p, const struct pattern& r, struct wad_shift* s)
+    {
+        const float den = -2.0f * p.x + 12.0f * p.y + 3.0f;
+        const float den0 = -2.0f * r.x + 12.0f * r.y + 3.0f;
+        const float du = (4.0f * p.x) / den - (4.0f * r.x) / den0;
+        const float dv = (9.0f * p.y) / den - (9.0f * r.y) / den0;
+
+        s->L_ratio = (r.L > 0.0f) ? p.L / r.L : 0.0f;
+        s->duv = std::sqrt(du * du + dv * dv);
+        s->dx = p.x - r.x;
+        s->dy = p.y - r.y;
+    }
+
+    // ===== SSE2 (4개) =====
+
+#if defined(PROCESS_CPU_SSE2)
+    // pattern 4개 → x, y, L
+    inline void load_xyl(const struct pattern* p, __m128* x, __m128* y, __m128* L)
+    {
+        const float* src = reinterpret_cast<const float*>(p);
+        __m128 r0 = _mm_loadu_ps(src + 0), r1 = _mm_loadu_ps(src + 8);
+        __m128 r2 = _mm_loadu_ps(src + 16), r3 = _mm_loadu_ps(src + 24);
+        __m128 h0 = _mm_loadu_ps(src + 4), h1 = _mm_loadu_ps(src + 12);
+        __m128 h2 = _mm_loadu_ps(src + 20), h3 = _mm_loadu_ps(src + 28);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _MM_TRANSPOSE4_PS(h0, h1, h2, h3);
+        *x = r0;
+        *y = r1;
+        *L = h0;
+    }
+
+    int shift_sse2(const struct pattern* row, const struct pattern* ref, struct wad_shift* out, int n)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        int j = 0;
+        for (; j + 4 <= n; j += 4) {
+            __m128 x, y, L, x0, y0, L0;
+            load_xyl(row + j, &x, &y, &L);
+            load_xyl(ref + j, &x0, &y0, &L0);
+
+            const __m128 den = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), x),
+                                                     _mm_mul_ps(_mm_set1_ps(12.0f), y)), _mm_set1_ps(3.0f));
+            const __m128 den0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), x0),
+                                                      _mm_mul_ps(_mm_set1_ps(12.0f), y0)), _mm_set1_ps(3.0f));
+            const __m128 du = _mm_sub_ps(_mm_div_ps(_mm_mul_ps(_mm_set1_ps(4.0f), x), den),
+                                         _mm_div_ps(_mm_mul_ps(_mm_set1_ps(4.0f), x0), den0));
+            const __m128 dv = _mm_sub_ps(_mm_div_ps(_mm_mul_ps(_mm_set1_ps(9.0f), y), den),
+                                         _mm_div_ps(_mm_mul_ps(_mm_set1_ps(9.0f), y0), den0));
+
+            // 4개 변화량(SoA) → wad_shift 4개(AoS)
+            __m128 ratio = _mm_and_ps(_mm_cmpgt_ps(L0, zero), _mm_div_ps(L, L0));
+            __m128 duv = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(du, du), _mm_mul_ps(dv, dv)));
+            __m128 dx = _mm_sub_ps(x, x0);
+            __m128 dy = _mm_sub_ps(y, y0);
+            _MM_TRANSPOSE4_PS(ratio, duv, dx, dy);
+
+            float* dst = reinterpret_cast<float*>(out + j);
+            _mm_storeu_ps(dst + 0, ratio);
+            _mm_storeu_ps(dst + 4, duv);
+            _mm_storeu_ps(dst + 8, dx);
+            _mm_storeu_ps(dst + 12, dy);
+        }
+        return j;
+    }
+#endif
+
+    // ===== AVX2 (8개) =====
+
+#if defined(PROCESS_CPU_AVX2)
+    PROCESS_TARGET_AVX2
+    int shift_avx2(const struct pattern* row, const struct pattern* ref, struct wad_shift* out, int n)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        int j = 0;
+        for (; j + 8 <= n; j += 8) {
+            __m256 f[8], f0[8];
+            transpose8_ps(reinterpret_cast<const float*>(row + j), f);
+            transpose8_ps(reinterpret_cast<const float*>(ref + j), f0);
+            const __m256 x = f[0], y = f[1], L = f[4];
+            const __m256 x0 = f0[0], y0 = f0[1], L0 = f0[4];
+
+            const __m256 den = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), x),
+                                                           _mm256_mul_ps(_mm256_set1_ps(12.0f), y)),
+                                             _mm256_set1_ps(3.0f));
+            const __m256 den0 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), x0),
+                                                            _mm256_mul_ps(_mm256_set1_ps(12.0f), y0)),
+                                              _mm256_set1_ps(3.0f));
+            const __m256 du = _mm256_sub_ps(_mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), x), den),
+                                            _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), x0), den0));
+            const __m256 dv = _mm256_sub_ps(_mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(9.0f), y), den),
+                                            _mm256_div_ps(_mm256_mul_ps(_mm256_set1_ps(9.0f), y0), den0));
+
+            const __m256 ratio = _mm256_and_ps(_mm256_cmp_ps(L0, zero, _CMP_GT_OQ), _mm256_div_ps(L, L0));
+            const __m256 duv = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(du, du), _mm256_mul_ps(dv, dv)));
+            const __m256 dx = _mm256_sub_ps(x, x0);
+            const __m256 dy = _mm256_sub_ps(y, y0);
+
+            // 8개 변화량(SoA) → wad_shift 8개(AoS): 128비트 절반씩 4×4 전치
+            __m256 t0 = _mm256_unpacklo_ps(ratio, duv), t1 = _mm256_unpackhi_ps(ratio, duv);
+            __m256 t2 = _mm256_unpacklo_ps(dx, dy), t3 = _mm256_unpackhi_ps(dx, dy);
+            __m256 a0 = _mm256_shuffle_ps(t0, t2, 0x44), a1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+            __m256 a2 = _mm256_shuffle_ps(t1, t3, 0x44), a3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+
+            float* dst = reinterpret_cast<float*>(out + j);
+            _mm256_storeu_ps(dst + 0, _mm256_permute2f128_ps(a0, a1, 0x20));
+            _mm256_storeu_ps(dst + 8, _mm256_permute2f128_ps(a2, a3, 0x20));
+            _mm256_storeu_ps(dst + 16, _mm256_permute2f128_ps(a0, a1, 0x31));
+            _mm256_storeu_ps(dst + 24, _mm256_permute2f128_ps(a2, a3, 0x31));
+        }
+        return j;
+    }
+#endif
+
+    void shift_row(const struct pattern* row, const struct pattern* ref, struct wad_shift* out, int level)
+    {
+        int j = 0;
+#if defined(PROCESS_CPU_AVX2)
+        if (level >= CPU_SIMD_AVX2) {
+            j = shift_avx2(row, ref, out, PATTERNS);
+        }
+#endif
+#if defined(PROCESS_CPU_SSE2)
+        if (level >= CPU_SIMD_SSE2) {
+            j += shift_sse2(row + j, ref + j, out + j, PATTERNS - j);
+        }
+#endif
+        (void)level;
+        for (; j < PATTERNS; ++j) {
+            shift_scalar(row[j], ref[j], &out[j]);
+        }
+    }
+}
+
+extern "C" {
+
+    __declspec(dllexport) int process_wad_shift(const struct output* outs, int count,
+                                                struct wad_shift_matrix* shifts)
+    {
+        if (outs == nullptr || shifts == nullptr || count < 0) {
+            return -1;
+        }
+
+        const int level = cpu_simd_level();
+        for (int c = 0; c < count; ++c) {
+            for (int w = 0; w < 7; ++w) {
+                shift_row(outs[c].data[w], outs[c].data[0], shifts[c].data[w], level);
+            }
+        }
+        return count;
+    }
+
+} // extern "C"
@@ -0,0 +1,40 @@
+#pragma once
+// ProcessWadShift.h : 시야각(WAD) 변화량 - 0도 대비 패턴별 휘도비 / 색 변화
+// data[wad][패턴]과 data[0][패턴]을 비교하여 wad_shift_matrix[wad][패턴]에 기록
+//   L_ratio = L / L0 (L0 <= 0 이면 0),  dx = x - x0,  dy = y - y0
+//   duv     = sqrt((u' - u0')² + (v' - v0')²)  - u'v'는 x, y에서 Getdata와 같은 식으로 계산
+// 패턴 방향으로 벡터화 (AVX2 8개 / SSE2 4개 / 스칼라 - 같은 연산 순서, 결과 동일)
+
+#include "ProcessFunctions.h"
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // 패턴 1개의 0도 대비 변화량
+    struct wad_shift {
+        float L_ratio;              // 휘도비 L / L0
+        float duv;                  // Δu'v'
+        float dx, dy;               // Δx, Δy
+    };
+
+    // output.data와 같은 배치 [WAD][패턴] (WAD 0 행은 L_ratio 1, 변화량 0)
+    struct wad_shift_matrix {
+        struct wad_shift data[7][17];
+    };
+
+    // ===== 시야각 변화량 (26.10.16) =====
+
+    /// <summary>
+    /// output count개의 시야각 변화량 계산 (shifts: wad_shift_matrix[count]) - 계산한 output 수 반환 (인자 오류: -1)
+    /// </summary>
+    __declspec(dllexport) int process_wad_shift(const struct output* outs, int count,
+                                                struct wad_shift_matrix* shifts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
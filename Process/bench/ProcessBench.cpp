@@ -0,0 +1,726 @@
+// ProcessBench.cpp : Process 엔진 마이크로 벤치마크 (CMake process_bench)
+// export 함수 호출당 지연(p50 / p99)과 처리량을 측정해 JSON으로 출력 - CI에서 성능 회귀 추적용
+//
+// 사용법: process_bench [--iterations N] [--threads N] [--recipe OptiX.ini] [--json result.json]
+//   --iterations : 측정 반복 수 (무거운 호출은 1/10), 기본 20000
+//   --threads    : 다중 스레드 변형의 최대 스레드 수 (1, 2, 4, ... 순서), 기본 min(하드웨어 스레드, 8)
+//   --recipe     : 스펙 판정 / IPVS 균일도 설정을 읽을 Recipe (없으면 난수 판정, 균일도 미사용)
+//   --json       : 결과 파일 (없으면 표준 출력)
+//
+// 다중 스레드 변형:
+//   ctx_per_thread : 스레드마다 Zone 컨텍스트 - 공유 자원(메모리 대역폭, 할당기 등) 경합만 드러남
+//   shared_locked  : 컨텍스트 1개를 mutex로 보호 (기존 export 함수를 여러 스레드에서 부를 때의 조건) - 잠금 경합
+// 장비는 시뮬레이터 백엔드, 지연 0 (sim_timing 기본값)이므로 호출 자체의 CPU 비용만 측정
+// 예외: MTP_sweep은 장비 지연(SWEEP_TIMING)과 안정화 시간을 넣어 순차 / 파이프라인 스윕의 택트를 비교
+// index_*는 작업 폴더에 임시 보관 / 색인 파일을 만들어 측정 (끝나면 삭제)
+
+#include "pch.h"
+#include "ProcessColor.h"
+#include "ProcessCpu.h"
+#include "ProcessDirty.h"
+#include "ProcessFunctions.h"
+#include "ProcessHvi.h"
+#include "ProcessIndex.h"
+#include "ProcessJudge.h"
+#include "ProcessLut.h"
+#include "ProcessLutFit.h"
+#include "ProcessPipeline.h"
+#include "ProcessUniformity.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    typedef std::chrono::steady_clock clock_type;
+
+    struct bench_options {
+        int iterations = 20000;
+        int max_threads = 0;
+        std::string recipe;
+        std::string json;
+    };
+
+    struct bench_result {
+        std::string name;
+        std::string variant;
+        int threads;
+        int points;             // 호출당 포인트 / 계조 / 슬롯 수 (해당 없음: 0)
+        long long calls;
+        double p50_ns;
+        double p99_ns;
+        double mean_ns;
+        double max_ns;
+        double throughput;      // 전체 스레드 합계 호출 수 / 초
+        bool ok;
+    };
+
+    double elapsed_ns(clock_type::time_point a, clock_type::time_point b)
+    {
+        return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count();
+    }
+
+    // make(스레드 번호)가 만든 호출 함수(bool())를 스레드마다 iterations × batch번 실행
+    // 표본 = batch번 호출 시간 / batch (가벼운 호출은 batch로 시각 측정 비용을 나눔)
+    template <typename Factory>
+    bench_result run_bench(const std::string& name, const std::string& variant, int threads, int points,
+                           int iterations, int batch, Factory make)
+    {
+        std::vector<std::vector<double>> samples(threads);
+        std::atomic<int> ready(0);
+        std::atomic<bool> go(false);
+        std::atomic<bool> failed(false);
+        const int warmup = std::max(1, iterations / 10);
+
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                auto call = make(t);
+                std::vector<double>& s = samples[t];
+                s.reserve(iterations);
+                bool ok = true;
+                for (int i = 0; i < warmup; ++i) ok = call() && ok;
+
+                ready.fetch_add(1);
+                while (!go.load()) std::this_thread::yield();
+
+                for (int i = 0; i < iterations; ++i) {
+                    const clock_type::time_point a = clock_type::now();
+                    for (int b = 0; b < batch; ++b) ok = call() && ok;
+                    s.push_back(elapsed_ns(a, clock_type::now()) / batch);
+                }
+                if (!ok) failed.store(true);
+            });
+        }
+
+        while (ready.load() < threads) std::this_thread::yield();
+        const clock_type::time_point start = clock_type::now();
+        go.store(true);
+        for (std::thread& th : pool) th.join();
+        const double wall = elapsed_ns(start, clock_type::now());
+
+        std::vector<double> all;
+        all.reserve((size_t)threads * iterations);
+        for (const std::vector<double>& s : samples) all.insert(all.end(), s.begin(), s.end());
+        std::sort(all.begin(), all.end());
+
+        double sum = 0.0;
+        for (double v : all) sum += v;
+
+        bench_result r;
+        r.name = name;
+        r.variant = variant;
+        r.threads = threads;
+        r.points = points;
+        r.calls = (long long)threads * iterations * batch;
+        r.p50_ns = all[all.size() / 2];
+        r.p99_ns = all[std::min(all.size() - 1, all.size() * 99 / 100)];
+        r.mean_ns = sum / all.size();
+        r.max_ns = all.back();
+        r.throughput = wall > 0.0 ? r.calls / (wall * 1e-9) : 0.0;
+        r.ok = !failed.load();
+
+        std::fprintf(stderr, "%-22s %-15s threads=%-2d points=%-4d p50=%10.0f ns  p99=%10.0f ns  %12.0f calls/s%s\n",
+                     name.c_str(), variant.c_str(), threads, points, r.p50_ns, r.p99_ns, r.throughput,
+                     r.ok ? "" : "  (FAILED)");
+        return r;
+    }
+
+    // 호출 1회가 items개(채널, 셀 등)를 처리하는 측정을 항목당 시간 / 처리량으로 환산
+    bench_result per_item(bench_result r, int items)
+    {
+        r.p50_ns /= items;
+        r.p99_ns /= items;
+        r.mean_ns /= items;
+        r.max_ns /= items;
+        r.calls *= items;
+        r.throughput *= items;
+        std::fprintf(stderr, "%-22s %-15s per item (%d): p50=%10.1f ns\n", r.name.c_str(), r.variant.c_str(), items,
+                     r.p50_ns);
+        return r;
+    }
+
+    // 측정 준비가 끝난 Zone 컨텍스트 (시뮬레이터 PG / 측정기 연결)
+    struct bench_context {
+        process_context* ctx;
+        bool ok;
+
+        bench_context(int zone, const bench_options& opt)
+            : ctx(process_create_context(zone))
+            , ok(ctx != nullptr)
+        {
+            if (!ok) return;
+            ok = PGTurn_ctx(ctx, zone) && Meas_Turn_ctx(ctx, zone);
+            if (!opt.recipe.empty()) {
+                process_judge_load_ctx(ctx, opt.recipe.c_str());
+                process_uniformity_setup_ctx(ctx, opt.recipe.c_str());
+            }
+        }
+
+        ~bench_context()
+        {
+            process_destroy_context(ctx);
+        }
+
+        bench_context(const bench_context&) = delete;
+        bench_context& operator=(const bench_context&) = delete;
+    };
+
+    // 감마 2.2 패널의 계조별 휘도 (cal_lut 입력)
+    std::vector<LUT_Data> gamma_series(int count, unsigned int seed)
+    {
+        std::vector<LUT_Data> v;
+        const int max_index = 3000;
+        for (int i = 0; i < count; ++i) {
+            const int index = max_index - i * (max_index - 64) / std::max(1, count - 1);
+            const double noise = 1.0 + 0.002 * (double)((seed * 2654435761u + i * 40503u) % 1000 - 500) / 500.0;
+            LUT_Data d;
+            d.index = index;
+            d.voltage = 0.0;
+            d.luminance = 0.2 + 650.0 * std::pow(index / (double)max_index, 2.2) * noise;
+            v.push_back(d);
+        }
+        return v;
+    }
+
+    std::vector<int> thread_steps(int max_threads)
+    {
+        std::vector<int> steps;
+        for (int t = 1; t < max_threads; t *= 2) steps.push_back(t);
+        steps.push_back(max_threads);
+        return steps;
+    }
+
+    // ===== 벤치마크 묶음 =====
+
+    template <typename Call>
+    void per_thread_ctx(std::vector<bench_result>* out, const std::string& name, int threads, int points,
+                        int iterations, const bench_options& opt, Call call)
+    {
+        std::vector<std::unique_ptr<bench_context>> ctx;
+        std::vector<std::unique_ptr<struct output>> outs;
+        for (int t = 0; t < threads; ++t) {
+            ctx.emplace_back(new bench_context(t + 1, opt));
+            outs.emplace_back(new struct output());
+        }
+        out->push_back(run_bench(name, "ctx_per_thread", threads, points, iterations, 1, [&](int t) {
+            bench_context* c = ctx[t].get();
+            struct output* o = outs[t].get();
+            long long n = 0;
+            return [c, o, n, call]() mutable { return c->ok && call(c->ctx, o, n++); };
+        }));
+    }
+
+    template <typename Call>
+    void shared_locked(std::vector<bench_result>* out, const std::string& name, int threads, int points,
+                       int iterations, const bench_options& opt, Call call)
+    {
+        bench_context ctx(1, opt);
+        std::mutex lock;
+        std::vector<std::unique_ptr<struct output>> outs;
+        for (int t = 0; t < threads; ++t) outs.emplace_back(new struct output());
+
+        out->push_back(run_bench(name, "shared_locked", threads, points, iterations, 1, [&](int t) {
+            struct output* o = outs[t].get();
+            long long n = 0;
+            return [&ctx, &lock, o, n, call]() mutable {
+                std::lock_guard<std::mutex> guard(lock);
+                return ctx.ok && call(ctx.ctx, o, n++);
+            };
+        }));
+    }
+
+    void bench_calls(std::vector<bench_result>* out, const bench_options& opt)
+    {
+        const int n = opt.iterations;
+        const int heavy = std::max(10, n / 10);
+        const std::vector<int> steps = thread_steps(opt.max_threads);
+        const struct input cell = {};
+
+        // 기존 export 함수 (기본 컨텍스트, 단일 스레드)
+        {
+            static struct output o;
+            struct input in = cell;
+            out->push_back(run_bench("MTP_test", "export", 1, 7 * 17, n, 1, [&](int) {
+                return [&in]() { return MTP_test(&in, &o) == 1; };
+            }));
+        }
+
+        auto mtp = [cell](process_context* c, struct output* o, long long) { return MTP_test_ctx(c, &cell, o) == 1; };
+        for (int t : steps) per_thread_ctx(out, "MTP_test", t, 7 * 17, n, opt, mtp);
+        for (int t : steps) shared_locked(out, "MTP_test", t, 7 * 17, n, opt, mtp);
+
+        // IPVS: points개 포인트를 순서대로 (포인트마다 균일도 갱신)
+        for (int points : { 1, 5, 10 }) {
+            auto ipvs = [cell, points](process_context* c, struct output* o, long long k) {
+                struct input in = cell;
+                in.total_point = points;
+                in.cur_point = (int)(k % points);
+                return IPVS_test_ctx(c, &in, o) == 1;
+            };
+            per_thread_ctx(out, "IPVS_test", 1, points, n, opt, ipvs);
+        }
+        auto ipvs10 = [cell](process_context* c, struct output* o, long long k) {
+            struct input in = cell;
+            in.total_point = 10;
+            in.cur_point = (int)(k % 10);
+            return IPVS_test_ctx(c, &in, o) == 1;
+        };
+        for (int t : steps) shared_locked(out, "IPVS_test", t, 10, n, opt, ipvs10);
+
+        auto getdata = [](process_context* c, struct output* o, long long) { return Getdata_ctx(c, o); };
+        for (int t : steps) per_thread_ctx(out, "Getdata", t, 1, n, opt, getdata);
+        for (int t : steps) shared_locked(out, "Getdata", t, 1, n, opt, getdata);
+
+        // getLUTdata: cnt개 계조 스윕 + 적합
+        for (int cnt : { 4, 16, 64 }) {
+            auto lut = [cnt](process_context* c, struct output* o, long long k) {
+                const int rgb = (int)(k % 3);
+                return getLUTdata_ctx(c, rgb, 3000.0f, 3000.0f, 3000.0f, 2900 / cnt, cnt, o);
+            };
+            per_thread_ctx(out, "getLUTdata", 1, cnt, heavy, opt, lut);
+            if (cnt == 16) {
+                for (int t : steps) {
+                    if (t > 1) per_thread_ctx(out, "getLUTdata", t, cnt, heavy, opt, lut);
+                }
+            }
+        }
+
+        // cal_lut: 채널당 points개 측정점
+        for (int points : { 8, 32, 128, 512 }) {
+            std::vector<LUT_Data> series[3] = { gamma_series(points, 1), gamma_series(points, 2), gamma_series(points, 3) };
+            static struct output o;
+            out->push_back(run_bench("cal_lut", "single", 1, points, points >= 128 ? heavy : n, 1, [&](int) {
+                return [&series]() {
+                    cal_lut(series, &o);
+                    return o.lut[0].gamma > 0.0f;
+                };
+            }));
+        }
+    }
+
+    // 스펙 경계 근처에 흩어진 측정값 (NaN / 0 휘도 포함) - 판정 / 색 변환 입력
+    std::vector<struct output> random_outputs(int count, unsigned int seed)
+    {
+        std::vector<struct output> outs(count);
+        unsigned int state = seed;
+        auto next = [&state](float lo, float hi) {
+            state = state * 1664525u + 1013904223u;
+            return lo + (hi - lo) * (float)(state >> 8) / 16777216.0f;
+        };
+        auto fill = [&](struct pattern& p) {
+            p.x = next(-0.1f, 1.1f);
+            p.y = next(-0.1f, 1.1f);
+            p.u = p.v = 0.0f;
+            p.L = next(-50.0f, 1100.0f);
+            p.cur = next(-5.0f, 105.0f);
+            p.eff = next(-5.0f, 105.0f);
+            p.result = 0;
+            const float r = next(0.0f, 1.0f);
+            if (r < 0.02f) p.L = std::nanf("");
+            else if (r < 0.04f) p.y = 0.0f;
+        };
+        for (struct output& o : outs) {
+            std::memset(&o, 0, sizeof(o));
+            for (int w = 0; w < 7; ++w) {
+                for (int j = 0; j < 17; ++j) fill(o.data[w][j]);
+                for (int k = 0; k < 10; ++k) fill(o.IPVS_data[w][k]);
+                fill(o.measure[w]);
+            }
+        }
+        return outs;
+    }
+
+    // SIMD 수준별 변형 이름 (해당 수준을 지원하지 않으면 nullptr)
+    const char* simd_variant(int level)
+    {
+        static const char* const NAMES[3] = { "scalar", "sse2", "avx2" };
+        if (process_set_simd_limit(level) != level) return nullptr;
+        return NAMES[level];
+    }
+
+    // 계산 커널 (장비 호출 없음)
+    void bench_kernels(std::vector<bench_result>* out, const bench_options& opt)
+    {
+        const int n = opt.iterations;
+        const int heavy = std::max(10, n / 10);
+
+        // LUT 전체 모델 적합: 셀 1개(R/G/B 채널 각 30계조) 단일 적합 vs 256채널 일괄 적합의 채널당 시간
+        {
+            const int levels = 30;
+            const int lanes = 256;
+            std::vector<int> grid(levels);
+            for (int k = 0; k < levels; ++k) grid[k] = 100 + k * 100;
+
+            std::vector<float> lumi((size_t)lanes * levels);
+            for (int lane = 0; lane < lanes; ++lane) {
+                const double gamma = 1.9 + 0.6 * (lane % 17) / 16.0;
+                const double lmax = 300.0 + 5.0 * (lane % 41);
+                const double black = 0.05 + 0.01 * (lane % 7);
+                for (int k = 0; k < levels; ++k) {
+                    const double noise = 1.0 + 0.002 * (double)(((lane * 31 + k * 17) % 21) - 10) / 10.0;
+                    lumi[(size_t)lane * levels + k] =
+                        (float)((black + (lmax - black) * std::pow(grid[k] / 3000.0, gamma)) * noise);
+                }
+            }
+
+            std::vector<LUT_Data> cell[3];
+            for (int c = 0; c < 3; ++c) {
+                for (int k = 0; k < levels; ++k) {
+                    LUT_Data d;
+                    d.index = grid[k];
+                    d.voltage = grid[k];
+                    d.luminance = lumi[(size_t)c * levels + k];
+                    cell[c].push_back(d);
+                }
+            }
+
+            std::vector<lut_parameter> params(lanes);
+            out->push_back(run_bench("lut_fit", "scalar_cell", 1, levels, heavy, 1, [&](int) {
+                return [&cell, &params]() {
+                    bool ok = true;
+                    for (int c = 0; c < 3; ++c) ok = process_lut_fit(cell[c].data(), (int)cell[c].size(), &params[c]) && ok;
+                    return ok;
+                };
+            }));
+            out->push_back(per_item(run_bench("lut_fit", "batch_per_channel", 1, levels, std::max(3, heavy / 10), 1,
+                                              [&](int) {
+                                                  return [&grid, &lumi, &params]() {
+                                                      return process_lut_fit_batch(grid.data(), (int)grid.size(),
+                                                                                   lumi.data(), lanes,
+                                                                                   params.data()) == lanes;
+                                                  };
+                                              }),
+                                    lanes));
+        }
+
+        // 스펙 판정: 셀 1개의 MTP 119 + IPVS 70 슬롯 (SIMD 수준별)
+        {
+            std::vector<struct output> outs = random_outputs(64, 7);
+            bench_context c(1, opt);
+            process_judge_load_ctx(c.ctx, nullptr);
+            for (int level : { CPU_SIMD_SCALAR, CPU_SIMD_AVX2 }) {
+                const char* variant = simd_variant(level);
+                if (variant == nullptr) continue;
+                out->push_back(run_bench("judge_cell", variant, 1, 7 * 17 + 7 * 10, n, 8, [&](int) {
+                    size_t k = 0;
+                    return [&outs, &c, k]() mutable {
+                        struct output* o = &outs[k++ % outs.size()];
+                        judge_counts counts;
+                        return process_judge_mtp_ctx(c.ctx, o, &counts) && process_judge_ipvs_ctx(c.ctx, o, &counts);
+                    };
+                }));
+            }
+            process_set_simd_limit(-1);
+        }
+
+        // 색 변환: output 전체(196 pattern)의 u'v' + XYZ + Robertson CCT + Duv (SIMD 수준별, output당 시간)
+        {
+            const int count = 16;
+            std::vector<struct output> outs = random_outputs(count, 13);
+            std::vector<struct output_color> ext(count);
+            const int flags = COLOR_UV | COLOR_XYZ | COLOR_CCT_ROBERTSON | COLOR_DUV;
+            for (int level : { CPU_SIMD_SCALAR, CPU_SIMD_SSE2, CPU_SIMD_AVX2 }) {
+                const char* variant = simd_variant(level);
+                if (variant == nullptr) continue;
+                out->push_back(per_item(run_bench("color_output", variant, 1, 7 * 17 + 7 * 10 + 7, heavy, 1,
+                                                  [&](int) {
+                                                      return [&outs, &ext, flags]() {
+                                                          return process_color_output(outs.data(), count, ext.data(),
+                                                                                      flags) == count * 196;
+                                                      };
+                                                  }),
+                                        count));
+            }
+            process_set_simd_limit(-1);
+        }
+
+        // HVI 판정: 16개 시퀀스 평면 집계 (Zone 판정만 / 슬롯별 최악 코드 포함)
+        {
+            const int sequences = 16;
+            std::vector<struct output> outs = random_outputs(sequences, 11);
+            std::vector<result_planes> planes(sequences);
+            bench_context c(1, opt);
+            process_judge_load_ctx(c.ctx, nullptr);
+            bool ok = true;
+            for (int i = 0; i < sequences; ++i) {
+                judge_counts counts;
+                ok = process_judge_mtp_ctx(c.ctx, &outs[i], &counts) && ok;
+                ok = process_pack_results(&outs[i], HVI_KIND_MTP, &planes[i]) && ok;
+            }
+            std::vector<int> worst(7 * 17);
+            for (int with_worst = 0; with_worst < 2; ++with_worst) {
+                int* w = with_worst ? worst.data() : nullptr;
+                out->push_back(run_bench("hvi_aggregate", with_worst ? "counts_worst" : "counts", 1, sequences, n, 32,
+                                         [&](int) {
+                                             return [&planes, w, ok]() {
+                                                 judge_counts counts;
+                                                 return ok && process_hvi_aggregate(planes.data(), (int)planes.size(),
+                                                                                    0, 0, &counts, w);
+                                             };
+                                         }));
+            }
+        }
+    }
+
+    // MTP 17패턴 스윕 택트: 순차 vs 파이프라인 (전송/후처리와 다음 패턴 전환 + 안정화 병행)
+    // 패턴당 순차 = PG + 안정화 + 적분 + 전송 = 14ms, 파이프라인 = 적분 + max(전송, PG + 안정화) = 10ms
+    void bench_sweep(std::vector<bench_result>* out, const bench_options& opt)
+    {
+        const struct sim_timing SWEEP_TIMING = { 2.0f, 5.0f, 4.0f };   // PG 명령 / 적분 / 전송 (ms)
+        const float SETTLE_MS = 3.0f;
+        const int iterations = std::max(3, opt.iterations / 2000);
+
+        double p50[2] = { 0.0, 0.0 };
+        for (int pipelined = 0; pipelined < 2; ++pipelined) {
+            bench_context c(1, opt);
+            process_set_sim_timing(c.ctx, &SWEEP_TIMING);
+
+            struct mtp_sweep_config cfg;
+            mtp_sweep_default_config(nullptr, 0, &cfg);
+            for (int j = 0; j < 17; ++j) cfg.settle_ms[j] = SETTLE_MS;
+            cfg.pipelined = pipelined;
+
+            static struct output o;
+            out->push_back(run_bench("MTP_sweep", pipelined ? "pipelined" : "serial", 1, 17, iterations, 1,
+                                     [&](int) {
+                                         return [&c, &cfg]() {
+                                             return c.ok && MTP_sweep_ctx(c.ctx, &cfg, &o, nullptr) == 1;
+                                         };
+                                     }));
+            p50[pipelined] = out->back().p50_ns;
+        }
+        std::fprintf(stderr, "MTP_sweep tact: serial %.1f ms, pipelined %.1f ms (-%.1f%%)\n", p50[0] * 1e-6,
+                     p50[1] * 1e-6, p50[0] > 0.0 ? 100.0 * (1.0 - p50[1] / p50[0]) : 0.0);
+    }
+
+    // 결과 색인: 보관 파일 20000행의 색인 재구성 (행 정보 영역만 읽음) / CELL_ID 조회 (위치만, 보관 파일 읽기 없음)
+    // 작업 폴더에 임시 보관 / 색인 파일을 만들고 끝나면 삭제
+    void bench_index(std::vector<bench_result>* out, const bench_options& opt)
+    {
+        const int rows = 20000;
+        const char* archive_path = "process_bench_index.oxa";
+        const char* index_path = "process_bench_index.oxi";
+        std::remove(archive_path);
+        std::remove(index_path);
+
+        process_archive* archive = process_archive_open(archive_path, 0);
+        process_index* index = process_index_open(index_path);
+        const int file_id = process_index_add_archive(index, archive_path);
+        bool ok = archive != nullptr && index != nullptr && file_id >= 0;
+
+        std::unique_ptr<struct output> o(new struct output());
+        struct input in;
+        std::memset(&in, 0, sizeof(in));
+        for (int r = 0; r < rows && ok; ++r) {
+            std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "CELL%06d", r);
+            std::snprintf(in.INNER_ID, sizeof(in.INNER_ID), "IN%06d", r);
+            ok = process_index_append(index, file_id, archive, &in, o.get(), 1, -1, 0, 0, 0) == r;
+        }
+
+        // 준비 실패 시에도 결과에 실패(ok: false)로 남김
+        out->push_back(run_bench("index_rebuild", "rows_20000", 1, rows, std::max(3, opt.iterations / 2000), 1,
+                                 [&](int) {
+                                     return [index, ok]() { return ok && process_index_rebuild(index) == 2 * rows; };
+                                 }));
+        out->push_back(run_bench("index_lookup", "cell_id", 1, rows, opt.iterations, 8, [&](int) {
+            unsigned int k = 0;
+            return [index, ok, k]() mutable {
+                char id[32];
+                std::snprintf(id, sizeof(id), "CELL%06d", (int)((k++ * 7919u) % rows));
+                index_location loc;
+                return ok && process_index_lookup(index, id, INDEX_KEY_CELL, &loc, 1) == 1;
+            };
+        }));
+
+        process_index_close(index);
+        process_archive_close(archive);
+        std::remove(archive_path);
+        std::remove(index_path);
+    }
+
+    // 구조체 복사 비용 (C# 마샬링 / SharedOutput 갱신 단위)
+    void bench_copies(std::vector<bench_result>* out, const bench_options& opt)
+    {
+        const int n = opt.iterations;
+        const int batch = 32;
+
+        struct copy_buffers {
+            struct output src;
+            struct output dst;
+            struct input in_src;
+            struct input in_dst;
+        };
+        std::vector<std::unique_ptr<copy_buffers>> bufs;
+        for (int t = 0; t < opt.max_threads; ++t) bufs.emplace_back(new copy_buffers());
+
+        for (int t : thread_steps(opt.max_threads)) {
+            out->push_back(run_bench("copy_output", "full", t, (int)sizeof(struct output), n, batch, [&](int i) {
+                copy_buffers* b = bufs[i].get();
+                return [b]() {
+                    b->dst = b->src;
+                    return true;
+                };
+            }));
+        }
+
+        out->push_back(run_bench("copy_input", "full", 1, (int)sizeof(struct input), n, batch, [&](int) {
+            copy_buffers* b = bufs[0].get();
+            return [b]() {
+                b->in_dst = b->in_src;
+                return true;
+            };
+        }));
+
+        // 변경 영역만 복사 (process_copy_dirty) - 패턴 1개 / WAD 1행(17) / IPVS 1포인트(7) / 전체
+        struct dirty_case {
+            const char* variant;
+            struct output_dirty mask;
+        };
+        std::vector<dirty_case> cases(4);
+        std::memset(cases.data(), 0, sizeof(dirty_case) * cases.size());
+        cases[0].variant = "dirty_1_pattern";
+        cases[0].mask.data[0] = 1u;
+        cases[1].variant = "dirty_wad_row";
+        cases[1].mask.data[3] = 0x1FFFFu;
+        cases[2].variant = "dirty_ipvs_point";
+        for (int w = 0; w < 7; ++w) cases[2].mask.IPVS_data[w] = 1u << 4;
+        cases[3].variant = "dirty_all";
+        for (int w = 0; w < 7; ++w) {
+            cases[3].mask.data[w] = 0x1FFFFu;
+            cases[3].mask.IPVS_data[w] = 0x3FFu;
+        }
+        cases[3].mask.measure = 0x7Fu;
+        cases[3].mask.lut = 0x7u;
+
+        for (const dirty_case& c : cases) {
+            const struct output_dirty* mask = &c.mask;
+            out->push_back(run_bench("copy_output", c.variant, 1, process_dirty_bytes(mask), n, batch, [&](int) {
+                copy_buffers* b = bufs[0].get();
+                return [b, mask]() { return process_copy_dirty(&b->src, &b->dst, mask) >= 0; };
+            }));
+        }
+    }
+
+    // ===== JSON 출력 =====
+
+    void json_string(std::string* s, const std::string& v)
+    {
+        *s += '"';
+        for (char c : v) {
+            if (c == '"' || c == '\\') *s += '\\';
+            *s += c;
+        }
+        *s += '"';
+    }
+
+    std::string to_json(const std::vector<bench_result>& results, const bench_options& opt)
+    {
+        char buf[512];
+        std::string s = "{\n";
+
+#if defined(__clang__)
+        std::snprintf(buf, sizeof(buf), "clang %s", __clang_version__);
+#elif defined(__GNUC__)
+        std::snprintf(buf, sizeof(buf), "gcc %s", __VERSION__);
+#elif defined(_MSC_VER)
+        std::snprintf(buf, sizeof(buf), "msvc %d", _MSC_VER);
+#else
+        std::snprintf(buf, sizeof(buf), "unknown");
+#endif
+        s += "  \"schema\": 1,\n  \"compiler\": ";
+        json_string(&s, buf);
+        std::snprintf(buf, sizeof(buf),
+                      ",\n  \"simd_level\": %d,\n  \"hardware_threads\": %u,\n  \"iterations\": %d,\n  \"recipe\": ",
+                      cpu_simd_level(), std::thread::hardware_concurrency(), opt.iterations);
+        s += buf;
+        json_string(&s, opt.recipe);
+
+        std::snprintf(buf, sizeof(buf),
+                      ",\n  \"struct_sizes\": { \"input\": %u, \"output\": %u, \"pattern\": %u, "
+                      "\"lut_parameter\": %u, \"output_dirty\": %u },\n  \"results\": [\n",
+                      (unsigned)sizeof(struct input), (unsigned)sizeof(struct output), (unsigned)sizeof(struct pattern),
+                      (unsigned)sizeof(struct lut_parameter), (unsigned)sizeof(struct output_dirty));
+        s += buf;
+
+        for (size_t i = 0; i < results.size(); ++i) {
+            const bench_result& r = results[i];
+            s += "    { \"name\": ";
+            json_string(&s, r.name);
+            s += ", \"variant\": ";
+            json_string(&s, r.variant);
+            std::snprintf(buf, sizeof(buf),
+                          ", \"threads\": %d, \"points\": %d, \"calls\": %lld, \"p50_ns\": %.1f, \"p99_ns\": %.1f, "
+                          "\"mean_ns\": %.1f, \"max_ns\": %.1f, \"throughput_per_s\": %.1f, \"ok\": %s }%s\n",
+                          r.threads, r.points, r.calls, r.p50_ns, r.p99_ns, r.mean_ns, r.max_ns, r.throughput,
+                          r.ok ? "true" : "false", i + 1 < results.size() ? "," : "");
+            s += buf;
+        }
+        s += "  ]\n}\n";
+        return s;
+    }
+
+    bool parse_options(int argc, char** argv, bench_options* opt)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (i + 1 >= argc) return false;
+            const char* value = argv[++i];
+            if (arg == "--iterations") opt->iterations = std::atoi(value);
+            else if (arg == "--threads") opt->max_threads = std::atoi(value);
+            else if (arg == "--recipe") opt->recipe = value;
+            else if (arg == "--json") opt->json = value;
+            else return false;
+        }
+        if (opt->iterations <= 0) return false;
+        if (opt->max_threads <= 0) {
+            const int hw = (int)std::thread::hardware_concurrency();
+            opt->max_threads = std::max(1, std::min(hw, 8));
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bench_options opt;
+    if (!parse_options(argc, argv, &opt)) {
+        std::fprintf(stderr, "usage: %s [--iterations N] [--threads N] [--recipe OptiX.ini] [--json result.json]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    std::vector<bench_result> results;
+    bench_calls(&results, opt);
+    bench_copies(&results, opt);
+    bench_kernels(&results, opt);
+    bench_sweep(&results, opt);
+    bench_index(&results, opt);
+
+    const std::string json = to_json(results, opt);
+    if (opt.json.empty()) {
+        std::fputs(json.c_str(), stdout);
+    }
+    else {
+        FILE* fp = std::fopen(opt.json.c_str(), "wb");
+        if (fp == nullptr) {
+            std::fprintf(stderr, "cannot write %s\n", opt.json.c_str());
+            return 1;
+        }
+        std::fputs(json.c_str(), fp);
+        std::fclose(fp);
+    }
+
+    bool ok = true;
+    for (const bench_result& r : results) ok = ok && r.ok;
+    return ok ? 0 : 1;
+}
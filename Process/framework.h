@@ -1,5 +1,25 @@
 ﻿#pragma once
 
+//26.10.16 - CMake 이식용 정적 라이브러리 빌드 (PROCESS_PORTABLE) 시 MFC 없이 최소 정의만 사용
+#ifdef PROCESS_PORTABLE
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>        // OutputDebugStringA
+#else
+#include <cstdio>
+#define __declspec(x)                                   // 정적 라이브러리: export 표시 불필요
+#define sprintf_s snprintf
+inline void OutputDebugStringA(const char*) {}          // 디버그 출력 없음
+#endif
+
+#else
+
 #ifndef VC_EXTRALEAN
 #define VC_EXTRALEAN            // 거의 사용되지 않는 내용은 Windows 헤더에서 제외합니다.
 #endif
@@ -32,4 +52,4 @@
 #include <afxcmn.h>                     // Windows 공용 컨트롤에 대한 MFC 지원입니다.
 #endif // _AFX_NO_AFXCMN_SUPPORT
 
-
+#endif // PROCESS_PORTABLE
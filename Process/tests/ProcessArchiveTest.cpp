@@ -0,0 +1,117 @@
+// ProcessArchiveTest.cpp : 결과 보관 파일 확장 실패 테스트 (CMake process_archive_test, POSIX 전용)
+// RLIMIT_FSIZE로 파일 크기를 현재 크기에 묶어 chunk 확장(ftruncate)을 실패시키고
+//   - append가 -1을 반환하고 핸들이 매핑을 잃지 않는지 (기존 행 읽기 / 열 참조 / flush)
+//   - 제한을 풀면 같은 핸들로 다시 추가되는지
+// 를 확인
+
+#include "pch.h"
+#include "ProcessArchive.h"
+#include "ProcessTest.h"
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+    const int CHUNK_ROWS = 16;
+
+    int64_t append_cell(process_archive* archive, const struct output* out, int n)
+    {
+        struct input in;
+        std::memset(&in, 0, sizeof(in));
+        std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "CELL%04d", n);
+        in.total_point = 1;
+        return process_archive_append(archive, &in, out, 0, n, 0, n, n + 1);
+    }
+
+    bool check_row(process_archive* archive, int n)
+    {
+        archive_row info;
+        char expected[32];
+        std::snprintf(expected, sizeof(expected), "CELL%04d", n);
+        return process_archive_read_row(archive, n, &info, nullptr) && std::strcmp(info.CELL_ID, expected) == 0 &&
+               info.sequence == n;
+    }
+
+    int64_t file_size(const std::string& path)
+    {
+        struct stat st;
+        return stat(path.c_str(), &st) == 0 ? (int64_t)st.st_size : -1;
+    }
+
+    void test_grow_failure()
+    {
+        const std::string path = "process_archive_test_" + std::to_string((long long)getpid()) + ".oxa";
+        std::remove(path.c_str());
+
+        process_archive* archive = process_archive_open(path.c_str(), CHUNK_ROWS);
+        TEST_CHECK(archive != nullptr);
+        if (archive == nullptr) return;
+
+        std::unique_ptr<struct output> out(new struct output());
+        std::memset(out.get(), 0, sizeof(struct output));
+        const int column = process_archive_column(ARCHIVE_AREA_DATA, 0, 0, ARCHIVE_FIELD_L);
+
+        // 첫 행으로 chunk를 할당한 뒤 파일 크기에 제한을 걸고 확장이 필요해질 때까지 추가
+        // (SIGXFSZ 무시 → ftruncate가 EFBIG로 실패)
+        TEST_CHECK(append_cell(archive, out.get(), 0) == 0);
+        struct rlimit saved;
+        TEST_CHECK(getrlimit(RLIMIT_FSIZE, &saved) == 0);
+        signal(SIGXFSZ, SIG_IGN);
+        struct rlimit limited = saved;
+        limited.rlim_cur = (rlim_t)file_size(path);
+        TEST_CHECK(setrlimit(RLIMIT_FSIZE, &limited) == 0);
+
+        int rows = 1;
+        for (; rows < 1000; ++rows) {
+            out->data[0][0].L = (float)rows;
+            if (append_cell(archive, out.get(), rows) < 0) break;
+        }
+        TEST_CHECK(rows > CHUNK_ROWS && rows < 1000);
+        std::fprintf(stderr, "grow failed after %d rows\n", rows);
+
+        // 실패 후에도 기존 행은 그대로
+        TEST_CHECK(process_archive_rows(archive) == rows);
+        TEST_CHECK(check_row(archive, 0) && check_row(archive, rows - 1));
+        const void* values = nullptr;
+        TEST_CHECK(process_archive_chunk(archive, 0, column, &values) == CHUNK_ROWS);
+        TEST_CHECK(values != nullptr && static_cast<const float*>(values)[0] == 0.0f);
+        TEST_CHECK(process_archive_flush(archive));
+        TEST_CHECK(append_cell(archive, out.get(), rows) == -1);
+
+        // 제한 해제 후 같은 핸들로 이어서 추가
+        TEST_CHECK(setrlimit(RLIMIT_FSIZE, &saved) == 0);
+        for (int i = 0; i < 3 * CHUNK_ROWS; ++i) {
+            out->data[0][0].L = (float)(rows + i);
+            TEST_CHECK(append_cell(archive, out.get(), rows + i) == rows + i);
+        }
+        const int total = rows + 3 * CHUNK_ROWS;
+        TEST_CHECK(process_archive_rows(archive) == total);
+
+        float last = -1.0f;
+        TEST_CHECK(process_archive_read_column(archive, column, total - 1, 1, &last) == 1 && last == (float)(total - 1));
+        process_archive_close(archive);
+
+        // 다시 열어도 모든 행이 남아 있음
+        archive = process_archive_open_read(path.c_str());
+        TEST_CHECK(archive != nullptr);
+        if (archive != nullptr) {
+            TEST_CHECK(process_archive_rows(archive) == total);
+            TEST_CHECK(check_row(archive, 0) && check_row(archive, rows) && check_row(archive, total - 1));
+            process_archive_close(archive);
+        }
+        std::remove(path.c_str());
+    }
+}
+
+int main()
+{
+    test_grow_failure();
+    return process_test_result("process_archive_test");
+}
@@ -0,0 +1,176 @@
+// ProcessArenaTest.cpp : 공유 메모리 결과 영역(seqlock) 테스트 (CMake process_arena_test)
+// 쓰는 쪽이 슬롯 전체를 세대 번호 바이트로 채워 발행하고, 읽는 쪽이 동시에 읽어
+// 찢어진(서로 다른 세대가 섞인) 스냅샷이 한 번도 보이지 않는지 확인
+//   - 스레드: 같은 핸들을 다른 스레드에서 기록 / 읽기
+//   - 프로세스 (POSIX): fork한 자식이 process_arena_open으로 연 shm 영역에 기록, 부모가 읽기
+
+#include "pch.h"
+#include "ProcessResultArena.h"
+#include "ProcessTest.h"
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+    const int ZONES = 2;
+    const int SEQUENCES = 3;
+    const int GENERATIONS = 20000;
+
+    // 세대 g의 결과: output 전체를 (g & 0xFF)로 채움, 상태 코드 = g
+    // 기록 중간 / 발행 후에 양보 - 단일 코어에서도 읽는 쪽이 기록 중인 슬롯과 발행된 슬롯을 모두 만나도록 함
+    void write_generations(process_arena* arena, int zone, int sequence)
+    {
+        const size_t half = sizeof(struct output) / 2;
+        for (int g = 1; g <= GENERATIONS; ++g) {
+            struct output* out = process_arena_begin_write(arena, zone, sequence);
+            if (out == nullptr) return;
+            unsigned char* p = reinterpret_cast<unsigned char*>(out);
+            std::memset(p, g & 0xFF, half);
+            std::this_thread::yield();
+            std::memset(p + half, g & 0xFF, sizeof(struct output) - half);
+            process_arena_end_write(arena, zone, sequence, g);
+            if (g % 4 == 0) std::this_thread::yield();
+        }
+    }
+
+    bool uniform(const struct output& o)
+    {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(&o);
+        for (size_t i = 1; i < sizeof(o); ++i) {
+            if (p[i] != p[0]) return false;
+        }
+        return true;
+    }
+
+    // 마지막 세대(seq = 2 × GENERATIONS)가 보일 때까지 읽으며 스냅샷 일관성 검사 (쓰는 쪽 실패 대비 30초 제한)
+    void read_until_done(process_arena* arena, int zone, int sequence, int* torn, int* reads)
+    {
+        const uint32_t last = 2u * GENERATIONS;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        std::vector<struct output> buf(1);
+        uint32_t prev = 0;
+        for (;;) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                TEST_CHECK(!"writer did not publish the last generation");
+                break;
+            }
+            const uint32_t seq = process_arena_read(arena, zone, sequence, &buf[0]);
+            if (seq != 0) {
+                ++*reads;
+                // seq = 2g → 바이트 = g & 0xFF, 발행 순번은 줄어들지 않음
+                if (!uniform(buf[0]) || ((const unsigned char*)&buf[0])[0] != ((seq / 2) & 0xFF) || seq < prev) {
+                    ++*torn;
+                }
+                prev = seq;
+                if (seq == last) break;
+            }
+
+            // 직접 참조 경로: view 후 validate가 true면 그동안 변경이 없었어야 함
+            uint32_t view_seq = 0;
+            const struct output* view = process_arena_view(arena, zone, sequence, &view_seq);
+            if (view != nullptr) {
+                std::memcpy(&buf[0], view, sizeof(struct output));
+                if (process_arena_validate(arena, zone, sequence, view_seq) && view_seq != 0 && !uniform(buf[0])) {
+                    ++*torn;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void test_threads()
+    {
+        const std::string name = "optix_arena_test_t";
+        process_arena_remove(name.c_str());
+        process_arena* arena = process_arena_create(name.c_str(), ZONES, SEQUENCES);
+        TEST_CHECK(arena != nullptr);
+        if (arena == nullptr) return;
+
+        // 사용 중인 이름은 다시 생성할 수 없음
+        process_arena* dup = process_arena_create(name.c_str(), ZONES, SEQUENCES);
+        TEST_CHECK(dup == nullptr);
+        process_arena_destroy(dup);
+
+        // 발행 전 슬롯은 0
+        struct output tmp;
+        TEST_CHECK(process_arena_read(arena, 1, 2, &tmp) == 0);
+        TEST_CHECK(process_arena_begin_write(arena, ZONES, 0) == nullptr);
+
+        int torn = 0;
+        int reads = 0;
+        std::thread writer(write_generations, arena, 1, 2);
+        read_until_done(arena, 1, 2, &torn, &reads);
+        writer.join();
+
+        TEST_CHECK(torn == 0);
+        TEST_CHECK(reads > 0);
+        std::fprintf(stderr, "threads: %d reads, %d torn\n", reads, torn);
+
+        process_arena_destroy(arena);
+
+        // 생성한 쪽이 해제하면 이름도 제거되어 다시 생성 가능
+        arena = process_arena_create(name.c_str(), ZONES, SEQUENCES);
+        TEST_CHECK(arena != nullptr);
+        process_arena_destroy(arena);
+    }
+
+#ifndef _WIN32
+    void test_processes()
+    {
+        const std::string name = "optix_arena_test_p" + std::to_string((long long)getpid());
+        process_arena_remove(name.c_str());
+        process_arena* arena = process_arena_create(name.c_str(), ZONES, SEQUENCES);
+        TEST_CHECK(arena != nullptr);
+        if (arena == nullptr) return;
+
+        const pid_t child = fork();
+        if (child == 0) {
+            // 자식: 이름으로 열어 기록 (생성자가 아니므로 해제 시 이름을 지우지 않음)
+            process_arena* writer = process_arena_open(name.c_str());
+            if (writer == nullptr) _exit(3);
+            write_generations(writer, 0, 1);
+            process_arena_destroy(writer);
+            _exit(0);
+        }
+        TEST_CHECK(child > 0);
+        if (child <= 0) {
+            process_arena_destroy(arena);
+            return;
+        }
+
+        int torn = 0;
+        int reads = 0;
+        read_until_done(arena, 0, 1, &torn, &reads);
+
+        int status = 0;
+        waitpid(child, &status, 0);
+        TEST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        TEST_CHECK(torn == 0);
+
+        struct output last;
+        TEST_CHECK(process_arena_read(arena, 0, 1, &last) == 2u * GENERATIONS);
+        TEST_CHECK(uniform(last) && ((const unsigned char*)&last)[0] == (GENERATIONS & 0xFF));
+        std::fprintf(stderr, "processes: %d reads, %d torn\n", reads, torn);
+
+        process_arena_destroy(arena);
+        TEST_CHECK(process_arena_open(name.c_str()) == nullptr);
+    }
+#endif
+}
+
+int main()
+{
+#ifndef _WIN32
+    test_processes();   // fork는 스레드를 만들기 전에 실행
+#endif
+    test_threads();
+    return process_test_result("process_arena_test");
+}
@@ -0,0 +1,129 @@
+// ProcessColorTest.cpp : 색 변환 SIMD 경로 간 결과 일치 테스트 (CMake process_color_test)
+// process_set_simd_limit로 스칼라 / SSE2 / AVX2 경로를 강제하여
+//   - struct output 전체(process_color_output, 196개 - 8의 배수가 아닌 꼬리 포함)
+//   - 길이 1~23의 pattern 배열(process_color_convert, 4 / 8개 단위 뒤 꼬리)
+// 의 u'v' / XYZ / CCT / Duv 결과가 스칼라 경로와 비트 단위로 같은지 확인
+// 입력에는 y = 0, x = y = 0, L = 0, 음수 등 분모가 0이 되거나 Robertson 범위를 벗어나는 셀을 섞음
+
+#include "pch.h"
+#include "ProcessColor.h"
+#include "ProcessCpu.h"
+#include "ProcessTest.h"
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+    const int OUTPUTS = 3;
+    const int FLAGS[] = {
+        COLOR_UV,
+        COLOR_UV | COLOR_XYZ | COLOR_CCT_MCCAMY,
+        COLOR_UV | COLOR_XYZ | COLOR_CCT_ROBERTSON | COLOR_DUV,
+        COLOR_XYZ | COLOR_DUV,
+    };
+
+    struct lcg {
+        unsigned int state;
+        explicit lcg(unsigned int seed) : state(seed) {}
+        float uniform()
+        {
+            state = state * 1664525u + 1013904223u;
+            return (float)(state >> 8) / 16777216.0f;
+        }
+    };
+
+    // i번째 셀 색좌표 - 대부분 흑체 궤적 근처, 일부는 특이값
+    void fill_pattern(struct pattern* p, int i, lcg* rng)
+    {
+        std::memset(p, 0, sizeof(*p));
+        p->x = 0.25f + 0.25f * rng->uniform();
+        p->y = 0.25f + 0.2f * rng->uniform();
+        p->L = 500.0f * rng->uniform();
+        p->result = i % 3;
+
+        switch (i % 11) {
+        case 3: p->y = 0.0f; break;                         // y = 0 (XYZ 분모 0)
+        case 5: p->x = 0.0f; p->y = 0.0f; break;            // x = y = 0
+        case 7: p->L = 0.0f; p->y = 0.0f; break;            // 0 × inf
+        case 9: p->x = 0.7f; p->y = 0.1f; break;            // Robertson 범위 밖
+        case 10: p->x = -0.1f; p->y = 0.1858f; break;       // McCamy 분모 0
+        default: break;
+        }
+    }
+
+    void fill_output(struct output* out, lcg* rng)
+    {
+        struct pattern* p = &out->data[0][0];
+        for (int i = 0; i < 7 * 17 + 7 * 10 + 7; ++i) fill_pattern(&p[i], i, rng);
+    }
+
+    // level 경로로 outputs 전체 변환 (원본은 그대로 두고 복사본에 기록)
+    void convert_outputs(int level, int flags, const std::vector<struct output>& src, std::vector<struct output>* dst,
+                         std::vector<struct output_color>* ext)
+    {
+        process_set_simd_limit(level);
+        *dst = src;
+        std::memset(ext->data(), 0, sizeof(struct output_color) * ext->size());
+        TEST_CHECK(process_color_output(dst->data(), (int)dst->size(), ext->data(), flags) ==
+                   (int)dst->size() * (7 * 17 + 7 * 10 + 7));
+    }
+
+    void test_output(int level)
+    {
+        lcg rng(17u);
+        std::vector<struct output> src(OUTPUTS);
+        for (struct output& out : src) fill_output(&out, &rng);
+
+        for (int flags : FLAGS) {
+            std::vector<struct output> ref, got;
+            std::vector<struct output_color> ref_ext(OUTPUTS), got_ext(OUTPUTS);
+            convert_outputs(CPU_SIMD_SCALAR, flags, src, &ref, &ref_ext);
+            convert_outputs(level, flags, src, &got, &got_ext);
+
+            TEST_CHECK(std::memcmp(ref.data(), got.data(), sizeof(struct output) * OUTPUTS) == 0);
+            TEST_CHECK(std::memcmp(ref_ext.data(), got_ext.data(), sizeof(struct output_color) * OUTPUTS) == 0);
+        }
+    }
+
+    void test_tails(int level)
+    {
+        lcg rng(23u);
+        for (int n = 1; n < 24; ++n) {
+            std::vector<struct pattern> src(n);
+            for (int i = 0; i < n; ++i) fill_pattern(&src[i], i + n, &rng);
+
+            for (int flags : FLAGS) {
+                std::vector<struct pattern> ref = src, got = src;
+                std::vector<struct color_ext> ref_ext(n), got_ext(n);
+
+                process_set_simd_limit(CPU_SIMD_SCALAR);
+                TEST_CHECK(process_color_convert(ref.data(), n, ref_ext.data(), flags) == n);
+                process_set_simd_limit(level);
+                TEST_CHECK(process_color_convert(got.data(), n, got_ext.data(), flags) == n);
+
+                TEST_CHECK(std::memcmp(ref.data(), got.data(), sizeof(struct pattern) * n) == 0);
+                TEST_CHECK(std::memcmp(ref_ext.data(), got_ext.data(), sizeof(struct color_ext) * n) == 0);
+            }
+        }
+    }
+}
+
+int main()
+{
+    TEST_CHECK(process_set_simd_limit(CPU_SIMD_SCALAR) == CPU_SIMD_SCALAR);
+
+    // CPU가 지원하는 수준까지만 비교 (지원하지 않는 수준은 낮은 수준으로 제한됨)
+    for (int level = CPU_SIMD_SSE2; level <= CPU_SIMD_AVX2; ++level) {
+        if (process_set_simd_limit(level) != level) {
+            std::fprintf(stderr, "SIMD level %d not available - skipped\n", level);
+            continue;
+        }
+        test_output(level);
+        test_tails(level);
+    }
+
+    process_set_simd_limit(-1);
+    return process_test_result("process_color_test");
+}
@@ -0,0 +1,105 @@
+// ProcessDirtyTest.cpp : 셀별 변경 영역(*_batch_dirty) 테스트 (CMake process_dirty_test)
+// 컨텍스트 누적 영역은 모든 output의 합집합이므로
+//   - 병렬 배치에서 masks[i]가 outs[i]에 기록한 포인트만 가리키는지
+//   - 컨텍스트 누적 영역(process_take_dirty)은 기존과 같이 전체 합집합인지
+//   - 기본 컨텍스트를 여러 Zone이 함께 써도 Zone별 masks에 다른 Zone의 기록이 섞이지 않는지
+// 를 확인
+
+#include "pch.h"
+#include "ProcessBatch.h"
+#include "ProcessDirty.h"
+#include "ProcessTest.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int CELLS = 40;
+    const int ZONES = 4;
+
+    // IPVS 포인트 1개만 기록된 영역인지
+    bool only_point(const struct output_dirty& mask, int point)
+    {
+        for (int w = 0; w < 7; ++w) {
+            if (mask.data[w] != 0 || mask.IPVS_data[w] != (1u << point)) return false;
+        }
+        return mask.measure == 0 && mask.lut == 0;
+    }
+
+    void test_batch_masks()
+    {
+        process_context* ctx = process_create_context(1);
+        TEST_CHECK(ctx != nullptr);
+        if (ctx == nullptr) return;
+
+        std::vector<struct input> ins(CELLS);
+        std::vector<struct output> outs(CELLS);
+        std::vector<struct output_dirty> masks(CELLS);
+        std::memset(ins.data(), 0, sizeof(struct input) * CELLS);
+        for (int i = 0; i < CELLS; ++i) {
+            std::snprintf(ins[i].CELL_ID, sizeof(ins[i].CELL_ID), "CELL%02d", i);
+            ins[i].total_point = 10;
+            ins[i].cur_point = i % 10;
+        }
+
+        TEST_CHECK(IPVS_test_batch_dirty_ctx(ctx, ins.data(), outs.data(), CELLS, nullptr, 4, masks.data()) == CELLS);
+        for (int i = 0; i < CELLS; ++i) {
+            TEST_CHECK(only_point(masks[i], i % 10));
+        }
+
+        // 컨텍스트 누적은 모든 셀의 합집합 (10개 포인트)
+        struct output_dirty all;
+        TEST_CHECK(process_take_dirty(ctx, &all) == 7 * 10 * (int)sizeof(struct pattern));
+        TEST_CHECK(all.IPVS_data[0] == 0x3FFu && all.IPVS_data[6] == 0x3FFu);
+
+        // MTP 셀별 영역은 data 전체 + 이전 누적 유지
+        TEST_CHECK(MTP_test_batch_dirty_ctx(ctx, ins.data(), outs.data(), 2, nullptr, 1, masks.data()) == 2);
+        TEST_CHECK(masks[1].data[3] == 0x1FFFFu && masks[1].IPVS_data[3] == 0);
+        TEST_CHECK(process_take_dirty(ctx, &all) == 7 * 17 * (int)sizeof(struct pattern));
+
+        process_destroy_context(ctx);
+    }
+
+    // Zone마다 다른 포인트를 기본 컨텍스트로 반복 측정 - 자기 포인트만 돌려받아야 함
+    void run_zone(int zone, std::atomic<int>* failures)
+    {
+        std::unique_ptr<struct output> out(new struct output());
+        struct input in;
+        std::memset(&in, 0, sizeof(in));
+        std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "ZONE%d", zone);
+        in.total_point = 10;
+        in.cur_point = zone;
+
+        for (int cell = 0; cell < CELLS; ++cell) {
+            struct output_dirty mask;
+            if (IPVS_test_batch_dirty(&in, out.get(), 1, nullptr, &mask) != 1 || !only_point(mask, zone)) {
+                failures->fetch_add(1);
+            }
+        }
+    }
+
+    void test_default_zones()
+    {
+        std::atomic<int> failures(0);
+        std::vector<std::thread> zones;
+        for (int z = 0; z < ZONES; ++z) zones.emplace_back(run_zone, z, &failures);
+        for (std::thread& t : zones) t.join();
+        TEST_CHECK(failures.load() == 0);
+
+        // 기본 컨텍스트 누적은 모든 Zone의 합집합
+        struct output_dirty all;
+        process_take_dirty_default(&all);
+        TEST_CHECK(all.IPVS_data[0] == (1u << ZONES) - 1u);
+    }
+}
+
+int main()
+{
+    test_batch_masks();
+    test_default_zones();
+    return process_test_result("process_dirty_test");
+}
@@ -0,0 +1,145 @@
+// ProcessHviTest.cpp : HVI 비트 평면 판정 ↔ C# 셀 단위 판정 일치 테스트 (CMake process_hvi_test)
+// 무작위 다중 시퀀스 결과(코드 0/1/2 + 범위 밖 코드)를 만들어
+//   기준: OpticJudgment.JudgeZoneFromResults_HVI를 그대로 옮긴 셀 단위 집계 + 슬롯별 최악 코드
+//   대상: process_pack_results + process_hvi_aggregate, process_hvi_record_ctx + process_hvi_judge_ctx
+// 의 OK / PTN 개수, Zone 판정, 최악 코드가 모두 같은지 확인
+
+#include "pch.h"
+#include "ProcessHvi.h"
+#include "ProcessTest.h"
+#include <memory>
+#include <vector>
+
+namespace {
+
+    const int TRIALS = 500;
+
+    struct reference_result {
+        int ok;
+        int ptn;
+        int verdict;            // 0:OK, 1:R/J, 2:PTN
+    };
+
+    // OpticJudgment.JudgeZoneFromResults_HVI (C#) - RESULT_OK(0) / RESULT_PTN(2)만 세고 나머지는 무시
+    reference_result judge_reference(const std::vector<std::vector<int>>& matrices, int ok_threshold,
+                                     int ptn_threshold)
+    {
+        reference_result r = { 0, 0, 1 };
+        for (const std::vector<int>& matrix : matrices) {
+            for (int result : matrix) {
+                if (result == 0) r.ok++;
+                else if (result == 2) r.ptn++;
+            }
+        }
+
+        const int n = (int)matrices.size();
+        if (r.ok >= ok_threshold * n) r.verdict = 0;
+        else if (r.ptn >= ptn_threshold * n) r.verdict = 2;
+        else r.verdict = 1;
+        return r;
+    }
+
+    // 슬롯별 최악 코드: NG(0/2 이외 포함)가 하나라도 있으면 1, 없고 PTN이 있으면 2, 나머지 0
+    std::vector<int> worst_reference(const std::vector<std::vector<int>>& matrices, int slots)
+    {
+        std::vector<int> worst(slots, 0);
+        for (int s = 0; s < slots; ++s) {
+            bool ng = false, ptn = false;
+            for (const std::vector<int>& matrix : matrices) {
+                if (matrix[s] == 2) ptn = true;
+                else if (matrix[s] != 0) ng = true;
+            }
+            worst[s] = ng ? 1 : (ptn ? 2 : 0);
+        }
+        return worst;
+    }
+
+    struct lcg {
+        unsigned int state;
+        explicit lcg(unsigned int seed) : state(seed) {}
+        double uniform()
+        {
+            state = state * 1664525u + 1013904223u;
+            return (double)(state >> 8) / 16777216.0;
+        }
+        int below(int n) { return (int)(uniform() * n); }
+    };
+
+    // kind의 결과 슬롯에 코드 기록 (MTP: data[w][j], IPVS: IPVS_data[w][p])
+    void store(struct output* out, int kind, const std::vector<int>& codes)
+    {
+        struct pattern* dst = (kind == HVI_KIND_MTP) ? &out->data[0][0] : &out->IPVS_data[0][0];
+        for (size_t s = 0; s < codes.size(); ++s) dst[s].result = codes[s];
+    }
+
+    void run_trials(int kind)
+    {
+        const int slots = (kind == HVI_KIND_MTP) ? 7 * 17 : 7 * 10;
+        // 기본 스펙 임계값 (ProcessJudge: MTP 100/13, IPVS 5/2)
+        const int ok_threshold = (kind == HVI_KIND_MTP) ? 100 : 5;
+        const int ptn_threshold = (kind == HVI_KIND_MTP) ? 13 : 2;
+
+        lcg rng(kind == HVI_KIND_MTP ? 16u : 70u);
+        std::unique_ptr<struct output> out(new struct output());
+        process_context* ctx = process_create_context(1);
+        int verdicts[3] = { 0, 0, 0 };
+
+        for (int trial = 0; trial < TRIALS; ++trial) {
+            const int n = 1 + rng.below(16);
+            // 시행마다 OK / PTN 비율을 임계값 근처로 흔들어 세 판정이 모두 나오도록 함
+            const double ok_share = (kind == HVI_KIND_MTP) ? 0.75 + 0.2 * rng.uniform() : 0.02 + 0.1 * rng.uniform();
+            const double ptn_share = (kind == HVI_KIND_MTP) ? 0.2 * rng.uniform() : 0.06 * rng.uniform();
+
+            std::vector<std::vector<int>> matrices(n, std::vector<int>(slots));
+            std::vector<result_planes> planes(n);
+            process_hvi_reset_ctx(ctx);
+
+            for (int i = 0; i < n; ++i) {
+                for (int s = 0; s < slots; ++s) {
+                    const double r = rng.uniform();
+                    int code = 1;
+                    if (r < ok_share) code = 0;
+                    else if (r < ok_share + ptn_share) code = 2;
+                    else if (r > 0.995) code = (rng.below(2) == 0) ? -1 : 3;  // 범위 밖 코드
+                    matrices[i][s] = code;
+                }
+                store(out.get(), kind, matrices[i]);
+                TEST_CHECK(process_pack_results(out.get(), kind, &planes[i]));
+                TEST_CHECK(process_hvi_record_ctx(ctx, out.get(), kind) == i + 1);
+            }
+
+            const reference_result ref = judge_reference(matrices, ok_threshold, ptn_threshold);
+            const std::vector<int> ref_worst = worst_reference(matrices, slots);
+
+            judge_counts counts;
+            std::vector<int> worst(slots, -1);
+            TEST_CHECK(process_hvi_aggregate(planes.data(), n, ok_threshold, ptn_threshold, &counts, worst.data()));
+            TEST_CHECK(counts.ok == ref.ok);
+            TEST_CHECK(counts.ptn == ref.ptn);
+            TEST_CHECK(counts.ng == n * slots - ref.ok - ref.ptn);
+            TEST_CHECK(counts.verdict == ref.verdict);
+            TEST_CHECK(worst == ref_worst);
+
+            // 컨텍스트 경로 (기본 스펙 임계값)
+            judge_counts ctx_counts;
+            std::vector<int> ctx_worst(slots, -1);
+            TEST_CHECK(process_hvi_judge_ctx(ctx, kind, &ctx_counts, ctx_worst.data()));
+            TEST_CHECK(ctx_counts.ok == ref.ok && ctx_counts.ptn == ref.ptn && ctx_counts.verdict == ref.verdict);
+            TEST_CHECK(ctx_worst == ref_worst);
+
+            if (ref.verdict >= 0 && ref.verdict < 3) verdicts[ref.verdict]++;
+        }
+
+        process_destroy_context(ctx);
+        std::fprintf(stderr, "%s: %d trials, verdict OK/NG/PTN = %d/%d/%d\n", kind == HVI_KIND_MTP ? "MTP" : "IPVS",
+                     TRIALS, verdicts[0], verdicts[1], verdicts[2]);
+        TEST_CHECK(verdicts[0] > 0 && verdicts[1] > 0 && verdicts[2] > 0);
+    }
+}
+
+int main()
+{
+    run_trials(HVI_KIND_MTP);
+    run_trials(HVI_KIND_IPVS);
+    return process_test_result("process_hvi_test");
+}
@@ -0,0 +1,87 @@
+// ProcessIndexTest.cpp : 결과 색인 확장 실패 테스트 (CMake process_index_test, POSIX 전용)
+// 보관 파일에 1500행(색인 항목 3000개)을 먼저 기록한 뒤 RLIMIT_FSIZE로 색인 파일 확장(4096 → 8192 슬롯)을 막고
+//   - 색인 추가가 확장 직전에서 멈추고 핸들이 매핑을 잃지 않는지 (개수 / 조회)
+//   - 제한을 풀면 재구성으로 모든 행이 색인되는지
+// 를 확인
+
+#include "pch.h"
+#include "ProcessIndex.h"
+#include "ProcessTest.h"
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <signal.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace {
+
+    const int ROWS = 1500;
+
+    void test_grow_failure()
+    {
+        const std::string stem = "process_index_test_" + std::to_string((long long)getpid());
+        const std::string archive_path = stem + ".oxa";
+        const std::string index_path = stem + ".oxi";
+        std::remove(archive_path.c_str());
+        std::remove(index_path.c_str());
+
+        process_archive* archive = process_archive_open(archive_path.c_str(), 0);
+        TEST_CHECK(archive != nullptr);
+        if (archive == nullptr) return;
+
+        std::unique_ptr<struct output> out(new struct output());
+        std::memset(out.get(), 0, sizeof(struct output));
+        struct input in;
+        std::memset(&in, 0, sizeof(in));
+        for (int r = 0; r < ROWS; ++r) {
+            std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "CELL%04d", r);
+            std::snprintf(in.INNER_ID, sizeof(in.INNER_ID), "INNER%04d", r);
+            TEST_CHECK(process_archive_append(archive, &in, out.get(), 1, -1, 0, 0, 0) == r);
+        }
+
+        process_index* index = process_index_open(index_path.c_str());
+        TEST_CHECK(index != nullptr);
+        if (index == nullptr) {
+            process_archive_close(archive);
+            return;
+        }
+
+        // 초기 색인 파일(4096 슬롯)보다 약간 크게 제한 - 8192 슬롯으로 확장할 때 ftruncate가 EFBIG로 실패
+        struct rlimit saved;
+        TEST_CHECK(getrlimit(RLIMIT_FSIZE, &saved) == 0);
+        signal(SIGXFSZ, SIG_IGN);
+        struct rlimit limited = saved;
+        limited.rlim_cur = 500000;
+        TEST_CHECK(setrlimit(RLIMIT_FSIZE, &limited) == 0);
+
+        // 색인 추가는 채움률 70%(2867개)에서 멈추지만 보관 파일은 등록됨
+        TEST_CHECK(process_index_add_archive(index, archive_path.c_str()) == 0);
+        const int64_t partial = process_index_count(index);
+        std::fprintf(stderr, "grow failed at %lld entries\n", (long long)partial);
+        TEST_CHECK(partial > 0 && partial < 2 * ROWS);
+
+        index_location loc;
+        TEST_CHECK(process_index_lookup(index, "CELL0005", INDEX_KEY_CELL, &loc, 1) == 1 && loc.row == 5);
+        TEST_CHECK(process_index_lookup(index, "CELL1499", INDEX_KEY_CELL, &loc, 1) == 0);
+
+        // 제한 해제 후 재구성
+        TEST_CHECK(setrlimit(RLIMIT_FSIZE, &saved) == 0);
+        TEST_CHECK(process_index_rebuild(index) == 2 * ROWS);
+        TEST_CHECK(process_index_lookup(index, "CELL1499", INDEX_KEY_CELL, &loc, 1) == 1 && loc.row == ROWS - 1);
+        TEST_CHECK(process_index_lookup(index, "INNER0700", INDEX_KEY_INNER, &loc, 1) == 1 && loc.row == 700);
+
+        process_index_close(index);
+        process_archive_close(archive);
+        std::remove(archive_path.c_str());
+        std::remove(index_path.c_str());
+    }
+}
+
+int main()
+{
+    test_grow_failure();
+    return process_test_result("process_index_test");
+}
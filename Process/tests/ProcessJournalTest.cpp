@@ -0,0 +1,166 @@
+// ProcessJournalTest.cpp : 선기록 로그 기록 / 복구 테스트 (CMake process_journal_test, POSIX 전용)
+//   - begin + append 후 sync, 복구한 input / output이 기록한 영역과 같은지
+//   - 레코드 중간에서 파일을 자르면 복구가 마지막 온전한 레코드에서 멈추고, 다시 열면 꼬리를 잘라내고 이어서 기록하는지
+//   - payload 1바이트를 바꾸면 CRC로 그 레코드를 거부하는지
+//   - checkpoint 후 새로 기록한 레코드도 복구되는지
+// 를 확인
+
+#include "pch.h"
+#include "ProcessJournal.h"
+#include "ProcessTest.h"
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+    const int ZONES = 2;
+
+    long file_size(const std::string& path)
+    {
+        struct stat st;
+        return stat(path.c_str(), &st) == 0 ? (long)st.st_size : -1;
+    }
+
+    void fill(struct output* out, float base)
+    {
+        struct pattern* p = &out->data[0][0];
+        for (int i = 0; i < 7 * 17 + 7 * 10 + 7; ++i) {
+            p[i].x = base + i;
+            p[i].L = base * 2.0f + i;
+            p[i].result = i % 3;
+        }
+    }
+
+    struct output_dirty mtp_mask()
+    {
+        struct output_dirty m;
+        std::memset(&m, 0, sizeof(m));
+        for (int w = 0; w < 7; ++w) m.data[w] = 0x1FFFFu;
+        return m;
+    }
+
+    struct output_dirty ipvs_mask(int point)
+    {
+        struct output_dirty m;
+        std::memset(&m, 0, sizeof(m));
+        for (int w = 0; w < 7; ++w) m.IPVS_data[w] = (unsigned short)(1u << point);
+        return m;
+    }
+
+    struct output_dirty measure_mask()
+    {
+        struct output_dirty m;
+        std::memset(&m, 0, sizeof(m));
+        m.measure = 0x7F;
+        return m;
+    }
+
+    // 복구한 셀이 cell_id이고 MTP 전체 + IPVS point가 src와 같은지
+    bool recovered(const char* dir, int zone, const char* cell_id, const struct output* src, int point, int deltas)
+    {
+        struct input in;
+        std::unique_ptr<struct output> out(new struct output());
+        if (process_journal_recover(dir, zone, &in, out.get()) != deltas) return false;
+        if (std::strcmp(in.CELL_ID, cell_id) != 0) return false;
+        if (std::memcmp(out->data, src->data, sizeof(src->data)) != 0) return false;
+        for (int w = 0; w < 7; ++w) {
+            if (std::memcmp(&out->IPVS_data[w][point], &src->IPVS_data[w][point], sizeof(struct pattern)) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void test_journal()
+    {
+        const std::string dir = "process_journal_test_" + std::to_string((long long)getpid());
+        const std::string wal = dir + "/zone_0.wal";
+        TEST_CHECK(mkdir(dir.c_str(), 0755) == 0);
+
+        std::unique_ptr<struct output> out(new struct output());
+        std::memset(out.get(), 0, sizeof(struct output));
+        fill(out.get(), 1.0f);
+        struct input in;
+        std::memset(&in, 0, sizeof(in));
+        std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "CELL_A");
+
+        // 1. 기록 + sync → 복구
+        process_journal* journal = process_journal_open(dir.c_str(), ZONES, 0, 0);
+        TEST_CHECK(journal != nullptr);
+        if (journal == nullptr) return;
+
+        const struct output_dirty mtp = mtp_mask(), ipvs = ipvs_mask(3), meas = measure_mask();
+        TEST_CHECK(process_journal_begin(journal, 0, &in) > 0);
+        TEST_CHECK(process_journal_append(journal, 0, out.get(), &mtp) > 0);
+        const int64_t lsn = process_journal_append(journal, 0, out.get(), &ipvs);
+        TEST_CHECK(lsn > 0);
+        TEST_CHECK(process_journal_sync(journal));
+        TEST_CHECK(process_journal_durable_lsn(journal) >= lsn);
+        TEST_CHECK(recovered(dir.c_str(), 0, "CELL_A", out.get(), 3, 2));
+        TEST_CHECK(process_journal_recover(dir.c_str(), 1, nullptr, nullptr) == 0);    // 빈 Zone
+
+        // 2. 마지막 레코드 중간에서 자름 → 앞 레코드까지만 복구
+        const long whole = file_size(wal);
+        TEST_CHECK(process_journal_append(journal, 0, out.get(), &meas) > 0);
+        TEST_CHECK(process_journal_sync(journal));
+        const long tail = file_size(wal);
+        TEST_CHECK(tail > whole);
+        process_journal_close(journal);
+
+        TEST_CHECK(truncate(wal.c_str(), whole + (tail - whole) / 2) == 0);
+        TEST_CHECK(recovered(dir.c_str(), 0, "CELL_A", out.get(), 3, 2));
+
+        // 다시 열면 잘린 꼬리를 버리고 이어서 기록
+        journal = process_journal_open(dir.c_str(), ZONES, 0, 0);
+        TEST_CHECK(journal != nullptr);
+        if (journal == nullptr) return;
+        TEST_CHECK(file_size(wal) == whole);
+        TEST_CHECK(process_journal_append(journal, 0, out.get(), &meas) > 0);
+        TEST_CHECK(process_journal_sync(journal));
+        TEST_CHECK(file_size(wal) == tail);
+        TEST_CHECK(recovered(dir.c_str(), 0, "CELL_A", out.get(), 3, 3));
+
+        // 3. 마지막 레코드 payload 1바이트 변경 → CRC 불일치로 거부
+        FILE* fp = std::fopen(wal.c_str(), "r+b");
+        TEST_CHECK(fp != nullptr);
+        if (fp != nullptr) {
+            const long offset = whole + 24 + 40;    // 레코드 헤더 24바이트 뒤 payload
+            std::fseek(fp, offset, SEEK_SET);
+            const int c = std::fgetc(fp);
+            std::fseek(fp, offset, SEEK_SET);
+            std::fputc(c ^ 0x5A, fp);
+            std::fclose(fp);
+        }
+        TEST_CHECK(recovered(dir.c_str(), 0, "CELL_A", out.get(), 3, 2));
+
+        // 4. checkpoint 후 새 셀 기록 → 복구
+        TEST_CHECK(process_journal_checkpoint(journal, 0));
+        TEST_CHECK(process_journal_recover(dir.c_str(), 0, nullptr, nullptr) == 0);
+
+        fill(out.get(), 50.0f);
+        std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "CELL_B");
+        const struct output_dirty ipvs7 = ipvs_mask(7);
+        TEST_CHECK(process_journal_begin(journal, 0, &in) > 0);
+        TEST_CHECK(process_journal_append(journal, 0, out.get(), &mtp) > 0);
+        TEST_CHECK(process_journal_append(journal, 0, out.get(), &ipvs7) > 0);
+        TEST_CHECK(process_journal_sync(journal));
+        TEST_CHECK(recovered(dir.c_str(), 0, "CELL_B", out.get(), 7, 2));
+        process_journal_close(journal);
+
+        for (int z = 0; z < ZONES; ++z) {
+            std::remove((dir + "/zone_" + std::to_string(z) + ".wal").c_str());
+        }
+        rmdir(dir.c_str());
+    }
+}
+
+int main()
+{
+    test_journal();
+    return process_test_result("process_journal_test");
+}
@@ -0,0 +1,68 @@
+// ProcessLegacyTest.cpp : 기존 export 함수(기본 컨텍스트 래퍼) 동시 호출 테스트 (CMake process_legacy_test)
+// C# UI는 Zone마다 Task.Run으로 MTP_test / IPVS_test / Getdata를 동시에 호출하므로
+// 여러 스레드가 각자의 output으로 기존 함수를 부를 때 결과가 모두 유효한지 확인
+// (경쟁 자체는 -fsanitize=thread 빌드에서 확인 - 일반 빌드에서는 결과 범위만 검사)
+
+#include "pch.h"
+#include "ProcessFunctions.h"
+#include "ProcessTest.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    const int ZONES = 4;
+    const int CELLS = 200;
+
+    bool valid_codes(const struct pattern* p, int n)
+    {
+        for (int i = 0; i < n; ++i) {
+            if (p[i].result < 0 || p[i].result > 2) return false;
+        }
+        return true;
+    }
+
+    void run_zone(int zone, std::atomic<int>* failures)
+    {
+        std::unique_ptr<struct output> out(new struct output());
+        struct input in;
+        std::memset(&in, 0, sizeof(in));
+        std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "ZONE%d", zone);
+
+        for (int cell = 0; cell < CELLS; ++cell) {
+            bool ok = MTP_test(&in, out.get()) == 1 && valid_codes(&out->data[0][0], 7 * 17);
+
+            in.total_point = 5;
+            for (int point = 0; point < in.total_point; ++point) {
+                in.cur_point = point;
+                ok = IPVS_test(&in, out.get()) == 1 && ok;
+            }
+            ok = valid_codes(&out->IPVS_data[0][0], 7 * 10) && ok;
+            ok = Getdata(out.get()) && ok;
+
+            struct port_state state;
+            get_port_state(&state);
+            if (!ok) failures->fetch_add(1);
+        }
+    }
+}
+
+int main()
+{
+    // 장비 연결은 프로그램 시작 시 1회 (기본 컨텍스트 공유)
+    TEST_CHECK(PGTurn(1));
+    TEST_CHECK(Meas_Turn(1));
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> zones;
+    for (int z = 0; z < ZONES; ++z) zones.emplace_back(run_zone, z + 1, &failures);
+    for (std::thread& t : zones) t.join();
+
+    TEST_CHECK(failures.load() == 0);
+    TEST_CHECK(cleanup_all_devices());
+    return process_test_result("process_legacy_test");
+}
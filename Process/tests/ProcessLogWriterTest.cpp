@@ -0,0 +1,186 @@
+// ProcessLogWriterTest.cpp : 결과 로그 기록기 테스트 (CMake process_log_writer_test)
+//   - 값 서식이 C# float.ToString("F3") (.NET Framework) 출력과 같은지
+//     (7자리 반올림 후 0.5 올림, 음수 / 0으로 반올림되는 음수, NaN / Infinity, 큰 값)
+//   - 여러 스레드가 동시에 process_log_write로 넣은 결과가 빠지거나 섞이지 않고 모두 한 줄씩 기록되는지
+// 를 확인
+
+#include "pch.h"
+#include "ProcessLogWriter.h"
+#include "ProcessTest.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // EECP 행: 앞 6열(시각 / TACT / CELL ID / INNER ID / ZONE) 뒤 패턴 × WAD마다 7열 (X 먼저)
+    const int META_COLUMNS = 6;
+    const int VALUE_COLUMNS = 7;
+
+    std::vector<std::string> split(const std::string& line)
+    {
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string f;
+        while (std::getline(ss, f, ',')) fields.push_back(f);
+        if (!line.empty() && line.back() == ',') fields.push_back(std::string());
+        return fields;
+    }
+
+    // data[k % 7][k / 7].x 열 (헤더 순서: 패턴 바깥, WAD 안쪽)
+    struct pattern& x_slot(struct output* out, int k)
+    {
+        return out->data[k % 7][k / 7];
+    }
+
+    struct fixed3_case {
+        float value;
+        const char* expected;       // C# value.ToString("F3") (.NET Framework 4.x)
+    };
+
+    void test_fixed3()
+    {
+        const float inf = std::numeric_limits<float>::infinity();
+        const fixed3_case cases[] = {
+            { 0.0f, "0.000" },
+            { -0.0f, "0.000" },
+            { 1.0f, "1.000" },
+            { 2.5f, "2.500" },
+            { 1.0005f, "1.001" },               // 7자리 1.000500 → 0.5 올림
+            { 0.0005f, "0.001" },
+            { 0.0004999f, "0.000" },
+            { 1.23449975f, "1.235" },           // 7자리 반올림(1.234500) 후 다시 반올림
+            { 999.9995f, "1000.000" },
+            { -1.2345f, "-1.235" },
+            { -2.0005f, "-2.001" },
+            { -0.0004f, "0.000" },              // 0으로 반올림되면 부호 없음
+            { -0.0005f, "-0.001" },
+            { 123456.789f, "123456.800" },      // 유효 숫자 7자리
+            { 16777217.0f, "16777220.000" },
+            { 1e10f, "10000000000.000" },
+            { -3.4028235e38f, "-340282300000000000000000000000000000000.000" },
+            { std::nanf(""), "NaN" },
+            { inf, "Infinity" },
+            { -inf, "-Infinity" },
+        };
+        const int n = (int)(sizeof(cases) / sizeof(cases[0]));
+
+        std::unique_ptr<struct output> out(new struct output());
+        std::memset(out.get(), 0, sizeof(struct output));
+        for (int k = 0; k < n; ++k) x_slot(out.get(), k).x = cases[k].value;
+
+        struct log_meta meta;
+        std::memset(&meta, 0, sizeof(meta));
+        const log_cell cell = { "CELL", "INNER", 0, 0 };
+        const struct output* outs[1] = { out.get() };
+        std::string row;
+        log_format_row(&row, LOG_LAYOUT_EECP, meta, cell, outs, 1, 0);
+
+        const std::vector<std::string> fields = split(row.substr(0, row.find("\r\n")));
+        TEST_CHECK((int)fields.size() > META_COLUMNS + n * VALUE_COLUMNS);
+        if ((int)fields.size() <= META_COLUMNS + n * VALUE_COLUMNS) return;
+
+        for (int k = 0; k < n; ++k) {
+            const std::string& got = fields[META_COLUMNS + k * VALUE_COLUMNS];
+            if (got != cases[k].expected) {
+                std::fprintf(stderr, "F3(%.9g): got %s, expected %s\n", (double)cases[k].value, got.c_str(),
+                             cases[k].expected);
+            }
+            TEST_CHECK(got == cases[k].expected);
+        }
+    }
+
+    // 스레드마다 ROWS건씩 동시에 기록 - 각 행의 CELL ID와 X 열이 같은 (스레드, 번호)를 가리켜야 함
+    void test_burst()
+    {
+        const int PRODUCERS = 4;
+        const int ROWS = 500;
+        const std::string path = "process_log_writer_test.csv";
+        std::remove(path.c_str());
+
+        // 큐를 작게 하여 생산자가 가득 찬 큐에서 대기하는 경우도 포함
+        process_log_writer* writer = process_log_open(path.c_str(), LOG_LAYOUT_EECP, nullptr, 16);
+        TEST_CHECK(writer != nullptr);
+        if (writer == nullptr) return;
+
+        std::vector<std::thread> producers;
+        std::vector<int> failures(PRODUCERS, 0);
+        for (int t = 0; t < PRODUCERS; ++t) {
+            producers.emplace_back([writer, t, &failures] {
+                std::unique_ptr<struct output> out(new struct output());
+                std::memset(out.get(), 0, sizeof(struct output));
+                struct input in;
+                std::memset(&in, 0, sizeof(in));
+                struct log_meta meta;
+                std::memset(&meta, 0, sizeof(meta));
+                meta.zone = t + 1;
+                std::snprintf(meta.judgment, sizeof(meta.judgment), "OK");
+
+                for (int i = 0; i < ROWS; ++i) {
+                    std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "T%d_%04d", t, i);
+                    x_slot(out.get(), 0).x = (float)(t * 10000 + i);
+                    if (!process_log_write(writer, &in, out.get(), &meta)) failures[t]++;
+                }
+            });
+        }
+        for (std::thread& p : producers) p.join();
+        for (int t = 0; t < PRODUCERS; ++t) TEST_CHECK(failures[t] == 0);
+
+        TEST_CHECK(process_log_flush(writer, 10000));
+        char header[1 << 16];
+        const int header_len = process_log_schema(writer, header, (int)sizeof(header));
+        TEST_CHECK(header_len > 0);
+        process_log_close(writer);
+        if (header_len <= 0) return;
+
+        std::ifstream file(path.c_str(), std::ios::binary);
+        const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+
+        const std::string bom = "\xEF\xBB\xBF";
+        TEST_CHECK(text.compare(0, bom.size(), bom) == 0);
+        const size_t columns = split(std::string(header, header_len)).size();
+
+        std::set<std::string> seen;
+        int rows = 0;
+        int bad = 0;
+        size_t pos = text.find("\r\n");   // 헤더 줄 다음부터
+        while (pos != std::string::npos && pos + 2 < text.size()) {
+            const size_t next = text.find("\r\n", pos + 2);
+            const std::string line = text.substr(pos + 2, next == std::string::npos ? std::string::npos : next - pos - 2);
+            pos = next;
+
+            const std::vector<std::string> fields = split(line);
+            int t = -1, i = -1;
+            if (fields.size() != columns || std::sscanf(fields[3].c_str(), "T%d_%d", &t, &i) != 2 ||
+                fields[5] != std::to_string(t + 1) || std::atof(fields[META_COLUMNS].c_str()) != t * 10000 + i ||
+                !seen.insert(fields[3]).second) {
+                bad++;
+            }
+            rows++;
+        }
+
+        std::fprintf(stderr, "burst: %d rows, %d bad\n", rows, bad);
+        TEST_CHECK(rows == PRODUCERS * ROWS);
+        TEST_CHECK(bad == 0);
+        TEST_CHECK((int)seen.size() == PRODUCERS * ROWS);
+        std::remove(path.c_str());
+    }
+}
+
+int main()
+{
+    test_fixed3();
+    test_burst();
+    return process_test_result("process_log_writer_test");
+}
@@ -0,0 +1,237 @@
+// ProcessSerialTest.cpp : 시리얼 백엔드 pty 쌍 테스트 (CMake process_serial_test, POSIX 전용)
+// posix_openpt로 만든 pty 두 쌍을 PG / 측정기로 연결하고, master 쪽에서 장비 펌웨어를 흉내내어
+// termios 설정 / 줄 단위 송수신 / 응답 대기 시간 초과 / 경로 형식 치환을 확인
+//   PG    : "PTN n" / "VOL r g b" / "PWR OFF" → "OK"
+//   측정기 : "MEAS" → "ACK" → "DATA x,y,L,cur,eff"
+
+#include "pch.h"
+#include "ProcessDevice.h"
+#include "ProcessFunctions.h"
+#include "ProcessTest.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace {
+
+    // pty master 쪽 가짜 장비 (수신한 명령 기록 + 응답)
+    class fake_device {
+    public:
+        explicit fake_device(bool meter) : m_meter(meter), m_fd(-1), m_stop(false), m_silent(false) {}
+
+        ~fake_device() { stop(); }
+
+        bool open()
+        {
+            m_fd = posix_openpt(O_RDWR | O_NOCTTY);
+            if (m_fd < 0 || grantpt(m_fd) != 0 || unlockpt(m_fd) != 0) return false;
+            const char* name = ptsname(m_fd);
+            if (name == nullptr) return false;
+            m_slave = name;
+
+            struct termios tio;
+            if (tcgetattr(m_fd, &tio) == 0) {
+                cfmakeraw(&tio);
+                tcsetattr(m_fd, TCSANOW, &tio);
+            }
+            m_thread = std::thread(&fake_device::run, this);
+            return true;
+        }
+
+        void stop()
+        {
+            m_stop = true;
+            if (m_thread.joinable()) m_thread.join();
+            if (m_fd >= 0) ::close(m_fd);
+            m_fd = -1;
+        }
+
+        const std::string& slave() const { return m_slave; }
+
+        // true: 명령을 받아도 응답하지 않음 (시간 초과 시험)
+        void set_silent(bool silent) { m_silent = silent; }
+
+        std::vector<std::string> commands()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_commands;
+        }
+
+    private:
+        void reply(const std::string& line)
+        {
+            const std::string data = line + "\r\n";
+            size_t off = 0;
+            while (off < data.size() && !m_stop) {
+                ssize_t n = ::write(m_fd, data.data() + off, data.size() - off);
+                if (n > 0) off += (size_t)n;
+                else std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        void handle(const std::string& line)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_commands.push_back(line);
+            }
+            if (m_silent) return;
+
+            if (!m_meter) {
+                reply("OK");
+            }
+            else if (line == "MEAS") {
+                reply("ACK");
+                reply("DATA 0.3127,0.3290,451.5,12.25,3.5");
+            }
+        }
+
+        void run()
+        {
+            std::string buffer;
+            while (!m_stop) {
+                struct pollfd pfd;
+                pfd.fd = m_fd;
+                pfd.events = POLLIN;
+                pfd.revents = 0;
+                if (::poll(&pfd, 1, 10) <= 0 || !(pfd.revents & POLLIN)) {
+                    // slave가 아직 열리지 않았으면 POLLHUP - 잠시 대기
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+
+                char chunk[256];
+                ssize_t n = ::read(m_fd, chunk, sizeof(chunk));
+                if (n <= 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));  // EIO: slave 닫힘
+                    continue;
+                }
+                buffer.append(chunk, (size_t)n);
+
+                size_t nl;
+                while ((nl = buffer.find('\n')) != std::string::npos) {
+                    std::string line = buffer.substr(0, nl);
+                    buffer.erase(0, nl + 1);
+                    if (!line.empty() && line.back() == '\r') line.pop_back();
+                    handle(line);
+                }
+            }
+        }
+
+        bool m_meter;
+        int m_fd;
+        std::atomic<bool> m_stop;
+        std::atomic<bool> m_silent;
+        std::string m_slave;
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::vector<std::string> m_commands;
+    };
+
+    serial_config make_config(const char* pg_path, const char* meas_path, int timeout_ms)
+    {
+        serial_config config;
+        std::memset(&config, 0, sizeof(config));
+        std::strncpy(config.pg_path, pg_path, sizeof(config.pg_path) - 1);
+        std::strncpy(config.meas_path, meas_path, sizeof(config.meas_path) - 1);
+        config.baud = 115200;
+        config.timeout_ms = timeout_ms;
+        return config;
+    }
+
+    void test_path_format()
+    {
+        std::string path;
+        TEST_CHECK(serial_format_path("/dev/ttyUSB%d", 3, &path) && path == "/dev/ttyUSB3");
+        TEST_CHECK(serial_format_path("\\\\.\\COM%d", 12, &path) && path == "\\\\.\\COM12");
+        TEST_CHECK(serial_format_path("/dev/pts/7", 3, &path) && path == "/dev/pts/7");
+        TEST_CHECK(serial_format_path("/tmp/a%%b%d", 1, &path) && path == "/tmp/a%b1");
+        TEST_CHECK(!serial_format_path("/dev/%s%d", 1, &path));
+        TEST_CHECK(!serial_format_path("/dev/tty%d%d", 1, &path));
+        TEST_CHECK(!serial_format_path("/dev/tty%n", 1, &path));
+        TEST_CHECK(!serial_format_path("/dev/tty%", 1, &path));
+        TEST_CHECK(!serial_format_path("", 1, &path));
+
+        // 잘못된 형식은 설정하지 않음
+        process_context* ctx = process_create_context(1);
+        serial_config bad = make_config("/dev/%s", "/dev/ttyUSB%d", 100);
+        TEST_CHECK(!process_set_serial_config(ctx, &bad));
+        TEST_CHECK(process_set_serial_config(ctx, nullptr));
+        process_destroy_context(ctx);
+    }
+
+    void test_pty_devices()
+    {
+        fake_device pg(false);
+        fake_device meter(true);
+        TEST_CHECK(pg.open());
+        TEST_CHECK(meter.open());
+        if (pg.slave().empty() || meter.slave().empty()) return;
+
+        // 측정기는 "/dev/pts/%d" 형식 + 포트 번호로 연결 (치환 경로 확인)
+        const std::string prefix = "/dev/pts/";
+        int meter_port = 0;
+        std::string meas_path = meter.slave();
+        if (meter.slave().compare(0, prefix.size(), prefix) == 0) {
+            meter_port = std::atoi(meter.slave().c_str() + prefix.size());
+            meas_path = prefix + "%d";
+        }
+
+        process_context* ctx = process_create_context(1);
+        serial_config config = make_config(pg.slave().c_str(), meas_path.c_str(), 500);
+        TEST_CHECK(process_set_device_backend(ctx, DEVICE_BACKEND_SERIAL));
+        TEST_CHECK(process_set_serial_config(ctx, &config));
+
+        TEST_CHECK(PGTurn_ctx(ctx, 1));
+        TEST_CHECK(Meas_Turn_ctx(ctx, meter_port));
+        TEST_CHECK(PGPattern_ctx(ctx, 5));
+        TEST_CHECK(PGVoltagesnd_ctx(ctx, 100, 200, 300));
+
+        std::unique_ptr<struct output> out(new struct output());
+        TEST_CHECK(Getdata_ctx(ctx, out.get()));
+        const struct pattern& m = out->measure[0];
+        TEST_CHECK(std::fabs(m.x - 0.3127f) < 1e-5f && std::fabs(m.y - 0.3290f) < 1e-5f);
+        TEST_CHECK(std::fabs(m.L - 451.5f) < 1e-3f && std::fabs(m.cur - 12.25f) < 1e-5f);
+
+        // 응답 없는 측정기: 설정한 대기 시간 후 실패
+        meter.set_silent(true);
+        const auto t0 = std::chrono::steady_clock::now();
+        TEST_CHECK(!Getdata_ctx(ctx, out.get()));
+        const double waited = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        TEST_CHECK(waited >= 450.0 && waited < 5000.0);
+        meter.set_silent(false);
+
+        TEST_CHECK(pg_off_ctx(ctx));
+        TEST_CHECK(meas_off_ctx(ctx));
+        process_destroy_context(ctx);
+
+        const std::vector<std::string> pg_cmds = pg.commands();
+        TEST_CHECK(pg_cmds.size() == 3);
+        if (pg_cmds.size() == 3) {
+            TEST_CHECK(pg_cmds[0] == "PTN 5");
+            TEST_CHECK(pg_cmds[1] == "VOL 100 200 300");
+            TEST_CHECK(pg_cmds[2] == "PWR OFF");
+        }
+        const std::vector<std::string> meter_cmds = meter.commands();
+        TEST_CHECK(meter_cmds.size() == 2 && meter_cmds[0] == "MEAS" && meter_cmds[1] == "MEAS");
+    }
+}
+
+int main()
+{
+    test_path_format();
+    test_pty_devices();
+    return process_test_result("process_serial_test");
+}
@@ -0,0 +1,29 @@
+#pragma once
+// ProcessTest.h : CMake 테스트 공용 검사 매크로 (ctest add_test 실행 파일용)
+// 실패한 조건은 파일:줄과 함께 stderr에 기록하고 계속 진행, main은 process_test_result()를 반환
+
+#include <cstdio>
+
+namespace process_test {
+    inline int& failures()
+    {
+        static int count = 0;
+        return count;
+    }
+}
+
+#define TEST_CHECK(cond)                                                                   \
+    do {                                                                                   \
+        if (!(cond)) {                                                                     \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++process_test::failures();                                                    \
+        }                                                                                  \
+    } while (0)
+
+// 실패 수를 출력하고 종료 코드 반환 (0: 통과)
+inline int process_test_result(const char* name)
+{
+    const int n = process_test::failures();
+    std::fprintf(stderr, "%s: %s (%d failed checks)\n", name, n == 0 ? "PASS" : "FAIL", n);
+    return n == 0 ? 0 : 1;
+}
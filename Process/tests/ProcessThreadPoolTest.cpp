@@ -0,0 +1,62 @@
+// ProcessThreadPoolTest.cpp : 작업 스레드 풀 parallel_for 예외 처리 테스트 (CMake process_thread_pool_test)
+// 조각 하나가 예외를 던져도
+//   - 다른 조각이 모두 끝난 뒤에 호출 스레드로 예외가 전달되는지 (되감기 중 작업 스레드가 스택을 쓰지 않음)
+//   - 이후 같은 풀로 다시 parallel_for를 호출할 수 있는지
+// 를 확인
+
+#include "pch.h"
+#include "ProcessThreadPool.h"
+#include "ProcessTest.h"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+    const int N = 64;
+    const int THREADS = 4;
+
+    // throw_slot 조각이 예외를 던지고 나머지 조각은 지연 후 완료 - 예외 전달 시점에 완료 수 확인
+    void test_throw(process_thread_pool* pool, int throw_slot)
+    {
+        std::atomic<int> done(0);
+        int chunks = 0;
+        bool caught = false;
+        try {
+            pool->parallel_for(N, THREADS, [&](int begin, int end, int slot) {
+                (void)begin;
+                (void)end;
+                if (slot == throw_slot) {
+                    throw std::runtime_error("chunk failed");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                done.fetch_add(1);
+            });
+        }
+        catch (const std::runtime_error&) {
+            caught = true;
+            chunks = done.load();
+        }
+
+        TEST_CHECK(caught);
+        TEST_CHECK(chunks == THREADS - 1);
+    }
+}
+
+int main()
+{
+    process_thread_pool pool(THREADS - 1);
+
+    test_throw(&pool, 0);   // 호출 스레드 조각
+    test_throw(&pool, 2);   // 작업 스레드 조각
+
+    // 예외 후에도 풀 정상 동작
+    std::atomic<int> sum(0);
+    pool.parallel_for(N, THREADS, [&](int begin, int end, int) {
+        for (int i = begin; i < end; ++i) sum += i;
+    });
+    TEST_CHECK(sum.load() == N * (N - 1) / 2);
+
+    return process_test_result("process_thread_pool_test");
+}
@@ -0,0 +1,94 @@
+// ProcessUniformityTest.cpp : IPVS 균일도 셀 단위 누적 테스트 (CMake process_uniformity_test)
+// 두 셀(CELL_ID)의 포인트를 한 컨텍스트에 번갈아 넣어도 (기본 컨텍스트를 여러 Zone이 함께 쓰는 경우)
+// 셀별 통계가 각 셀만 따로 측정한 컨텍스트의 결과와 같은지, 포인트 0 재검사 / 셀 교체 / 초기화를 확인
+
+#include "pch.h"
+#include "ProcessUniformity.h"
+#include "ProcessTest.h"
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace {
+
+    const int POINTS = 5;
+
+    struct input make_input(const char* cell_id, int point)
+    {
+        struct input in;
+        std::memset(&in, 0, sizeof(in));
+        std::snprintf(in.CELL_ID, sizeof(in.CELL_ID), "%s", cell_id);
+        in.total_point = POINTS;
+        in.cur_point = point;
+        return in;
+    }
+
+    bool same_stats(const uniformity_stats& a, const uniformity_stats& b)
+    {
+        return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+
+    void test_interleaved_cells()
+    {
+        process_context* shared = process_create_context(1);
+        process_context* only_a = process_create_context(2);
+        process_context* only_b = process_create_context(3);
+        std::unique_ptr<struct output> out(new struct output());
+
+        // 포인트마다 A, B를 번갈아 측정
+        for (int point = 0; point < POINTS; ++point) {
+            for (const char* id : { "CELL_A", "CELL_B" }) {
+                struct input in = make_input(id, point);
+                TEST_CHECK(IPVS_test_ctx(shared, &in, out.get()) == 1);
+                TEST_CHECK(IPVS_test_ctx(std::strcmp(id, "CELL_A") == 0 ? only_a : only_b, &in, out.get()) == 1);
+            }
+        }
+
+        for (int w = 0; w < 7; ++w) {
+            uniformity_stats a, b, ref_a, ref_b;
+            TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_A", w, &a) == POINTS);
+            TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_B", w, &b) == POINTS);
+            TEST_CHECK(process_uniformity_get_ctx(only_a, w, &ref_a) == POINTS);
+            TEST_CHECK(process_uniformity_get_ctx(only_b, w, &ref_b) == POINTS);
+            TEST_CHECK(same_stats(a, ref_a));
+            TEST_CHECK(same_stats(b, ref_b));
+
+            // get은 마지막으로 갱신된 셀 (B)
+            uniformity_stats last;
+            TEST_CHECK(process_uniformity_get_ctx(shared, w, &last) == POINTS && same_stats(last, b));
+        }
+
+        // 같은 셀의 포인트 0은 재검사 시작 - 그 셀만 초기화
+        struct input again = make_input("CELL_A", 0);
+        TEST_CHECK(IPVS_test_ctx(shared, &again, out.get()) == 1);
+        uniformity_stats s;
+        TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_A", 0, &s) == 1);
+        TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_B", 0, &s) == POINTS);
+
+        // 보관 수(8)를 넘으면 가장 오래 갱신되지 않은 셀(B)부터 교체
+        for (int c = 0; c < 7; ++c) {
+            char id[16];
+            std::snprintf(id, sizeof(id), "CELL_%d", c);
+            struct input in = make_input(id, 0);
+            TEST_CHECK(IPVS_test_ctx(shared, &in, out.get()) == 1);
+        }
+        TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_B", 0, &s) == 0);
+        TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_A", 0, &s) == 1);
+        TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_6", 0, &s) == 1);
+
+        process_uniformity_reset_ctx(shared);
+        TEST_CHECK(process_uniformity_get_ctx(shared, 0, &s) == 0);
+        TEST_CHECK(process_uniformity_get_cell_ctx(shared, "CELL_A", 0, &s) == 0);
+        TEST_CHECK(process_uniformity_get_cell_ctx(shared, nullptr, 0, &s) == -1);
+
+        process_destroy_context(shared);
+        process_destroy_context(only_a);
+        process_destroy_context(only_b);
+    }
+}
+
+int main()
+{
+    test_interleaved_cells();
+    return process_test_result("process_uniformity_test");
+}